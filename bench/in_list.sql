@@ -0,0 +1,100 @@
+-- Large IN-list benchmark for pg_num2int_direct_comp
+--
+-- Usage: make bench-in-list [INLIST_ROWS=100000] [INLIST_RUNS=3]
+--   or:  psql -X -v rows=100000 -v runs=3 -f bench/in_list.sql
+--
+-- Times "= ANY" against constant arrays of 10 to 20,000 elements over a
+-- rows-row table, with the array rewrite on and off
+-- (pg_num2int_direct_comp.enableSupportFunctions). With the rewrite the array
+-- is converted to the column's own type and PostgreSQL 14+ evaluates lists of
+-- 9 or more elements with a hash probe; without it every row is compared with
+-- every element through the cross-type operator, which has no hash function
+-- usable for the array. Reports the best execution and planning time of runs
+-- EXPLAIN ANALYZE executions; the planning time includes converting the array.
+--
+-- The list holds the first n multiples of 4 and the table the values 0 to
+-- 39999, so a quarter of the rows or fewer match: a linear scan runs to the
+-- end of the list for most rows. The table has no index, so every predicate
+-- is evaluated as a filter.
+
+\set ON_ERROR_STOP 1
+\if :{?rows}
+\else
+\set rows 100000
+\endif
+\if :{?runs}
+\else
+\set runs 3
+\endif
+
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+SELECT current_setting('server_version') AS server_version;
+
+DROP TABLE IF EXISTS n2i_in_list;
+CREATE UNLOGGED TABLE n2i_in_list (int_col int4, float8_col float8,
+                                   numeric_col numeric);
+INSERT INTO n2i_in_list
+SELECT i % 40000, i % 40000, i % 40000
+FROM generate_series(1, :rows) i;
+VACUUM ANALYZE n2i_in_list;
+
+SET max_parallel_workers_per_gather = 0;
+SET jit = off;
+
+-- Best execution and planning time of runs EXPLAIN ANALYZE executions
+CREATE FUNCTION pg_temp.in_list_time(query text, runs int,
+                                     OUT best_ms float8,
+                                     OUT planning_ms float8)
+LANGUAGE plpgsql AS $$
+DECLARE
+  plan json;
+BEGIN
+  FOR i IN 1..runs LOOP
+    EXECUTE 'EXPLAIN (ANALYZE, TIMING OFF, FORMAT JSON) ' || query INTO plan;
+    best_ms := least(best_ms, (plan->0->>'Execution Time')::float8);
+    planning_ms := least(planning_ms, (plan->0->>'Planning Time')::float8);
+  END LOOP;
+END $$;
+
+CREATE FUNCTION pg_temp.in_list_bench(runs int)
+RETURNS TABLE (predicate text, elements int, rewrite text, best_ms numeric,
+               planning_ms numeric)
+LANGUAGE plpgsql AS $$
+DECLARE
+  q record;
+  n int;
+  list text;
+  query text;
+  setting text;
+  t record;
+BEGIN
+  FOR q IN SELECT * FROM (VALUES
+      ('int_col = ANY (numeric[])', 'int_col', 'numeric'),
+      ('float8_col = ANY (int4[])', 'float8_col', 'int4'),
+      ('numeric_col = ANY (int8[])', 'numeric_col', 'int8')
+    ) v(label, col, elemtype) LOOP
+    FOREACH n IN ARRAY ARRAY[10, 100, 1000, 10000, 20000] LOOP
+      SELECT string_agg((i * 4)::text, ',') INTO list
+      FROM generate_series(1, n) i;
+      query := format('SELECT count(*) FROM n2i_in_list WHERE %s = ANY (%L::%s[])',
+                      q.col, '{' || list || '}', q.elemtype);
+      predicate := q.label;
+      elements := n;
+
+      FOREACH setting IN ARRAY ARRAY['on', 'off'] LOOP
+        PERFORM set_config('pg_num2int_direct_comp.enableSupportFunctions',
+                           setting, true);
+        t := pg_temp.in_list_time(query, runs);
+        rewrite := setting;
+        best_ms := round(t.best_ms::numeric, 1);
+        planning_ms := round(t.planning_ms::numeric, 2);
+        RETURN NEXT;
+      END LOOP;
+    END LOOP;
+  END LOOP;
+END $$;
+
+SELECT * FROM pg_temp.in_list_bench(:runs);
+
+DROP TABLE n2i_in_list;
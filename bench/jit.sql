@@ -0,0 +1,97 @@
+-- JIT inlining benchmark for pg_num2int_direct_comp
+--
+-- Usage: make bench-jit [JIT_ROWS=10000000] [JIT_RUNS=3]
+--   or:  psql -X -v rows=10000000 -v runs=3 -f bench/jit.sql
+--
+-- Times two filters over a rows-row table with JIT off and with JIT on at
+-- several jit_inline_above_cost thresholds (-1 never inlines, 0 always
+-- tries to, 500000 is the default). Optimization and expression compilation
+-- are forced on whenever JIT is on, so the rows differ only in whether
+-- inlining the cross-type operator into the compiled qual was attempted.
+-- Inlining needs the module's bitcode, which PGXS installs under
+-- $libdir/bitcode when PostgreSQL was built with LLVM; see doc/benchmark.md.
+--
+-- Support functions are disabled so that float8_col = 42 stays a cross-type
+-- comparison instead of being simplified to float8_col = 42::float8.
+
+\set ON_ERROR_STOP 1
+\if :{?rows}
+\else
+\set rows 10000000
+\endif
+\if :{?runs}
+\else
+\set runs 3
+\endif
+
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+SELECT pg_jit_available() AS jit_available;
+
+DROP TABLE IF EXISTS n2i_jit;
+CREATE UNLOGGED TABLE n2i_jit (float8_col float8, numeric_col numeric, int_col int4);
+INSERT INTO n2i_jit
+SELECT (i % 1000)::float8, (i % 1000)::numeric, (i * 7919) % 1000
+FROM generate_series(1, :rows) i;
+VACUUM ANALYZE n2i_jit;
+
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+SET max_parallel_workers_per_gather = 0;
+
+-- Best execution time of runs EXPLAIN ANALYZE executions, and whether
+-- inlining was enabled for the query (JIT -> Options -> Inlining). That only
+-- says jit_inline_above_cost was crossed, not that LLVM found the bitcode and
+-- inlined anything: compare the -1 and 0 rows for that.
+CREATE FUNCTION pg_temp.jit_time(query text, runs int,
+                                 OUT inlining_enabled bool, OUT best_ms float8)
+LANGUAGE plpgsql AS $$
+DECLARE
+  plan json;
+BEGIN
+  FOR i IN 1..runs LOOP
+    EXECUTE 'EXPLAIN (ANALYZE, TIMING OFF, FORMAT JSON) ' || query INTO plan;
+    best_ms := least(best_ms, (plan->0->>'Execution Time')::float8);
+    inlining_enabled := coalesce((plan->0->'JIT'->'Options'->>'Inlining')::bool,
+                                 false);
+  END LOOP;
+END $$;
+
+CREATE FUNCTION pg_temp.jit_bench(runs int)
+RETURNS TABLE (predicate text, setting text, inlining_enabled bool,
+               best_ms numeric)
+LANGUAGE plpgsql AS $$
+DECLARE
+  q record;
+  threshold text;
+  t record;
+BEGIN
+  FOR q IN SELECT * FROM (VALUES
+      ('float8_col = 42', 'SELECT count(*) FROM n2i_jit WHERE float8_col = 42'),
+      ('numeric_col < int_col', 'SELECT count(*) FROM n2i_jit WHERE numeric_col < int_col')
+    ) v(label, query) LOOP
+    predicate := q.label;
+
+    PERFORM set_config('jit', 'off', true);
+    t := pg_temp.jit_time(q.query, runs);
+    setting := 'jit = off';
+    inlining_enabled := t.inlining_enabled;
+    best_ms := round(t.best_ms::numeric, 1);
+    RETURN NEXT;
+
+    PERFORM set_config('jit', 'on', true);
+    PERFORM set_config('jit_above_cost', '0', true);
+    PERFORM set_config('jit_optimize_above_cost', '0', true);
+    FOREACH threshold IN ARRAY ARRAY['-1', '0', '500000'] LOOP
+      PERFORM set_config('jit_inline_above_cost', threshold, true);
+      t := pg_temp.jit_time(q.query, runs);
+      setting := 'jit_inline_above_cost = ' || threshold;
+      inlining_enabled := t.inlining_enabled;
+      best_ms := round(t.best_ms::numeric, 1);
+      RETURN NEXT;
+    END LOOP;
+  END LOOP;
+END $$;
+
+SELECT * FROM pg_temp.jit_bench(:runs);
+
+DROP TABLE n2i_jit;
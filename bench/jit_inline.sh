@@ -0,0 +1,102 @@
+#!/bin/sh
+#
+# JIT inlining check for pg_num2int_direct_comp
+#
+# bench/jit.sql can only show inlining indirectly, as a lower time with
+# jit_inline_above_cost = 0 than with -1. This script checks the compiled
+# code itself: it runs each query with jit_dump_bitcode = on, disassembles
+# the module the JIT wrote before and after optimization, and reports for
+# the cross-type operator wrapper of the query
+#
+#   referenced  the unoptimized module calls the wrapper (the qual was
+#               compiled with a call to the extension's operator)
+#   inlined     the optimized module no longer calls it (LLVM inlined the
+#               wrapper from $libdir/bitcode into the compiled qual)
+#
+# together with the exported helpers (createCmpCache, countNumericSlowPath,
+# ...) the inlined code calls. A query that ran and lists helpers here proves
+# that the JIT resolved them in the loaded module.
+#
+# Usage: bench/jit_inline.sh            (or: make check-jit-inline)
+#
+# Needs a superuser connection (jit_dump_bitcode, data_directory), a server
+# built with LLVM on this machine, read and write access to its data
+# directory (the dumped .bc files are written there and removed afterwards),
+# and llvm-dis (LLVM_DIS, default llvm-dis). Connection parameters come from
+# the usual PGHOST, PGPORT, PGDATABASE, PGUSER variables.
+
+set -eu
+
+PSQL=${PSQL:-psql}
+LLVM_DIS=${LLVM_DIS:-llvm-dis}
+
+"$PSQL" -X -q -c "CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp"
+"$PSQL" -X -q <<'EOF'
+DROP TABLE IF EXISTS n2i_jit_inline;
+CREATE UNLOGGED TABLE n2i_jit_inline (float8_col float8, numeric_col numeric,
+                                      int_col int4);
+INSERT INTO n2i_jit_inline
+SELECT (i % 1000)::float8, (i % 1000)::numeric, (i * 7919) % 1000
+FROM generate_series(1, 10000) i;
+ANALYZE n2i_jit_inline;
+EOF
+
+version=$("$PSQL" -X -At -c "SHOW server_version")
+available=$("$PSQL" -X -At -c "SELECT pg_jit_available()")
+datadir=$("$PSQL" -X -At -c "SHOW data_directory")
+echo "server_version: $version"
+echo "jit_available: $available"
+if [ "$available" != t ]; then
+  echo "server was built without LLVM; nothing to check" >&2
+  exit 1
+fi
+
+echo "query,wrapper,referenced,inlined,helpers_called"
+status=0
+
+# One line per check: wrapper symbol|query
+while IFS='|' read -r wrapper query; do
+  pid=$("$PSQL" -X -q -At \
+        -c "SET pg_num2int_direct_comp.enableSupportFunctions = off" \
+        -c "SET max_parallel_workers_per_gather = 0" \
+        -c "SET jit = on" \
+        -c "SET jit_above_cost = 0" \
+        -c "SET jit_optimize_above_cost = 0" \
+        -c "SET jit_inline_above_cost = 0" \
+        -c "SET jit_dump_bitcode = on" \
+        -c "SELECT pg_backend_pid()" \
+        -c "$query" </dev/null | head -n 1)
+
+  # Every module this backend dumped (the files are named pid.generation)
+  plain=$(for f in "$datadir/$pid".*.bc; do
+            case "$f" in *.optimized.bc) ;; *) "$LLVM_DIS" -o - "$f" ;; esac
+          done)
+  optimized=$(for f in "$datadir/$pid".*.optimized.bc; do
+                "$LLVM_DIS" -o - "$f"
+              done)
+  rm -f "$datadir/$pid".*.bc
+
+  callee="call.*@\"pgextern\\.[^\"]*\\.$wrapper\""
+  if printf '%s\n' "$plain" | grep -q "$callee"; then
+    referenced=yes
+  else
+    referenced=no
+  fi
+  if [ "$referenced" = yes ] &&
+     ! printf '%s\n' "$optimized" | grep -q "$callee"; then
+    inlined=yes
+  else
+    inlined=no
+    status=1
+  fi
+  helpers=$(printf '%s\n' "$optimized" |
+            grep -o 'call[^@]*@\(createCmpCache\|cacheInexactOperand\|cacheNumericOperand\|cacheIntOperand\|countNumericSlowPath\)(' |
+            sed 's/.*@\(.*\)(/\1/' | sort -u | tr '\n' ' ' | sed 's/ $//')
+  echo "$query,$wrapper,$referenced,$inlined,$helpers"
+done <<'EOF'
+float8_eq_int4|SELECT count(*) FROM n2i_jit_inline WHERE float8_col = 42
+numeric_lt_int4|SELECT count(*) FROM n2i_jit_inline WHERE numeric_col < int_col
+EOF
+
+"$PSQL" -X -q -c "DROP TABLE n2i_jit_inline"
+exit $status
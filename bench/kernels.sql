@@ -0,0 +1,27 @@
+-- Kernel microbenchmark for pg_num2int_direct_comp
+--
+-- Usage: make bench [BENCH_KERNEL=all] [BENCH_ITERATIONS=10000000]
+--   or:  psql -X -v kernel=all -v iterations=10000000 -f bench/kernels.sql
+--
+-- Each row times one kernel over 1024 prepared operands, cycled for the
+-- requested number of calls. Compare runs on the same machine and build
+-- configuration only; see doc/benchmark.md.
+
+\set ON_ERROR_STOP 1
+\if :{?kernel}
+\else
+\set kernel all
+\endif
+\if :{?iterations}
+\else
+\set iterations 10000000
+\endif
+
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+SELECT kernel_name,
+       distribution,
+       calls,
+       round(ns_per_op::numeric, 2) AS ns_per_op,
+       round(cycles_per_op::numeric, 1) AS cycles_per_op
+FROM num2int_bench(:'kernel', :iterations);
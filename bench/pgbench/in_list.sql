@@ -0,0 +1,12 @@
+-- IN-list of 10 numeric keys against the int8 key
+\set k1 random(1, :scale * 100000)
+\set k2 random(1, :scale * 100000)
+\set k3 random(1, :scale * 100000)
+\set k4 random(1, :scale * 100000)
+\set k5 random(1, :scale * 100000)
+\set k6 random(1, :scale * 100000)
+\set k7 random(1, :scale * 100000)
+\set k8 random(1, :scale * 100000)
+\set k9 random(1, :scale * 100000)
+\set k10 random(1, :scale * 100000)
+SELECT count(*) FROM n2i_fact WHERE id IN (:k1::numeric, :k2::numeric, :k3::numeric, :k4::numeric, :k5::numeric, :k6::numeric, :k7::numeric, :k8::numeric, :k9::numeric, :k10::numeric);
@@ -0,0 +1,3 @@
+-- Cross-type join: 100 numeric dimension keys against the int8 key
+\set grp random(0, :scale * 10 - 1)
+SELECT count(*), sum(f.val) FROM n2i_dim d JOIN n2i_fact f ON f.id = d.key WHERE d.grp = :grp;
@@ -0,0 +1,3 @@
+-- Point lookup on the int8 key with a numeric comparand
+\set id random(1, :scale * 100000)
+SELECT val FROM n2i_fact WHERE id = :id::numeric;
@@ -0,0 +1,3 @@
+-- Point lookup written for stock PostgreSQL: cast the key column
+\set id random(1, :scale * 100000)
+SELECT val FROM n2i_fact WHERE id::numeric = :id::numeric;
@@ -0,0 +1,3 @@
+-- 100-row range scan on the int8 key with fractional numeric bounds
+\set lo random(1, :scale * 100000 - 100)
+SELECT count(*) FROM n2i_fact WHERE id > (:lo - 0.5)::numeric AND id < (:lo + 99.5)::numeric;
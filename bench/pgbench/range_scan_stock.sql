@@ -0,0 +1,3 @@
+-- 100-row range scan written for stock PostgreSQL: cast the key column
+\set lo random(1, :scale * 100000 - 100)
+SELECT count(*) FROM n2i_fact WHERE id::numeric > (:lo - 0.5)::numeric AND id::numeric < (:lo + 99.5)::numeric;
@@ -0,0 +1,93 @@
+#!/bin/sh
+#
+# pgbench workload suite for pg_num2int_direct_comp
+#
+# Runs every workload in three variants against the same tables:
+#
+#   extension  cross-type predicates (id = $1::numeric), extension enabled
+#   nosupport  same scripts, pg_num2int_direct_comp.enableSupportFunctions = off
+#   stock      predicates written as stock PostgreSQL needs them (id::numeric)
+#
+# and prints one CSV line per run with TPS and latency percentiles.
+#
+# Usage: bench/pgbench/run.sh            (or: make bench-pgbench)
+#
+# Settings (environment):
+#   SCALE      100,000 fact rows per unit                 (default 10)
+#   CLIENTS    client counts to run                       (default "1 4 16")
+#   PROTOCOLS  pgbench -M modes                           (default "simple extended prepared")
+#   WORKLOADS  subset of point_lookup range_scan in_list join
+#   VARIANTS   subset of extension nosupport stock
+#   DURATION   seconds per run                            (default 30)
+#   SETUP      set to 0 to reuse tables from a previous run
+#   RESULTS    CSV output file                            (default bench/pgbench/results.csv)
+#
+# Connection parameters come from the usual PGHOST, PGPORT, PGDATABASE,
+# PGUSER variables.
+
+set -eu
+
+DIR=$(cd "$(dirname "$0")" && pwd)
+PSQL=${PSQL:-psql}
+PGBENCH=${PGBENCH:-pgbench}
+SCALE=${SCALE:-10}
+CLIENTS=${CLIENTS:-"1 4 16"}
+PROTOCOLS=${PROTOCOLS:-"simple extended prepared"}
+WORKLOADS=${WORKLOADS:-"point_lookup range_scan in_list join"}
+VARIANTS=${VARIANTS:-"extension nosupport stock"}
+DURATION=${DURATION:-30}
+SETUP=${SETUP:-1}
+RESULTS=${RESULTS:-"$DIR/results.csv"}
+
+LOGDIR=$(mktemp -d)
+trap 'rm -rf "$LOGDIR"' EXIT
+
+if [ "$SETUP" != 0 ]; then
+  echo "Creating tables (scale $SCALE)..." >&2
+  "$PSQL" -X -q -v scale="$SCALE" -f "$DIR/setup.sql"
+fi
+
+# Latency percentile (ms) from per-transaction logs: field 3 is microseconds
+percentile() {
+  sort -n | awk -v p="$1" '{ v[NR] = $1 } END {
+    if (NR == 0) { print ""; exit }
+    i = int(NR * p / 100 + 0.5); if (i < 1) i = 1; if (i > NR) i = NR
+    printf "%.3f\n", v[i] / 1000 }'
+}
+
+echo "workload,variant,protocol,clients,tps,latency_avg_ms,latency_p50_ms,latency_p95_ms,latency_p99_ms" | tee "$RESULTS"
+
+for workload in $WORKLOADS; do
+  for variant in $VARIANTS; do
+    script="$DIR/$workload.sql"
+    options=""
+    case "$variant" in
+      extension) ;;
+      nosupport) options="-c pg_num2int_direct_comp.enableSupportFunctions=off" ;;
+      stock) script="$DIR/${workload}_stock.sql" ;;
+      *) echo "unknown variant: $variant" >&2; exit 1 ;;
+    esac
+
+    for protocol in $PROTOCOLS; do
+      for clients in $CLIENTS; do
+        rm -f "$LOGDIR"/pgbench_log.*
+        out=$(PGOPTIONS="$options" "$PGBENCH" -n -M "$protocol" \
+              -c "$clients" -j "$clients" -T "$DURATION" -D scale="$SCALE" \
+              -l --log-prefix="$LOGDIR/pgbench_log" -f "$script" 2>&1) || {
+          echo "$out" >&2
+          exit 1
+        }
+
+        # PostgreSQL 13 and older print the connection-excluding figure last
+        tps=$(echo "$out" | grep '^tps = ' | tail -1 | awk '{ print $3 }')
+        avg=$(echo "$out" | grep '^latency average' | awk '{ print $4 }')
+        cat "$LOGDIR"/pgbench_log.* | awk '{ print $3 }' > "$LOGDIR/latency"
+        p50=$(percentile 50 < "$LOGDIR/latency")
+        p95=$(percentile 95 < "$LOGDIR/latency")
+        p99=$(percentile 99 < "$LOGDIR/latency")
+
+        echo "$workload,$variant,$protocol,$clients,$tps,$avg,$p50,$p95,$p99" | tee -a "$RESULTS"
+      done
+    done
+  done
+done
@@ -0,0 +1,41 @@
+-- pgbench workload tables for pg_num2int_direct_comp
+--
+-- Run by run.sh; scale is set with -v scale=N (100,000 fact rows per unit).
+--
+-- n2i_fact: int8 primary key probed with numeric/float comparands
+-- n2i_dim:  numeric join keys, 100 per group, joined to n2i_fact.id
+
+\set ON_ERROR_STOP 1
+\if :{?scale}
+\else
+\set scale 10
+\endif
+
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+DROP TABLE IF EXISTS n2i_fact;
+DROP TABLE IF EXISTS n2i_dim;
+
+CREATE TABLE n2i_fact (
+  id      int8 PRIMARY KEY,
+  val     int4 NOT NULL,
+  payload text NOT NULL
+);
+
+INSERT INTO n2i_fact
+SELECT g, (g % 1000)::int4, md5(g::text)
+FROM generate_series(1, :scale * 100000) g;
+
+CREATE TABLE n2i_dim (
+  key numeric NOT NULL,
+  grp int4 NOT NULL
+);
+
+INSERT INTO n2i_dim
+SELECT (g * 7919 % (:scale * 100000)) + 1, g / 100
+FROM generate_series(0, :scale * 1000 - 1) g;
+
+CREATE INDEX n2i_dim_grp_idx ON n2i_dim (grp);
+
+VACUUM ANALYZE n2i_fact;
+VACUUM ANALYZE n2i_dim;
@@ -0,0 +1,83 @@
+#!/bin/sh
+#
+# Planning-latency benchmark for pg_num2int_direct_comp
+#
+# Plans queries with a growing number of cross-type predicates and reports
+# the median planning time, and the time per predicate, for
+#
+#   cold  the first query of a new backend: the operator OID cache
+#         (initOidCache) and the catalog caches are empty
+#   warm  repeated plans in one backend after a first untimed plan
+#
+# in three variants:
+#
+#   extension  cross-type predicates (id > 10.5), extension enabled
+#   nosupport  same queries, pg_num2int_direct_comp.enableSupportFunctions = off
+#   stock      predicates written as stock PostgreSQL needs them (id::numeric)
+#
+# Usage: bench/planning/run.sh            (or: make bench-planning)
+#
+# Settings (environment):
+#   PREDICATES  predicate counts to run             (default "10 100 1000 10000")
+#   SHAPES      subset of and_numeric and_float8 or_numeric in_numeric
+#   VARIANTS    subset of extension nosupport stock
+#   RUNS        plans (warm) or backends (cold) per measurement (default 5)
+#   SETUP       set to 0 to reuse objects from a previous run
+#   RESULTS     CSV output file                    (default bench/planning/results.csv)
+#
+# Connection parameters come from the usual PGHOST, PGPORT, PGDATABASE,
+# PGUSER variables.
+
+set -eu
+
+DIR=$(cd "$(dirname "$0")" && pwd)
+PSQL=${PSQL:-psql}
+PREDICATES=${PREDICATES:-"10 100 1000 10000"}
+SHAPES=${SHAPES:-"and_numeric and_float8 or_numeric in_numeric"}
+VARIANTS=${VARIANTS:-"extension nosupport stock"}
+RUNS=${RUNS:-5}
+SETUP=${SETUP:-1}
+RESULTS=${RESULTS:-"$DIR/results.csv"}
+
+if [ "$SETUP" != 0 ]; then
+  echo "Creating benchmark objects..." >&2
+  "$PSQL" -X -q -f "$DIR/setup.sql"
+fi
+
+# Median of one number per line
+median() {
+  sort -n | awk '{ v[NR] = $1 } END {
+    if (NR == 0) { print ""; exit }
+    if (NR % 2) printf "%.3f\n", v[(NR + 1) / 2]
+    else printf "%.3f\n", (v[NR / 2] + v[NR / 2 + 1]) / 2 }'
+}
+
+echo "shape,variant,predicates,backend,planning_ms,us_per_predicate" | tee "$RESULTS"
+
+for shape in $SHAPES; do
+  for variant in $VARIANTS; do
+    options=""
+    case "$variant" in
+      extension|stock) ;;
+      nosupport) options="-c pg_num2int_direct_comp.enableSupportFunctions=off" ;;
+      *) echo "unknown variant: $variant" >&2; exit 1 ;;
+    esac
+
+    for n in $PREDICATES; do
+      query="n2i_plan_query('$shape', '$variant', $n)"
+
+      # Each cold sample is a new backend
+      cold=$(i=0; while [ "$i" -lt "$RUNS" ]; do
+               PGOPTIONS="$options" "$PSQL" -X -At -c "SELECT n2i_plan_time($query)"
+               i=$((i + 1))
+             done | median)
+      warm=$(PGOPTIONS="$options" "$PSQL" -X -At -c "SELECT n2i_plan_warm($query, $RUNS)" | median)
+
+      for backend in cold warm; do
+        if [ "$backend" = cold ]; then ms=$cold; else ms=$warm; fi
+        per=$(awk -v ms="$ms" -v n="$n" 'BEGIN { printf "%.3f\n", ms * 1000 / n }')
+        echo "$shape,$variant,$n,$backend,$ms,$per" | tee -a "$RESULTS"
+      done
+    done
+  done
+done
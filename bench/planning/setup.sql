@@ -0,0 +1,82 @@
+-- Planning-latency benchmark objects for pg_num2int_direct_comp
+--
+-- Run by run.sh. The functions are regular (not temporary) objects because
+-- every cold measurement runs in a new backend.
+--
+-- n2i_plan:          int2, int4 (primary key) and int8 columns, 100,000 rows
+-- n2i_plan_query():  query text with n cross-type predicates of one shape
+-- n2i_plan_time():   planning time of a query, from EXPLAIN (SUMMARY)
+-- n2i_plan_warm():   median planning time over repeated plans in one backend
+
+\set ON_ERROR_STOP 1
+
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+DROP TABLE IF EXISTS n2i_plan;
+
+CREATE TABLE n2i_plan (
+  id    int4 PRIMARY KEY,
+  small int2 NOT NULL,
+  val   int8 NOT NULL
+);
+
+INSERT INTO n2i_plan
+SELECT g, (g % 1000)::int2, g * 7919
+FROM generate_series(1, 100000) g;
+
+CREATE INDEX n2i_plan_val_idx ON n2i_plan (val);
+
+VACUUM ANALYZE n2i_plan;
+
+-- Shapes:
+--   and_numeric  col > k.5 ANDed over id, small and val
+--   and_float8   col > k.5::float8 ANDed over id, small and val
+--   or_numeric   id = k.0 ORed
+--   in_numeric   id IN (1.0, 2.0, ...), one list of n elements
+-- The stock variant writes the cast form stock PostgreSQL needs
+-- (col::numeric > k.5), so it measures planning without the extension's
+-- operators.
+CREATE OR REPLACE FUNCTION n2i_plan_query(shape text, variant text, n int)
+RETURNS text
+LANGUAGE sql AS $$
+  SELECT 'SELECT count(*) FROM n2i_plan WHERE ' ||
+         CASE WHEN shape = 'in_numeric' THEN
+           CASE WHEN variant = 'stock' THEN 'id::numeric' ELSE 'id' END ||
+           ' IN (' || string_agg(val || '::' || typ, ', ') || ')'
+         ELSE
+           string_agg(CASE WHEN variant = 'stock' THEN col || '::' || typ ELSE col END ||
+                      CASE WHEN shape = 'or_numeric' THEN ' = ' ELSE ' > ' END ||
+                      val || '::' || typ,
+                      CASE WHEN shape = 'or_numeric' THEN ' OR ' ELSE ' AND ' END)
+         END
+  FROM (SELECT CASE WHEN shape IN ('or_numeric', 'in_numeric') THEN 'id'
+                    ELSE (ARRAY['id', 'small', 'val'])[i % 3 + 1] END AS col,
+               CASE WHEN shape = 'and_float8' THEN 'float8' ELSE 'numeric' END AS typ,
+               CASE WHEN shape IN ('or_numeric', 'in_numeric') THEN i || '.0'
+                    ELSE (i % 1000) || '.5' END AS val
+        FROM generate_series(1, n) i) p
+$$;
+
+CREATE OR REPLACE FUNCTION n2i_plan_time(query text)
+RETURNS float8
+LANGUAGE plpgsql AS $$
+DECLARE
+  plan json;
+BEGIN
+  EXECUTE 'EXPLAIN (SUMMARY, FORMAT JSON) ' || query INTO plan;
+  RETURN (plan->0->>'Planning Time')::float8;
+END $$;
+
+-- The first plan fills the backend's caches and is not counted
+CREATE OR REPLACE FUNCTION n2i_plan_warm(query text, runs int)
+RETURNS float8
+LANGUAGE plpgsql AS $$
+DECLARE
+  times float8[] := '{}';
+BEGIN
+  PERFORM n2i_plan_time(query);
+  FOR i IN 1..runs LOOP
+    times := times || n2i_plan_time(query);
+  END LOOP;
+  RETURN (SELECT percentile_cont(0.5) WITHIN GROUP (ORDER BY t) FROM unnest(times) t);
+END $$;
@@ -0,0 +1,2137 @@
+/*
+ * Copyright (c) 2026 dataStone Inc.
+ *
+ * SPDX-License-Identifier: MIT
+ * See LICENSE file for full license text.
+ */
+
+-- pg_num2int_direct_comp--1.0.0--1.1.0.sql
+--
+-- Upgrade from 1.0.0: selectivity estimators, runtime index keys, sortsupport
+-- and in_range support procs, BRIN support, the OID map, instrumentation
+-- counters, exact conversion and array functions, and the kernel benchmark.
+-- Operators defined by 1.0.0 are altered in place, so existing indexes, views
+-- and plans that reference them stay valid.
+
+-- complain if script is sourced in psql, rather than via ALTER EXTENSION
+\echo Use "ALTER EXTENSION pg_num2int_direct_comp UPDATE TO '1.1.0'" to load this file. \quit
+
+-- Restriction selectivity estimator for all cross-type comparison operators.
+-- Estimates constant comparisons against the integer column's own statistics
+-- and falls back to eqsel/neqsel/scalar*sel otherwise.
+CREATE FUNCTION num2int_restrictsel(internal, oid, internal, integer)
+RETURNS float8
+AS 'MODULE_PATHNAME', 'num2int_restrictsel'
+LANGUAGE C STABLE STRICT PARALLEL SAFE;
+
+COMMENT ON FUNCTION num2int_restrictsel(internal, oid, internal, integer) IS
+'Restriction selectivity estimator for numeric/float and integer comparisons';
+
+-- Join selectivity estimator for the cross-type equality operators.
+-- Computes eqjoinsel's estimate but matches the MCV lists by exact integer
+-- value with a sort and merge instead of calling the operator for each pair.
+CREATE FUNCTION num2int_eqjoinsel(internal, oid, internal, int2, internal)
+RETURNS float8
+AS 'MODULE_PATHNAME', 'num2int_eqjoinsel'
+LANGUAGE C STABLE STRICT PARALLEL SAFE;
+
+COMMENT ON FUNCTION num2int_eqjoinsel(internal, oid, internal, int2, internal) IS
+'Join selectivity estimator for numeric/float and integer equality';
+
+-- ============================================================================
+-- Selectivity Estimators on the Comparison Operators
+-- ============================================================================
+ALTER OPERATOR = (numeric, int2) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (numeric, int4) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (numeric, int8) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (float4, int2) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (float4, int4) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (float4, int8) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (float8, int2) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (float8, int4) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (float8, int8) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR <> (numeric, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (numeric, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (numeric, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (float4, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (float4, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (float4, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (float8, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (float8, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (float8, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR = (int2, numeric) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (int2, float4) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (int2, float8) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (int4, numeric) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (int4, float4) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (int4, float8) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (int8, numeric) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (int8, float4) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR = (int8, float8) SET (RESTRICT = num2int_restrictsel, JOIN = num2int_eqjoinsel);
+ALTER OPERATOR <> (int2, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (int2, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (int2, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (int4, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (int4, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (int4, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (int8, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (int8, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <> (int8, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (numeric, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (numeric, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (numeric, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (float4, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (float4, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (float4, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (float8, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (float8, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (float8, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (numeric, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (numeric, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (numeric, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (float4, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (float4, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (float4, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (float8, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (float8, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (float8, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (numeric, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (numeric, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (numeric, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (float4, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (float4, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (float4, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (float8, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (float8, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (float8, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (numeric, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (numeric, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (numeric, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (float4, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (float4, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (float4, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (float8, int2) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (float8, int4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (float8, int8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (int2, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (int2, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (int2, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (int4, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (int4, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (int4, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (int8, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (int8, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR < (int8, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (int2, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (int2, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (int2, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (int4, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (int4, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (int4, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (int8, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (int8, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR > (int8, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (int2, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (int2, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (int2, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (int4, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (int4, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (int4, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (int8, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (int8, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR <= (int8, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (int2, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (int2, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (int2, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (int4, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (int4, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (int4, float8) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (int8, numeric) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (int8, float4) SET (RESTRICT = num2int_restrictsel);
+ALTER OPERATOR >= (int8, float8) SET (RESTRICT = num2int_restrictsel);
+
+-- MERGES for the int x float commutator equalities whose partners were
+-- already merge-joinable. ALTER OPERATOR ... SET (MERGES) only exists from
+-- PostgreSQL 17; older servers have no command for it, so there the flag is
+-- set in the catalog directly. Turning the flag on cannot make an existing
+-- plan wrong; each session uses it the next time it plans a join.
+DO $merges$
+BEGIN
+  IF current_setting('server_version_num')::int >= 170000 THEN
+    EXECUTE 'ALTER OPERATOR = (int2, float4) SET (MERGES)';
+    EXECUTE 'ALTER OPERATOR = (int2, float8) SET (MERGES)';
+    EXECUTE 'ALTER OPERATOR = (int4, float8) SET (MERGES)';
+  ELSE
+    UPDATE pg_catalog.pg_operator SET oprcanmerge = true
+    WHERE oid IN (
+      '=(int2,float4)'::regoperator,
+      '=(int2,float8)'::regoperator,
+      '=(int4,float8)'::regoperator
+    );
+  END IF;
+END
+$merges$;
+
+-- Btree sortsupport functions (support proc 2)
+-- Merge joins call these once per merge clause to install a direct
+-- comparator for the (lefttype, righttype) pair, bypassing fmgr on every
+-- comparison of the join inputs. Each wraps the matching comparison
+-- function above.
+
+CREATE FUNCTION numeric_cmp_int2_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'numeric_cmp_int2_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION numeric_cmp_int4_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'numeric_cmp_int4_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION numeric_cmp_int8_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'numeric_cmp_int8_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION int2_cmp_numeric_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'int2_cmp_numeric_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION int4_cmp_numeric_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'int4_cmp_numeric_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION int8_cmp_numeric_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'int8_cmp_numeric_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_cmp_int2_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'float4_cmp_int2_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_cmp_int4_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'float4_cmp_int4_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_cmp_int8_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'float4_cmp_int8_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_cmp_int2_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'float8_cmp_int2_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_cmp_int4_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'float8_cmp_int4_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_cmp_int8_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'float8_cmp_int8_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION int2_cmp_float4_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'int2_cmp_float4_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION int4_cmp_float4_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'int4_cmp_float4_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION int8_cmp_float4_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'int8_cmp_float4_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION int2_cmp_float8_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'int2_cmp_float8_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION int4_cmp_float8_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'int4_cmp_float8_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION int8_cmp_float8_sortsupport(internal)
+RETURNS void
+AS 'MODULE_PATHNAME', 'int8_cmp_float8_sortsupport'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+-- ============================================================================
+-- Runtime Index Key Functions
+-- ============================================================================
+-- The support function rewrites comparisons against values that are only
+-- known at execution time (parameters of generic plans, stable expressions)
+-- into native integer comparisons against one of these functions, e.g.
+--   int4_col > $1::numeric   →   int4_col >= numeric_lower_key_int4($1, false)
+-- The key is computed once per index scan. NULL means no integer can match.
+--
+--   <inexact>_eq_key_<int>(x)               integer equal to x
+--   <inexact>_lower_key_<int>(x, inclusive) smallest integer >= x (> x if not inclusive)
+--   <inexact>_upper_key_<int>(x, inclusive) largest integer <= x (< x if not inclusive)
+
+-- Numeric keys
+CREATE FUNCTION numeric_eq_key_int2(numeric)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'numeric_eq_key_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION numeric_eq_key_int4(numeric)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'numeric_eq_key_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION numeric_eq_key_int8(numeric)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'numeric_eq_key_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION numeric_lower_key_int2(numeric, boolean)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'numeric_lower_key_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION numeric_lower_key_int4(numeric, boolean)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'numeric_lower_key_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION numeric_lower_key_int8(numeric, boolean)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'numeric_lower_key_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION numeric_upper_key_int2(numeric, boolean)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'numeric_upper_key_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION numeric_upper_key_int4(numeric, boolean)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'numeric_upper_key_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION numeric_upper_key_int8(numeric, boolean)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'numeric_upper_key_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+-- Float4 keys
+CREATE FUNCTION float4_eq_key_int2(float4)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'float4_eq_key_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_eq_key_int4(float4)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'float4_eq_key_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_eq_key_int8(float4)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'float4_eq_key_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_lower_key_int2(float4, boolean)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'float4_lower_key_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_lower_key_int4(float4, boolean)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'float4_lower_key_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_lower_key_int8(float4, boolean)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'float4_lower_key_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_upper_key_int2(float4, boolean)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'float4_upper_key_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_upper_key_int4(float4, boolean)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'float4_upper_key_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float4_upper_key_int8(float4, boolean)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'float4_upper_key_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+-- Float8 keys
+CREATE FUNCTION float8_eq_key_int2(float8)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'float8_eq_key_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_eq_key_int4(float8)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'float8_eq_key_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_eq_key_int8(float8)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'float8_eq_key_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_lower_key_int2(float8, boolean)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'float8_lower_key_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_lower_key_int4(float8, boolean)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'float8_lower_key_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_lower_key_int8(float8, boolean)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'float8_lower_key_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_upper_key_int2(float8, boolean)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'float8_upper_key_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_upper_key_int4(float8, boolean)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'float8_upper_key_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION float8_upper_key_int8(float8, boolean)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'float8_upper_key_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+-- Register the sortsupport functions as support proc 2 of each cross-type pair
+ALTER OPERATOR FAMILY numeric_ops USING btree ADD
+  FUNCTION 2 (numeric, int2) numeric_cmp_int2_sortsupport(internal),
+  FUNCTION 2 (numeric, int4) numeric_cmp_int4_sortsupport(internal),
+  FUNCTION 2 (numeric, int8) numeric_cmp_int8_sortsupport(internal),
+  FUNCTION 2 (int2, numeric) int2_cmp_numeric_sortsupport(internal),
+  FUNCTION 2 (int4, numeric) int4_cmp_numeric_sortsupport(internal),
+  FUNCTION 2 (int8, numeric) int8_cmp_numeric_sortsupport(internal);
+
+ALTER OPERATOR FAMILY integer_ops USING btree ADD
+  FUNCTION 2 (numeric, int2) numeric_cmp_int2_sortsupport(internal),
+  FUNCTION 2 (numeric, int4) numeric_cmp_int4_sortsupport(internal),
+  FUNCTION 2 (numeric, int8) numeric_cmp_int8_sortsupport(internal),
+  FUNCTION 2 (int2, numeric) int2_cmp_numeric_sortsupport(internal),
+  FUNCTION 2 (int4, numeric) int4_cmp_numeric_sortsupport(internal),
+  FUNCTION 2 (int8, numeric) int8_cmp_numeric_sortsupport(internal);
+
+ALTER OPERATOR FAMILY float_ops USING btree ADD
+  FUNCTION 2 (float4, int2) float4_cmp_int2_sortsupport(internal),
+  FUNCTION 2 (float4, int4) float4_cmp_int4_sortsupport(internal),
+  FUNCTION 2 (float4, int8) float4_cmp_int8_sortsupport(internal),
+  FUNCTION 2 (int2, float4) int2_cmp_float4_sortsupport(internal),
+  FUNCTION 2 (int4, float4) int4_cmp_float4_sortsupport(internal),
+  FUNCTION 2 (int8, float4) int8_cmp_float4_sortsupport(internal),
+  FUNCTION 2 (float8, int2) float8_cmp_int2_sortsupport(internal),
+  FUNCTION 2 (float8, int4) float8_cmp_int4_sortsupport(internal),
+  FUNCTION 2 (float8, int8) float8_cmp_int8_sortsupport(internal),
+  FUNCTION 2 (int2, float8) int2_cmp_float8_sortsupport(internal),
+  FUNCTION 2 (int4, float8) int4_cmp_float8_sortsupport(internal),
+  FUNCTION 2 (int8, float8) int8_cmp_float8_sortsupport(internal);
+
+ALTER OPERATOR FAMILY integer_ops USING btree ADD
+  FUNCTION 2 (float4, int2) float4_cmp_int2_sortsupport(internal),
+  FUNCTION 2 (float4, int4) float4_cmp_int4_sortsupport(internal),
+  FUNCTION 2 (float4, int8) float4_cmp_int8_sortsupport(internal),
+  FUNCTION 2 (int2, float4) int2_cmp_float4_sortsupport(internal),
+  FUNCTION 2 (int4, float4) int4_cmp_float4_sortsupport(internal),
+  FUNCTION 2 (int8, float4) int8_cmp_float4_sortsupport(internal),
+  FUNCTION 2 (float8, int2) float8_cmp_int2_sortsupport(internal),
+  FUNCTION 2 (float8, int4) float8_cmp_int4_sortsupport(internal),
+  FUNCTION 2 (float8, int8) float8_cmp_int8_sortsupport(internal),
+  FUNCTION 2 (int2, float8) int2_cmp_float8_sortsupport(internal),
+  FUNCTION 2 (int4, float8) int4_cmp_float8_sortsupport(internal),
+  FUNCTION 2 (int8, float8) int8_cmp_float8_sortsupport(internal);
+
+-- ============================================================================
+-- Btree in_range Support (RANGE Window Frames)
+-- ============================================================================
+-- RANGE BETWEEN <offset> PRECEDING / FOLLOWING over an integer sort column
+-- looks up support proc 3 (in_range) for (column type, offset type) in the
+-- btree family of the column's ordering operator. These functions accept
+-- numeric and float offsets, so
+--   SUM(x) OVER (ORDER BY int_col RANGE BETWEEN 2.5 PRECEDING AND CURRENT ROW)
+-- needs no cast of the sort column. The bound base +/- offset is moved onto
+-- the integer grid exactly (int_col >= base - 2.5 is int_col >= base - 2).
+--
+-- The ordering family PostgreSQL picks for a type is the first btree family
+-- that holds its "<" operator. Because this extension adds the integer
+-- operators to numeric_ops and float_ops, and the numeric and float operators
+-- to integer_ops, every one of those families is given the same in_range
+-- procs: the functions below plus the built-in in_range functions of the
+-- types it now orders. RANGE frames then resolve identically whichever
+-- family is picked.
+
+CREATE FUNCTION in_range_int2_numeric(int2, int2, numeric, boolean, boolean)
+RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_int2_numeric'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION in_range_int2_float4(int2, int2, float4, boolean, boolean)
+RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_int2_float4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION in_range_int2_float8(int2, int2, float8, boolean, boolean)
+RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_int2_float8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION in_range_int4_numeric(int4, int4, numeric, boolean, boolean)
+RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_int4_numeric'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION in_range_int4_float4(int4, int4, float4, boolean, boolean)
+RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_int4_float4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION in_range_int4_float8(int4, int4, float8, boolean, boolean)
+RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_int4_float8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION in_range_int8_numeric(int8, int8, numeric, boolean, boolean)
+RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_int8_numeric'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION in_range_int8_float4(int8, int8, float4, boolean, boolean)
+RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_int8_float4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION in_range_int8_float8(int8, int8, float8, boolean, boolean)
+RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_int8_float8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+-- integer_ops: integer columns with numeric and float offsets, and the
+-- built-in in_range of the numeric and float types added to the family
+ALTER OPERATOR FAMILY integer_ops USING btree ADD
+  FUNCTION 3 (int2, numeric) in_range_int2_numeric(int2, int2, numeric, boolean, boolean),
+  FUNCTION 3 (int2, float4) in_range_int2_float4(int2, int2, float4, boolean, boolean),
+  FUNCTION 3 (int2, float8) in_range_int2_float8(int2, int2, float8, boolean, boolean),
+  FUNCTION 3 (int4, numeric) in_range_int4_numeric(int4, int4, numeric, boolean, boolean),
+  FUNCTION 3 (int4, float4) in_range_int4_float4(int4, int4, float4, boolean, boolean),
+  FUNCTION 3 (int4, float8) in_range_int4_float8(int4, int4, float8, boolean, boolean),
+  FUNCTION 3 (int8, numeric) in_range_int8_numeric(int8, int8, numeric, boolean, boolean),
+  FUNCTION 3 (int8, float4) in_range_int8_float4(int8, int8, float4, boolean, boolean),
+  FUNCTION 3 (int8, float8) in_range_int8_float8(int8, int8, float8, boolean, boolean),
+  FUNCTION 3 (numeric, numeric) in_range(numeric, numeric, numeric, boolean, boolean),
+  FUNCTION 3 (float8, float8) in_range(float8, float8, float8, boolean, boolean),
+  FUNCTION 3 (float4, float8) in_range(float4, float4, float8, boolean, boolean);
+
+-- numeric_ops and float_ops: the same procs for the integer types they order
+ALTER OPERATOR FAMILY numeric_ops USING btree ADD
+  FUNCTION 3 (int2, int8) in_range(int2, int2, int8, boolean, boolean),
+  FUNCTION 3 (int2, int4) in_range(int2, int2, int4, boolean, boolean),
+  FUNCTION 3 (int2, int2) in_range(int2, int2, int2, boolean, boolean),
+  FUNCTION 3 (int4, int8) in_range(int4, int4, int8, boolean, boolean),
+  FUNCTION 3 (int4, int4) in_range(int4, int4, int4, boolean, boolean),
+  FUNCTION 3 (int4, int2) in_range(int4, int4, int2, boolean, boolean),
+  FUNCTION 3 (int8, int8) in_range(int8, int8, int8, boolean, boolean),
+  FUNCTION 3 (int2, numeric) in_range_int2_numeric(int2, int2, numeric, boolean, boolean),
+  FUNCTION 3 (int2, float4) in_range_int2_float4(int2, int2, float4, boolean, boolean),
+  FUNCTION 3 (int2, float8) in_range_int2_float8(int2, int2, float8, boolean, boolean),
+  FUNCTION 3 (int4, numeric) in_range_int4_numeric(int4, int4, numeric, boolean, boolean),
+  FUNCTION 3 (int4, float4) in_range_int4_float4(int4, int4, float4, boolean, boolean),
+  FUNCTION 3 (int4, float8) in_range_int4_float8(int4, int4, float8, boolean, boolean),
+  FUNCTION 3 (int8, numeric) in_range_int8_numeric(int8, int8, numeric, boolean, boolean),
+  FUNCTION 3 (int8, float4) in_range_int8_float4(int8, int8, float4, boolean, boolean),
+  FUNCTION 3 (int8, float8) in_range_int8_float8(int8, int8, float8, boolean, boolean);
+
+ALTER OPERATOR FAMILY float_ops USING btree ADD
+  FUNCTION 3 (int2, int8) in_range(int2, int2, int8, boolean, boolean),
+  FUNCTION 3 (int2, int4) in_range(int2, int2, int4, boolean, boolean),
+  FUNCTION 3 (int2, int2) in_range(int2, int2, int2, boolean, boolean),
+  FUNCTION 3 (int4, int8) in_range(int4, int4, int8, boolean, boolean),
+  FUNCTION 3 (int4, int4) in_range(int4, int4, int4, boolean, boolean),
+  FUNCTION 3 (int4, int2) in_range(int4, int4, int2, boolean, boolean),
+  FUNCTION 3 (int8, int8) in_range(int8, int8, int8, boolean, boolean),
+  FUNCTION 3 (int2, numeric) in_range_int2_numeric(int2, int2, numeric, boolean, boolean),
+  FUNCTION 3 (int2, float4) in_range_int2_float4(int2, int2, float4, boolean, boolean),
+  FUNCTION 3 (int2, float8) in_range_int2_float8(int2, int2, float8, boolean, boolean),
+  FUNCTION 3 (int4, numeric) in_range_int4_numeric(int4, int4, numeric, boolean, boolean),
+  FUNCTION 3 (int4, float4) in_range_int4_float4(int4, int4, float4, boolean, boolean),
+  FUNCTION 3 (int4, float8) in_range_int4_float8(int4, int4, float8, boolean, boolean),
+  FUNCTION 3 (int8, numeric) in_range_int8_numeric(int8, int8, numeric, boolean, boolean),
+  FUNCTION 3 (int8, float4) in_range_int8_float4(int8, int8, float4, boolean, boolean),
+  FUNCTION 3 (int8, float8) in_range_int8_float8(int8, int8, float8, boolean, boolean);
+
+-- ============================================================================
+-- BRIN Operator Family Support (Block Range Pruning)
+-- ============================================================================
+--
+-- BRIN minmax and minmax-multi scans look up the operator for each scan key by
+-- (indexed type, comparand type, strategy) in the index's operator family, so
+-- registering the cross-type operators lets a numeric or float bound prune
+-- block ranges of an integer BRIN index (and an integer bound those of a
+-- numeric or float index) when the clause is not simplified to a native
+-- comparison: join keys, and every clause while enableSupportFunctions is
+-- off. Only the column-type-on-the-left direction is needed; the planner
+-- commutes the other.
+--
+-- BRIN families need no cross-type support functions: the opclass functions
+-- of the indexed type build the summaries, and the operators only compare a
+-- summary value with the comparand.
+--
+-- The minmax-multi families exist from PostgreSQL 14 and receive the same
+-- operators in the DO block below.
+--
+-- NOTE: These entries do not create extension dependencies, so DROP EXTENSION
+-- won't automatically remove them. Cleanup is handled by the
+-- pg_num2int_direct_comp_cleanup() event trigger, updated below.
+-- ============================================================================
+
+-- Cross-type comparisons for integer_minmax_ops
+ALTER OPERATOR FAMILY integer_minmax_ops USING brin ADD
+  -- int2 column, numeric comparand
+  OPERATOR 1 < (int2, numeric),
+  OPERATOR 2 <= (int2, numeric),
+  OPERATOR 3 = (int2, numeric),
+  OPERATOR 4 >= (int2, numeric),
+  OPERATOR 5 > (int2, numeric),
+
+  -- int2 column, float4 comparand
+  OPERATOR 1 < (int2, float4),
+  OPERATOR 2 <= (int2, float4),
+  OPERATOR 3 = (int2, float4),
+  OPERATOR 4 >= (int2, float4),
+  OPERATOR 5 > (int2, float4),
+
+  -- int2 column, float8 comparand
+  OPERATOR 1 < (int2, float8),
+  OPERATOR 2 <= (int2, float8),
+  OPERATOR 3 = (int2, float8),
+  OPERATOR 4 >= (int2, float8),
+  OPERATOR 5 > (int2, float8),
+
+  -- int4 column, numeric comparand
+  OPERATOR 1 < (int4, numeric),
+  OPERATOR 2 <= (int4, numeric),
+  OPERATOR 3 = (int4, numeric),
+  OPERATOR 4 >= (int4, numeric),
+  OPERATOR 5 > (int4, numeric),
+
+  -- int4 column, float4 comparand
+  OPERATOR 1 < (int4, float4),
+  OPERATOR 2 <= (int4, float4),
+  OPERATOR 3 = (int4, float4),
+  OPERATOR 4 >= (int4, float4),
+  OPERATOR 5 > (int4, float4),
+
+  -- int4 column, float8 comparand
+  OPERATOR 1 < (int4, float8),
+  OPERATOR 2 <= (int4, float8),
+  OPERATOR 3 = (int4, float8),
+  OPERATOR 4 >= (int4, float8),
+  OPERATOR 5 > (int4, float8),
+
+  -- int8 column, numeric comparand
+  OPERATOR 1 < (int8, numeric),
+  OPERATOR 2 <= (int8, numeric),
+  OPERATOR 3 = (int8, numeric),
+  OPERATOR 4 >= (int8, numeric),
+  OPERATOR 5 > (int8, numeric),
+
+  -- int8 column, float4 comparand
+  OPERATOR 1 < (int8, float4),
+  OPERATOR 2 <= (int8, float4),
+  OPERATOR 3 = (int8, float4),
+  OPERATOR 4 >= (int8, float4),
+  OPERATOR 5 > (int8, float4),
+
+  -- int8 column, float8 comparand
+  OPERATOR 1 < (int8, float8),
+  OPERATOR 2 <= (int8, float8),
+  OPERATOR 3 = (int8, float8),
+  OPERATOR 4 >= (int8, float8),
+  OPERATOR 5 > (int8, float8);
+
+-- Cross-type comparisons for numeric_minmax_ops
+ALTER OPERATOR FAMILY numeric_minmax_ops USING brin ADD
+  -- numeric column, int2 comparand
+  OPERATOR 1 < (numeric, int2),
+  OPERATOR 2 <= (numeric, int2),
+  OPERATOR 3 = (numeric, int2),
+  OPERATOR 4 >= (numeric, int2),
+  OPERATOR 5 > (numeric, int2),
+
+  -- numeric column, int4 comparand
+  OPERATOR 1 < (numeric, int4),
+  OPERATOR 2 <= (numeric, int4),
+  OPERATOR 3 = (numeric, int4),
+  OPERATOR 4 >= (numeric, int4),
+  OPERATOR 5 > (numeric, int4),
+
+  -- numeric column, int8 comparand
+  OPERATOR 1 < (numeric, int8),
+  OPERATOR 2 <= (numeric, int8),
+  OPERATOR 3 = (numeric, int8),
+  OPERATOR 4 >= (numeric, int8),
+  OPERATOR 5 > (numeric, int8);
+
+-- Cross-type comparisons for float_minmax_ops
+ALTER OPERATOR FAMILY float_minmax_ops USING brin ADD
+  -- float4 column, int2 comparand
+  OPERATOR 1 < (float4, int2),
+  OPERATOR 2 <= (float4, int2),
+  OPERATOR 3 = (float4, int2),
+  OPERATOR 4 >= (float4, int2),
+  OPERATOR 5 > (float4, int2),
+
+  -- float4 column, int4 comparand
+  OPERATOR 1 < (float4, int4),
+  OPERATOR 2 <= (float4, int4),
+  OPERATOR 3 = (float4, int4),
+  OPERATOR 4 >= (float4, int4),
+  OPERATOR 5 > (float4, int4),
+
+  -- float4 column, int8 comparand
+  OPERATOR 1 < (float4, int8),
+  OPERATOR 2 <= (float4, int8),
+  OPERATOR 3 = (float4, int8),
+  OPERATOR 4 >= (float4, int8),
+  OPERATOR 5 > (float4, int8),
+
+  -- float8 column, int2 comparand
+  OPERATOR 1 < (float8, int2),
+  OPERATOR 2 <= (float8, int2),
+  OPERATOR 3 = (float8, int2),
+  OPERATOR 4 >= (float8, int2),
+  OPERATOR 5 > (float8, int2),
+
+  -- float8 column, int4 comparand
+  OPERATOR 1 < (float8, int4),
+  OPERATOR 2 <= (float8, int4),
+  OPERATOR 3 = (float8, int4),
+  OPERATOR 4 >= (float8, int4),
+  OPERATOR 5 > (float8, int4),
+
+  -- float8 column, int8 comparand
+  OPERATOR 1 < (float8, int8),
+  OPERATOR 2 <= (float8, int8),
+  OPERATOR 3 = (float8, int8),
+  OPERATOR 4 >= (float8, int8),
+  OPERATOR 5 > (float8, int8);
+
+-- Same operators for the minmax-multi families (PostgreSQL 14+)
+DO $brin$
+BEGIN
+  IF current_setting('server_version_num')::int < 140000 THEN
+    RETURN;
+  END IF;
+
+  EXECUTE $sql$
+    ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin ADD
+      -- int2 column, numeric comparand
+      OPERATOR 1 < (int2, numeric),
+      OPERATOR 2 <= (int2, numeric),
+      OPERATOR 3 = (int2, numeric),
+      OPERATOR 4 >= (int2, numeric),
+      OPERATOR 5 > (int2, numeric),
+
+      -- int2 column, float4 comparand
+      OPERATOR 1 < (int2, float4),
+      OPERATOR 2 <= (int2, float4),
+      OPERATOR 3 = (int2, float4),
+      OPERATOR 4 >= (int2, float4),
+      OPERATOR 5 > (int2, float4),
+
+      -- int2 column, float8 comparand
+      OPERATOR 1 < (int2, float8),
+      OPERATOR 2 <= (int2, float8),
+      OPERATOR 3 = (int2, float8),
+      OPERATOR 4 >= (int2, float8),
+      OPERATOR 5 > (int2, float8),
+
+      -- int4 column, numeric comparand
+      OPERATOR 1 < (int4, numeric),
+      OPERATOR 2 <= (int4, numeric),
+      OPERATOR 3 = (int4, numeric),
+      OPERATOR 4 >= (int4, numeric),
+      OPERATOR 5 > (int4, numeric),
+
+      -- int4 column, float4 comparand
+      OPERATOR 1 < (int4, float4),
+      OPERATOR 2 <= (int4, float4),
+      OPERATOR 3 = (int4, float4),
+      OPERATOR 4 >= (int4, float4),
+      OPERATOR 5 > (int4, float4),
+
+      -- int4 column, float8 comparand
+      OPERATOR 1 < (int4, float8),
+      OPERATOR 2 <= (int4, float8),
+      OPERATOR 3 = (int4, float8),
+      OPERATOR 4 >= (int4, float8),
+      OPERATOR 5 > (int4, float8),
+
+      -- int8 column, numeric comparand
+      OPERATOR 1 < (int8, numeric),
+      OPERATOR 2 <= (int8, numeric),
+      OPERATOR 3 = (int8, numeric),
+      OPERATOR 4 >= (int8, numeric),
+      OPERATOR 5 > (int8, numeric),
+
+      -- int8 column, float4 comparand
+      OPERATOR 1 < (int8, float4),
+      OPERATOR 2 <= (int8, float4),
+      OPERATOR 3 = (int8, float4),
+      OPERATOR 4 >= (int8, float4),
+      OPERATOR 5 > (int8, float4),
+
+      -- int8 column, float8 comparand
+      OPERATOR 1 < (int8, float8),
+      OPERATOR 2 <= (int8, float8),
+      OPERATOR 3 = (int8, float8),
+      OPERATOR 4 >= (int8, float8),
+      OPERATOR 5 > (int8, float8)
+  $sql$;
+
+  EXECUTE $sql$
+    ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin ADD
+      -- numeric column, int2 comparand
+      OPERATOR 1 < (numeric, int2),
+      OPERATOR 2 <= (numeric, int2),
+      OPERATOR 3 = (numeric, int2),
+      OPERATOR 4 >= (numeric, int2),
+      OPERATOR 5 > (numeric, int2),
+
+      -- numeric column, int4 comparand
+      OPERATOR 1 < (numeric, int4),
+      OPERATOR 2 <= (numeric, int4),
+      OPERATOR 3 = (numeric, int4),
+      OPERATOR 4 >= (numeric, int4),
+      OPERATOR 5 > (numeric, int4),
+
+      -- numeric column, int8 comparand
+      OPERATOR 1 < (numeric, int8),
+      OPERATOR 2 <= (numeric, int8),
+      OPERATOR 3 = (numeric, int8),
+      OPERATOR 4 >= (numeric, int8),
+      OPERATOR 5 > (numeric, int8)
+  $sql$;
+
+  EXECUTE $sql$
+    ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin ADD
+      -- float4 column, int2 comparand
+      OPERATOR 1 < (float4, int2),
+      OPERATOR 2 <= (float4, int2),
+      OPERATOR 3 = (float4, int2),
+      OPERATOR 4 >= (float4, int2),
+      OPERATOR 5 > (float4, int2),
+
+      -- float4 column, int4 comparand
+      OPERATOR 1 < (float4, int4),
+      OPERATOR 2 <= (float4, int4),
+      OPERATOR 3 = (float4, int4),
+      OPERATOR 4 >= (float4, int4),
+      OPERATOR 5 > (float4, int4),
+
+      -- float4 column, int8 comparand
+      OPERATOR 1 < (float4, int8),
+      OPERATOR 2 <= (float4, int8),
+      OPERATOR 3 = (float4, int8),
+      OPERATOR 4 >= (float4, int8),
+      OPERATOR 5 > (float4, int8),
+
+      -- float8 column, int2 comparand
+      OPERATOR 1 < (float8, int2),
+      OPERATOR 2 <= (float8, int2),
+      OPERATOR 3 = (float8, int2),
+      OPERATOR 4 >= (float8, int2),
+      OPERATOR 5 > (float8, int2),
+
+      -- float8 column, int4 comparand
+      OPERATOR 1 < (float8, int4),
+      OPERATOR 2 <= (float8, int4),
+      OPERATOR 3 = (float8, int4),
+      OPERATOR 4 >= (float8, int4),
+      OPERATOR 5 > (float8, int4),
+
+      -- float8 column, int8 comparand
+      OPERATOR 1 < (float8, int8),
+      OPERATOR 2 <= (float8, int8),
+      OPERATOR 3 = (float8, int8),
+      OPERATOR 4 >= (float8, int8),
+      OPERATOR 5 > (float8, int8)
+  $sql$;
+END
+$brin$;
+
+-- ============================================================================
+-- OID Map
+-- ============================================================================
+--
+-- Records the OIDs of the extension's operators and runtime key functions so
+-- that a new backend fills its operator cache with a single scan of this table
+-- instead of resolving every operator and key function by name. The C code
+-- checks each operator row against pg_operator and falls back to name lookups
+-- for anything that does not match (for example after pg_upgrade, which does
+-- not preserve operator OIDs) until the map is refreshed with
+-- pg_num2int_direct_comp_refresh_oid_map(). Being an extension member, the
+-- table is recreated, and refilled, by every CREATE EXTENSION.
+-- ============================================================================
+
+CREATE TABLE num2int_oid_map (
+  name text NOT NULL,    -- operator name or function name
+  lefttype oid NOT NULL, -- left operand type (first argument type)
+  righttype oid NOT NULL, -- right operand type (0 for functions)
+  objid oid NOT NULL,    -- operator or function OID
+  funcid oid NOT NULL    -- implementing function OID
+);
+
+-- Refills the map from the catalog. The install and upgrade scripts fill it
+-- through this function; after pg_upgrade, which gives the operators new OIDs
+-- but copies the table as it was, run it once in each database that has the
+-- extension. The schema is looked up because the extension is relocatable.
+CREATE FUNCTION pg_num2int_direct_comp_refresh_oid_map()
+RETURNS int8
+LANGUAGE plpgsql VOLATILE
+SET search_path = pg_catalog, pg_temp
+AS $func$
+DECLARE
+    map text;
+    nrows int8;
+BEGIN
+    SELECT format('%I.num2int_oid_map', n.nspname) INTO STRICT map
+    FROM pg_extension e JOIN pg_namespace n ON n.oid = e.extnamespace
+    WHERE e.extname = 'pg_num2int_direct_comp';
+
+    EXECUTE format('DELETE FROM %s', map);
+    EXECUTE format($sql$
+        INSERT INTO %s (name, lefttype, righttype, objid, funcid)
+        SELECT o.oprname::text, o.oprleft, o.oprright, o.oid, o.oprcode::oid
+        FROM pg_operator o
+        JOIN pg_depend d ON d.classid = 'pg_operator'::regclass
+                        AND d.objid = o.oid
+        JOIN pg_extension e ON d.refclassid = 'pg_extension'::regclass
+                           AND d.refobjid = e.oid AND d.deptype = 'e'
+        WHERE e.extname = 'pg_num2int_direct_comp'
+        UNION ALL
+        SELECT p.proname::text, p.proargtypes[0], 0::oid, p.oid, p.oid
+        FROM pg_proc p
+        JOIN pg_depend d ON d.classid = 'pg_proc'::regclass AND d.objid = p.oid
+        JOIN pg_extension e ON d.refclassid = 'pg_extension'::regclass
+                           AND d.refobjid = e.oid AND d.deptype = 'e'
+        WHERE e.extname = 'pg_num2int_direct_comp'
+          AND p.proname ~ '^(numeric|float4|float8)_(eq|lower|upper)_key_int[248]$'
+    $sql$, map);
+    GET DIAGNOSTICS nrows = ROW_COUNT;
+    RETURN nrows;
+END
+$func$;
+
+-- Writes to an extension table: for the owner and administrators
+REVOKE ALL ON FUNCTION pg_num2int_direct_comp_refresh_oid_map() FROM PUBLIC;
+
+COMMENT ON FUNCTION pg_num2int_direct_comp_refresh_oid_map() IS
+'Rebuild the OID map from the catalog (run after pg_upgrade); returns the number of rows';
+
+SELECT pg_num2int_direct_comp_refresh_oid_map();
+
+GRANT SELECT ON num2int_oid_map TO PUBLIC;
+
+COMMENT ON TABLE num2int_oid_map IS
+'OIDs of the extension''s operators and key functions, read by each backend at first use';
+
+-- ============================================================================
+-- Instrumentation Counters
+-- ============================================================================
+-- Outcomes of the plan-time simplification (rewritten, folded, or why it was
+-- left alone) and slow-path numeric comparisons. backend_count covers the
+-- current session; shared_count is the server-wide total and is NULL unless
+-- the library is listed in shared_preload_libraries.
+
+CREATE FUNCTION pg_num2int_direct_comp_stats(
+    OUT counter text, OUT backend_count int8, OUT shared_count int8)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME', 'num2int_stats'
+LANGUAGE C VOLATILE STRICT PARALLEL RESTRICTED;
+
+COMMENT ON FUNCTION pg_num2int_direct_comp_stats() IS
+'Simplifier outcome and slow-path comparison counters, per backend and server-wide';
+
+CREATE VIEW pg_num2int_direct_comp_stats AS
+SELECT * FROM pg_num2int_direct_comp_stats();
+
+GRANT SELECT ON pg_num2int_direct_comp_stats TO PUBLIC;
+
+CREATE FUNCTION pg_num2int_direct_comp_stats_reset()
+RETURNS void
+AS 'MODULE_PATHNAME', 'num2int_stats_reset'
+LANGUAGE C VOLATILE STRICT PARALLEL RESTRICTED;
+
+-- Like pg_stat_reset(): resetting server-wide totals is for administrators
+REVOKE ALL ON FUNCTION pg_num2int_direct_comp_stats_reset() FROM PUBLIC;
+
+COMMENT ON FUNCTION pg_num2int_direct_comp_stats_reset() IS
+'Reset this backend''s counters and the server-wide totals';
+
+-- ============================================================================
+-- Exact Conversion Functions
+-- ============================================================================
+-- num2int_exact_<int>(value) converts a numeric, float4 or float8 value that
+-- is exactly an integer of the target type and raises an error otherwise,
+-- where a cast would round. num2int_exact_<int>_or_null(value) returns NULL
+-- instead. Meant for loading staged data, e.g.
+--   INSERT INTO t SELECT num2int_exact_int4(amount) FROM staging;
+-- Constant arguments fold at plan time like for any immutable function. The
+-- support functions also drop the call around an exact cast of an integer,
+-- as in num2int_exact_int4(int_col::numeric).
+
+CREATE FUNCTION num2int_exact_support(internal)
+RETURNS internal
+AS 'MODULE_PATHNAME', 'num2int_exact_support'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+COMMENT ON FUNCTION num2int_exact_support(internal) IS
+'Support function removing num2int_exact_* calls around exact integer casts';
+
+CREATE FUNCTION num2int_exact_or_null_support(internal)
+RETURNS internal
+AS 'MODULE_PATHNAME', 'num2int_exact_or_null_support'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+COMMENT ON FUNCTION num2int_exact_or_null_support(internal) IS
+'Support function removing num2int_exact_*_or_null calls around widening integer casts';
+
+-- Numeric to integer
+CREATE FUNCTION num2int_exact_int2(numeric)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'numeric_exact_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_support;
+
+CREATE FUNCTION num2int_exact_int2_or_null(numeric)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'numeric_exact_int2_or_null'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_or_null_support;
+
+CREATE FUNCTION num2int_exact_int4(numeric)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'numeric_exact_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_support;
+
+CREATE FUNCTION num2int_exact_int4_or_null(numeric)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'numeric_exact_int4_or_null'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_or_null_support;
+
+CREATE FUNCTION num2int_exact_int8(numeric)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'numeric_exact_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_support;
+
+CREATE FUNCTION num2int_exact_int8_or_null(numeric)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'numeric_exact_int8_or_null'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_or_null_support;
+
+COMMENT ON FUNCTION num2int_exact_int2(numeric) IS
+'Convert numeric to smallint, raising an error unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int2_or_null(numeric) IS
+'Convert numeric to smallint, returning NULL unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int4(numeric) IS
+'Convert numeric to integer, raising an error unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int4_or_null(numeric) IS
+'Convert numeric to integer, returning NULL unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int8(numeric) IS
+'Convert numeric to bigint, raising an error unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int8_or_null(numeric) IS
+'Convert numeric to bigint, returning NULL unless the value is exactly representable';
+
+-- Float4 to integer
+CREATE FUNCTION num2int_exact_int2(float4)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'float4_exact_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_support;
+
+CREATE FUNCTION num2int_exact_int2_or_null(float4)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'float4_exact_int2_or_null'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_or_null_support;
+
+CREATE FUNCTION num2int_exact_int4(float4)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'float4_exact_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_support;
+
+CREATE FUNCTION num2int_exact_int4_or_null(float4)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'float4_exact_int4_or_null'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_or_null_support;
+
+CREATE FUNCTION num2int_exact_int8(float4)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'float4_exact_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_support;
+
+CREATE FUNCTION num2int_exact_int8_or_null(float4)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'float4_exact_int8_or_null'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_or_null_support;
+
+COMMENT ON FUNCTION num2int_exact_int2(float4) IS
+'Convert float4 to smallint, raising an error unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int2_or_null(float4) IS
+'Convert float4 to smallint, returning NULL unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int4(float4) IS
+'Convert float4 to integer, raising an error unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int4_or_null(float4) IS
+'Convert float4 to integer, returning NULL unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int8(float4) IS
+'Convert float4 to bigint, raising an error unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int8_or_null(float4) IS
+'Convert float4 to bigint, returning NULL unless the value is exactly representable';
+
+-- Float8 to integer
+CREATE FUNCTION num2int_exact_int2(float8)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'float8_exact_int2'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_support;
+
+CREATE FUNCTION num2int_exact_int2_or_null(float8)
+RETURNS int2
+AS 'MODULE_PATHNAME', 'float8_exact_int2_or_null'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_or_null_support;
+
+CREATE FUNCTION num2int_exact_int4(float8)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'float8_exact_int4'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_support;
+
+CREATE FUNCTION num2int_exact_int4_or_null(float8)
+RETURNS int4
+AS 'MODULE_PATHNAME', 'float8_exact_int4_or_null'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_or_null_support;
+
+CREATE FUNCTION num2int_exact_int8(float8)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'float8_exact_int8'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_support;
+
+CREATE FUNCTION num2int_exact_int8_or_null(float8)
+RETURNS int8
+AS 'MODULE_PATHNAME', 'float8_exact_int8_or_null'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_exact_or_null_support;
+
+COMMENT ON FUNCTION num2int_exact_int2(float8) IS
+'Convert float8 to smallint, raising an error unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int2_or_null(float8) IS
+'Convert float8 to smallint, returning NULL unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int4(float8) IS
+'Convert float8 to integer, raising an error unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int4_or_null(float8) IS
+'Convert float8 to integer, returning NULL unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int8(float8) IS
+'Convert float8 to bigint, raising an error unless the value is exactly representable';
+
+COMMENT ON FUNCTION num2int_exact_int8_or_null(float8) IS
+'Convert float8 to bigint, returning NULL unless the value is exactly representable';
+
+-- ============================================================================
+-- Array Overlap and Containment Functions
+-- ============================================================================
+-- num2int_array_overlap(a, b), num2int_array_contains(a, b) and
+-- num2int_array_contained(a, b) are a && b, a @> b and a <@ b for an integer
+-- array and a numeric/float array, in either order. Elements are compared
+-- exactly; an inexact element equals no integer.
+--
+-- These are functions rather than &&, @> and <@ operators: the built-in
+-- operators take (anyarray, anyarray), so a concrete (int4[], numeric[])
+-- operator would be the better match for int4[] && int4[] and for
+-- int4[] && '{...}', taking those away from the built-in operator and its
+-- GIN index.
+--
+-- With a constant array on one side the support functions rewrite the call to
+-- the built-in operator over an array of the other side's element type, so a
+-- GIN index on the array column (array_ops) is used directly:
+--   num2int_array_overlap(tags, '{1.0, 2.5}'::numeric[])
+--   becomes tags && '{1}'::int4[]
+
+CREATE FUNCTION num2int_array_overlap_support(internal)
+RETURNS internal
+AS 'MODULE_PATHNAME', 'num2int_array_overlap_support'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION num2int_array_contains_support(internal)
+RETURNS internal
+AS 'MODULE_PATHNAME', 'num2int_array_contains_support'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION num2int_array_contained_support(internal)
+RETURNS internal
+AS 'MODULE_PATHNAME', 'num2int_array_contained_support'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+COMMENT ON FUNCTION num2int_array_overlap_support(internal) IS
+'Support function rewriting num2int_array_overlap with a constant array to &&';
+
+COMMENT ON FUNCTION num2int_array_contains_support(internal) IS
+'Support function rewriting num2int_array_contains with a constant array to @>';
+
+COMMENT ON FUNCTION num2int_array_contained_support(internal) IS
+'Support function rewriting num2int_array_contained with a constant array to <@';
+
+-- One C function per operation serves every type pair
+
+-- num2int_array_overlap
+CREATE FUNCTION num2int_array_overlap(int2[], numeric[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(int2[], float4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(int2[], float8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(int4[], numeric[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(int4[], float4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(int4[], float8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(int8[], numeric[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(int8[], float4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(int8[], float8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(numeric[], int2[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(float4[], int2[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(float8[], int2[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(numeric[], int4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(float4[], int4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(float8[], int4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(numeric[], int8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(float4[], int8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+CREATE FUNCTION num2int_array_overlap(float8[], int8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_overlap'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_overlap_support;
+
+-- num2int_array_contains
+CREATE FUNCTION num2int_array_contains(int2[], numeric[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(int2[], float4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(int2[], float8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(int4[], numeric[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(int4[], float4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(int4[], float8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(int8[], numeric[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(int8[], float4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(int8[], float8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(numeric[], int2[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(float4[], int2[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(float8[], int2[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(numeric[], int4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(float4[], int4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(float8[], int4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(numeric[], int8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(float4[], int8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+CREATE FUNCTION num2int_array_contains(float8[], int8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contains'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contains_support;
+
+-- num2int_array_contained
+CREATE FUNCTION num2int_array_contained(int2[], numeric[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(int2[], float4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(int2[], float8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(int4[], numeric[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(int4[], float4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(int4[], float8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(int8[], numeric[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(int8[], float4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(int8[], float8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(numeric[], int2[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(float4[], int2[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(float8[], int2[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(numeric[], int4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(float4[], int4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(float8[], int4[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(numeric[], int8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(float4[], int8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+CREATE FUNCTION num2int_array_contained(float8[], int8[])
+RETURNS boolean
+AS 'MODULE_PATHNAME', 'num2int_array_contained'
+LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE
+SUPPORT num2int_array_contained_support;
+
+-- ============================================================================
+-- Kernel Microbenchmark
+-- ============================================================================
+-- Times the internal comparison and hash kernels without executor or fmgr
+-- overhead, and (the *_call kernels) operator calls through fmgr against the
+-- native int8lt. Run through `make bench`; see doc/benchmark.md.
+
+CREATE FUNCTION num2int_bench(kernel text, iterations int8,
+                              OUT kernel_name text, OUT distribution text,
+                              OUT calls int8, OUT ns_per_op float8,
+                              OUT cycles_per_op float8)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME', 'num2int_bench'
+LANGUAGE C VOLATILE STRICT;
+
+COMMENT ON FUNCTION num2int_bench(text, int8) IS
+'Microbenchmark of the comparison and hash kernels: ns and TSC cycles per call';
+
+-- ============================================================================
+-- Extension Cleanup
+-- ============================================================================
+-- The event trigger itself is unchanged; its function now also drops the
+-- sortsupport, in_range and BRIN operator family entries added above.
+
+CREATE OR REPLACE FUNCTION pg_num2int_direct_comp_cleanup()
+RETURNS event_trigger
+LANGUAGE plpgsql AS $func$
+DECLARE
+    ops text[] := ARRAY[
+        -- Btree numeric_ops: int×int operators and functions
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 1 (int2, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 2 (int2, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 3 (int2, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 4 (int2, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 5 (int2, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 1 (int2, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 1 (int4, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 2 (int4, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 3 (int4, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 4 (int4, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 5 (int4, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 1 (int4, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 1 (int8, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 2 (int8, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 3 (int8, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 4 (int8, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 5 (int8, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 1 (int8, int8)',
+        -- Cross-integer comparisons in numeric_ops btree
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 1 (int2, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 2 (int2, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 3 (int2, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 4 (int2, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 5 (int2, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 1 (int2, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 1 (int4, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 2 (int4, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 3 (int4, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 4 (int4, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 5 (int4, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 1 (int4, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 1 (int2, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 2 (int2, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 3 (int2, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 4 (int2, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 5 (int2, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 1 (int2, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 1 (int8, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 2 (int8, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 3 (int8, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 4 (int8, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 5 (int8, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 1 (int8, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 1 (int4, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 2 (int4, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 3 (int4, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 4 (int4, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 5 (int4, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 1 (int4, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 1 (int8, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 2 (int8, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 3 (int8, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 4 (int8, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP OPERATOR 5 (int8, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 1 (int8, int4)',
+        -- Hash numeric_ops: integer hash functions
+        'ALTER OPERATOR FAMILY numeric_ops USING hash DROP FUNCTION 1 (int2, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING hash DROP FUNCTION 2 (int2, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING hash DROP FUNCTION 1 (int4, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING hash DROP FUNCTION 2 (int4, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING hash DROP FUNCTION 1 (int8, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING hash DROP FUNCTION 2 (int8, int8)',
+        -- Hash float_ops: integer hash functions
+        'ALTER OPERATOR FAMILY float_ops USING hash DROP FUNCTION 1 (int2, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING hash DROP FUNCTION 2 (int2, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING hash DROP FUNCTION 1 (int4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING hash DROP FUNCTION 2 (int4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING hash DROP FUNCTION 1 (int8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING hash DROP FUNCTION 2 (int8, int8)',
+        -- Btree integer_ops: numeric×numeric operators
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (numeric, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (numeric, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (numeric, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (numeric, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (numeric, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (numeric, numeric)',
+
+        -- Btree float_ops: native integer operators (added to complete the family)
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (int2, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (int2, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (int2, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (int2, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (int2, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (int2, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (int4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (int4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (int4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (int4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (int4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (int4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (int8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (int8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (int8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (int8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (int8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (int8, int8)',
+        -- Btree float_ops: int×float cross-type operators (NEW in v2.0)
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (int2, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (int2, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (int2, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (int2, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (int2, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (int2, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (int4, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (int4, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (int4, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (int4, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (int4, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (int4, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (int8, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (int8, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (int8, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (int8, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (int8, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (int8, float4)',
+
+        -- (continued from float_ops above - both float4 and float8 operators)
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (int2, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (int2, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (int2, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (int2, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (int2, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (int2, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (int4, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (int4, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (int4, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (int4, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (int4, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (int4, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 1 (int8, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 2 (int8, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 3 (int8, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 4 (int8, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP OPERATOR 5 (int8, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 1 (int8, float8)',
+
+        -- Btree integer_ops: float×float same-type operators (NEW in v2.0)
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (float4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (float4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (float4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (float4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (float4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (float4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (float8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (float8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (float8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (float8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (float8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (float8, float8)',
+
+        -- Btree integer_ops: int×float cross-type operators (NEW in v2.0)
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (float4, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (float4, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (float4, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (float4, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (float4, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (float4, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (float4, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (float4, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (float4, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (float4, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (float4, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (float4, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (float4, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (float4, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (float4, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (float4, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (float4, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (float4, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (float8, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (float8, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (float8, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (float8, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (float8, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (float8, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (float8, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (float8, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (float8, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (float8, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (float8, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (float8, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (float8, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (float8, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (float8, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (float8, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (float8, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (float8, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 1 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 2 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 3 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 4 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP OPERATOR 5 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 1 (int8, float8)',
+        -- Btree sortsupport (support proc 2) for the cross-type pairs
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 2 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 2 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 2 (numeric, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 2 (int2, numeric)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 2 (int4, numeric)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 2 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (numeric, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (numeric, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (numeric, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (int8, numeric)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (int2, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (int4, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (int8, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (int2, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (int4, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 2 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (float4, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (float4, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (float4, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (float8, int2)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (float8, int4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (float8, int8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 2 (int8, float8)',
+        -- Btree in_range (support proc 3) for RANGE window frames
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (numeric, numeric)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (float8, float8)',
+        'ALTER OPERATOR FAMILY integer_ops USING btree DROP FUNCTION 3 (float4, float8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int2, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int2, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int2, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int4, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int4, int4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int4, int2)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int8, int8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int2, numeric)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int2, float4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int2, float8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int4, numeric)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int4, float4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int4, float8)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int8, numeric)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int8, float4)',
+        'ALTER OPERATOR FAMILY numeric_ops USING btree DROP FUNCTION 3 (int8, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int2, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int2, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int2, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int4, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int4, int4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int4, int2)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int8, int8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int2, numeric)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int2, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int2, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int4, numeric)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int4, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int4, float8)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int8, numeric)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int8, float4)',
+        'ALTER OPERATOR FAMILY float_ops USING btree DROP FUNCTION 3 (int8, float8)',
+        -- BRIN integer_minmax_ops: cross-type operators
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 1 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 2 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 3 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 4 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 5 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 1 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 2 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 3 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 4 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 5 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 1 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 2 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 3 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 4 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 5 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 1 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 2 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 3 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 4 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 5 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 1 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 2 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 3 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 4 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 5 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 1 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 2 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 3 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 4 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 5 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 1 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 2 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 3 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 4 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 5 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 1 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 2 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 3 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 4 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 5 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 1 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 2 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 3 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 4 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_ops USING brin DROP OPERATOR 5 (int8, float8)',
+        -- BRIN integer_minmax_multi_ops (PostgreSQL 14+): cross-type operators
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 1 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 2 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 3 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 4 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 5 (int2, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 1 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 2 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 3 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 4 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 5 (int2, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 1 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 2 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 3 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 4 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 5 (int2, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 1 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 2 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 3 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 4 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 5 (int4, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 1 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 2 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 3 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 4 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 5 (int4, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 1 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 2 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 3 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 4 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 5 (int4, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 1 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 2 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 3 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 4 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 5 (int8, numeric)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 1 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 2 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 3 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 4 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 5 (int8, float4)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 1 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 2 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 3 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 4 (int8, float8)',
+        'ALTER OPERATOR FAMILY integer_minmax_multi_ops USING brin DROP OPERATOR 5 (int8, float8)',
+        -- BRIN numeric_minmax_ops: cross-type operators
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 1 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 2 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 3 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 4 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 5 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 1 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 2 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 3 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 4 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 5 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 1 (numeric, int8)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 2 (numeric, int8)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 3 (numeric, int8)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 4 (numeric, int8)',
+        'ALTER OPERATOR FAMILY numeric_minmax_ops USING brin DROP OPERATOR 5 (numeric, int8)',
+        -- BRIN numeric_minmax_multi_ops (PostgreSQL 14+): cross-type operators
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 1 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 2 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 3 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 4 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 5 (numeric, int2)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 1 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 2 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 3 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 4 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 5 (numeric, int4)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 1 (numeric, int8)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 2 (numeric, int8)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 3 (numeric, int8)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 4 (numeric, int8)',
+        'ALTER OPERATOR FAMILY numeric_minmax_multi_ops USING brin DROP OPERATOR 5 (numeric, int8)',
+        -- BRIN float_minmax_ops: cross-type operators
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 1 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 2 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 3 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 4 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 5 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 1 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 2 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 3 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 4 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 5 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 1 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 2 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 3 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 4 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 5 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 1 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 2 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 3 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 4 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 5 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 1 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 2 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 3 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 4 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 5 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 1 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 2 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 3 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 4 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_ops USING brin DROP OPERATOR 5 (float8, int8)',
+        -- BRIN float_minmax_multi_ops (PostgreSQL 14+): cross-type operators
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 1 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 2 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 3 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 4 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 5 (float4, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 1 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 2 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 3 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 4 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 5 (float4, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 1 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 2 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 3 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 4 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 5 (float4, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 1 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 2 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 3 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 4 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 5 (float8, int2)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 1 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 2 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 3 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 4 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 5 (float8, int4)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 1 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 2 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 3 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 4 (float8, int8)',
+        'ALTER OPERATOR FAMILY float_minmax_multi_ops USING brin DROP OPERATOR 5 (float8, int8)'
+    ];
+    stmt text;
+BEGIN
+    -- Only process DROP EXTENSION for this specific extension
+    IF NOT (current_query() ~* 'DROP\s+EXTENSION.*pg_num2int_direct_comp') THEN
+        RETURN;
+    END IF;
+
+    -- Execute each cleanup statement, ignoring errors (operator may not exist)
+    FOREACH stmt IN ARRAY ops LOOP
+        BEGIN
+            EXECUTE stmt;
+        EXCEPTION WHEN OTHERS THEN
+            -- Silently ignore - operator/function may not have been added
+            NULL;
+        END;
+    END LOOP;
+
+    RAISE NOTICE 'pg_num2int_direct_comp: cleaned up operator family entries';
+END;
+$func$;
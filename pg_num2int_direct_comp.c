@@ -20,32 +20,83 @@
  */
 
 #include "pg_num2int_direct_comp.h"
+#include "access/genam.h"
+#include "access/htup_details.h"
+#include "access/table.h"
+#include "access/transam.h"
+#include "access/xact.h"
 #include "catalog/pg_proc_d.h"
 #include "catalog/pg_type_d.h"
 #include "catalog/namespace.h"
+#include "catalog/pg_extension.h"
 #include "catalog/pg_operator.h"
+#include "catalog/pg_statistic.h"
+#include "catalog/indexing.h"
+#include "commands/extension.h"
 #include "common/hashfn.h"
+#include "common/int.h"
 #include "nodes/supportnodes.h"
 #include "nodes/nodeFuncs.h"
 #include "nodes/makefuncs.h"
+#include "optimizer/cost.h"
 #include "optimizer/optimizer.h"
+#include "optimizer/pathnode.h"
+#include "optimizer/plancat.h"
+#include "optimizer/planner.h"
+#include "parser/parse_coerce.h"
+#include "parser/parse_func.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/datum.h"
+#include "utils/fmgroids.h"
 #include "utils/fmgrprotos.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/numeric.h"
+#include "utils/rel.h"
+#include "utils/selfuncs.h"
+#include "utils/sortsupport.h"
 #include "utils/syscache.h"
 #include "utils/inval.h"
 #include "utils/guc.h"
 #include "fmgr.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "port/atomics.h"
+#include "portability/instr_time.h"
+#include "storage/ipc.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/tuplestore.h"
 #include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define NUM2INT_HAVE_RDTSC 1
+#endif
 
 PG_MODULE_MAGIC;
 
 /* GUC variables */
 static bool enableSupportFunctions = true;
+static bool enableRangeFolding = false;
+
+/* Saved hook values in case of unload */
+static planner_hook_type prevPlannerHook = NULL;
+
+static OpType opTypeFromName(const char *oprname);
+
+#if PG_VERSION_NUM >= 130000
+static PlannedStmt *num2intPlanner(Query *parse, const char *queryString,
+                                   int cursorOptions,
+                                   ParamListInfo boundParams);
+#else
+static PlannedStmt *num2intPlanner(Query *parse, int cursorOptions,
+                                   ParamListInfo boundParams);
+#endif
 
 /* Static per-backend OID cache */
 static OperatorOidCache oidCache = {
+  .valid = false,
   .count = 0,
   .ops = {{.funcid = 0, .oid = 0, .type = OP_TYPE_UNKNOWN}}
 };
@@ -61,24 +112,6 @@ static NumericBoundaryCache numericBounds = {
   .int8Max = NULL
 };
 
-/*
- * Pre-computed float boundaries for integer range checks.
- * These avoid runtime int-to-float conversions in hot paths.
- * Note: float4 can exactly represent all int16 values and most int32 values,
- * but int64 boundaries lose precision (which is fine for our range checks).
- */
-static const float4 FLOAT4_INT16_MIN = (float4) PG_INT16_MIN;
-static const float4 FLOAT4_INT16_MAX = (float4) PG_INT16_MAX;
-static const float4 FLOAT4_INT32_MIN = (float4) PG_INT32_MIN;
-static const float4 FLOAT4_INT32_MAX = (float4) PG_INT32_MAX;
-
-static const float8 FLOAT8_INT16_MIN = (float8) PG_INT16_MIN;
-static const float8 FLOAT8_INT16_MAX = (float8) PG_INT16_MAX;
-static const float8 FLOAT8_INT32_MIN = (float8) PG_INT32_MIN;
-static const float8 FLOAT8_INT32_MAX = (float8) PG_INT32_MAX;
-static const float8 FLOAT8_INT64_MIN = (float8) PG_INT64_MIN;
-static const float8 FLOAT8_INT64_MAX = (float8) PG_INT64_MAX;
-
 /**
  * @brief Initialize cached Numeric boundary values
  * @param cache Pointer to cache structure to populate
@@ -118,8 +151,12 @@ initNumericBoundaries(NumericBoundaryCache *cache)
 /* ============================================================================
  * Optimized Numeric Inspection Functions
  * ============================================================================
- * These functions use direct structure access via NUM2INT_NUMERIC_* macros
- * for efficiency, avoiding function call overhead for common operations.
+ * These functions use direct structure access for efficiency, avoiding
+ * function call overhead for common operations. All of them go through
+ * decodeNumericHeader()/decodeNumericValue() (see pg_num2int_direct_comp.h),
+ * which read the header word and
+ * the digit array once instead of re-evaluating the NUM2INT_NUMERIC_* macros
+ * (each of which re-tests the short/long format) per field.
  */
 
 /**
@@ -127,7 +164,6 @@ initNumericBoundaries(NumericBoundaryCache *cache)
  * @param num Numeric value to inspect
  * @return 1 if positive, -1 if negative, 0 if zero
  *
- * Uses NUM2INT_NUMERIC_SIGN macro for direct header access.
  * For NaN, returns 0 (caller should check NUM2INT_NUMERIC_IS_NAN first).
  * For +Inf returns 1, for -Inf returns -1.
  *
@@ -136,28 +172,10 @@ initNumericBoundaries(NumericBoundaryCache *cache)
 int
 num2int_numeric_sign(Numeric num)
 {
-    int sign;
-    int ndigits;
-
-    /* Handle special values (NaN, Inf) */
-    if (NUM2INT_NUMERIC_IS_SPECIAL(num))
-    {
-        if (NUM2INT_NUMERIC_IS_NAN(num))
-            return 0;  /* NaN has no meaningful sign */
-        if (NUM2INT_NUMERIC_IS_PINF(num))
-            return 1;
-        /* Must be -Inf */
-        return -1;
-    }
+    Num2IntNumericInfo info;
 
-    /* Check for zero: no digits means zero */
-    ndigits = NUM2INT_NUMERIC_NDIGITS(num);
-    if (ndigits == 0)
-        return 0;
-
-    /* Get sign from header */
-    sign = NUM2INT_NUMERIC_SIGN(num);
-    return (sign == NUM2INT_NUMERIC_POS) ? 1 : -1;
+    decodeNumericHeader(num, &info);
+    return info.isNaN ? 0 : info.sign;
 }
 
 /**
@@ -175,30 +193,10 @@ num2int_numeric_sign(Numeric num)
 bool
 num2int_numeric_is_integral(Numeric num)
 {
-    int weight;
-    int ndigits;
-
-    /* Handle special values */
-    if (NUM2INT_NUMERIC_IS_SPECIAL(num))
-    {
-        /* NaN is not integral */
-        return !NUM2INT_NUMERIC_IS_NAN(num);
-    }
-
-    ndigits = NUM2INT_NUMERIC_NDIGITS(num);
-
-    /* Zero (no digits) is integral */
-    if (ndigits == 0)
-        return true;
-
-    weight = NUM2INT_NUMERIC_WEIGHT(num);
+    Num2IntNumericInfo info;
 
-    /*
-     * Numeric stores base-10000 digits. Weight indicates position of first
-     * digit (0 = units place, 1 = 10000s place, etc).
-     * If ndigits <= weight + 1, all digits are in integral positions.
-     */
-    return ndigits <= weight + 1;
+    decodeNumericHeader(num, &info);
+    return info.isIntegral;
 }
 
 /**
@@ -213,184 +211,239 @@ num2int_numeric_is_integral(Numeric num)
 bool
 numericToint64(Numeric num, int64 *result)
 {
-  int weight;
-  int ndigits;
-  int sign;
-  int i;
-  int64 val;
-  Num2IntNumericDigit *digits;
+  Num2IntNumericInfo info;
 
-  /* Reject special values */
-  if (NUM2INT_NUMERIC_IS_SPECIAL(num))
+  decodeNumericHeader(num, &info);
+  if (info.special != 0 || !info.isIntegral)
     return false;
 
-  ndigits = NUM2INT_NUMERIC_NDIGITS(num);
+  decodeNumericValue(&info);
+  if (!info.fitsInt64)
+    return false;
 
-  /* Zero case */
-  if (ndigits == 0) {
-    *result = 0;
-    return true;
-  }
+  *result = info.floorVal;
+  return true;
+}
 
-  weight = NUM2INT_NUMERIC_WEIGHT(num);
-  sign = NUM2INT_NUMERIC_SIGN(num);
+/* ============================================================================
+ * Instrumentation Counters
+ * ============================================================================
+ * Planner outcomes of SupportRequestSimplify and slow-path numeric
+ * comparisons are counted per backend with a plain increment. When the
+ * library is in shared_preload_libraries, each backend also adds its counts to
+ * shared totals at the end of every transaction, so the hot paths never touch
+ * shared memory. pg_num2int_direct_comp_stats() reports both.
+ */
 
-  /* Must be integral */
-  if (ndigits > weight + 1)
-    return false;
+/** Counter slots, in the order reported by pg_num2int_direct_comp_stats() */
+typedef enum {
+  NUM2INT_STAT_SIMPLIFY_CALLS = 0,      /* SupportRequestSimplify requests */
+  NUM2INT_STAT_SIMPLIFIED_NATIVE,       /* rewritten to a native comparison */
+  NUM2INT_STAT_SIMPLIFIED_CONSTANT,     /* folded to TRUE/FALSE/IS [NOT] NULL */
+  NUM2INT_STAT_SIMPLIFIED_RUNTIME_KEY,  /* runtime index key (planner hook) */
+  NUM2INT_STAT_BAILOUT_DISABLED,        /* enableSupportFunctions is off */
+  NUM2INT_STAT_BAILOUT_NO_CONSTANT,     /* no constant or runtime comparand */
+  NUM2INT_STAT_BAILOUT_NULL_CONSTANT,   /* NULL constant */
+  NUM2INT_STAT_BAILOUT_UNKNOWN_FUNCTION, /* funcid not one of our operators */
+  NUM2INT_STAT_BAILOUT_RUNTIME_KEY,     /* runtime comparand, no key or not a qual */
+  NUM2INT_STAT_BAILOUT_SPECIAL_VALUE,   /* NaN or Infinity constant */
+  NUM2INT_STAT_BAILOUT_UNSUPPORTED_SHAPE, /* argument count or types not handled */
+  NUM2INT_STAT_NUMERIC_CMP_FRACTION,    /* numeric × int compare of a fraction */
+  NUM2INT_STAT_NUMERIC_CMP_OUT_OF_RANGE, /* numeric × int compare beyond int64 */
+  NUM2INT_STAT_COUNT
+} Num2IntStatCounter;
+
+static const char *const statNames[NUM2INT_STAT_COUNT] = {
+  "simplify_calls",
+  "simplified_native",
+  "simplified_constant",
+  "simplified_runtime_key",
+  "bailout_disabled",
+  "bailout_no_constant",
+  "bailout_null_constant",
+  "bailout_unknown_function",
+  "bailout_runtime_key",
+  "bailout_special_value",
+  "bailout_unsupported_shape",
+  "numeric_cmp_fraction",
+  "numeric_cmp_out_of_range"
+};
 
-  /*
-   * Quick range check: int64 max is about 9.2e18
-   * Each weight unit represents 10000^weight, so weight 4 = 10^16, weight 5 = 10^20
-   * Weight > 4 could overflow (but depends on leading digit)
-   * Weight <= 3 is definitely safe
-   */
-  if (weight > 4)
-    return false;
+/** Shared totals, present only when loaded via shared_preload_libraries */
+typedef struct {
+  pg_atomic_uint64 counters[NUM2INT_STAT_COUNT];
+} Num2IntSharedStats;
 
-  digits = NUM2INT_NUMERIC_DIGITS(num);
-  val = 0;
-  /* Accumulate digits, checking for overflow */
-  for (i = 0; i <= weight; i++) {
-    int64 digit = (i < ndigits) ? digits[i] : 0;
-    int64 newval;
-    /* Check multiplication overflow */
-    if (val > PG_INT64_MAX / NUM2INT_NBASE)
-      return false;
-    newval = val * NUM2INT_NBASE;
+static uint64 localStats[NUM2INT_STAT_COUNT];
+static uint64 flushedStats[NUM2INT_STAT_COUNT];
+static Num2IntSharedStats *sharedStats = NULL;
 
-    /* Check addition overflow */
-    if (sign == NUM2INT_NUMERIC_POS) {
-      if (digit > PG_INT64_MAX - newval)
-        return false;
-      newval += digit;
-    }
-    else {
-      /* For negative, we build positive then negate */
-      if (digit > PG_INT64_MAX - newval) {
-        /*
-         * Special case: PG_INT64_MIN has magnitude one greater than
-         * PG_INT64_MAX, so we can represent -9223372036854775808
-         */
-        if (newval == PG_INT64_MAX - digit + 1 && i == weight) {
-          *result = PG_INT64_MIN;
-          return true;
-        }
-        return false;
-      }
-      newval += digit;
-    }
-    val = newval;
-  }
+static shmem_startup_hook_type prevShmemStartupHook = NULL;
+#if PG_VERSION_NUM >= 150000
+static shmem_request_hook_type prevShmemRequestHook = NULL;
+#endif
 
-  *result = (sign == NUM2INT_NUMERIC_POS) ? val : -val;
-  return true;
+/**
+ * @brief Count one event in this backend
+ */
+static inline void
+countStat(Num2IntStatCounter counter) {
+  localStats[counter]++;
 }
 
 /**
- * @brief Extract floor of Numeric as int64 using direct digit access
- * @param num Numeric value (must not be NaN/Inf - caller should check)
- * @param result Output: floor value as int64
- * @return true if floor fits in int64, false if out of range
+ * @brief Count a SupportRequestSimplify call that leaves the clause alone
+ * @param counter Bail-out reason
  *
- * For integral values, returns the value itself.
- * For fractional values, extracts only the integral digits and adjusts
- * for negative numbers (floor rounds toward -infinity).
+ * The reason is also reported at DEBUG1, so running EXPLAIN with
+ * client_min_messages = debug1 shows why a clause kept its cross-type
+ * operator.
  */
-static bool
-numericFloorToInt64(Numeric num, int64 *result)
-{
-  int weight;
-  int ndigits;
-  int sign;
-  int integralNdigits;
-  int64 floorVal;
-  int i;
-  Num2IntNumericDigit *digits;
-
-  ndigits = NUM2INT_NUMERIC_NDIGITS(num);
+static void
+countBailout(Num2IntStatCounter counter) {
+  localStats[counter]++;
+  elog(DEBUG1, "SupportRequestSimplify: not simplified (%s)",
+       statNames[counter]);
+}
 
-  /* Zero case */
-  if (ndigits == 0) {
-    *result = 0;
-    return true;
+/**
+ * @brief Count a numeric × integer comparison that left the integral fast path
+ * @param info Decoded numeric operand (fraction or beyond int64)
+ *
+ * Exported (PGDLLEXPORT) rather than static so that the inline comparison
+ * kernels calling it remain inlinable by the JIT (see
+ * pg_num2int_direct_comp.h).
+ */
+void
+countNumericSlowPath(const Num2IntNumericInfo *info) {
+  if (!info->fitsInt64) {
+    countStat(NUM2INT_STAT_NUMERIC_CMP_OUT_OF_RANGE);
+  } else if (!info->isIntegral) {
+    countStat(NUM2INT_STAT_NUMERIC_CMP_FRACTION);
   }
+}
 
-  weight = NUM2INT_NUMERIC_WEIGHT(num);
-  sign = NUM2INT_NUMERIC_SIGN(num);
-  digits = NUM2INT_NUMERIC_DIGITS(num);
-
-  /*
-   * If weight > 4, the integral part exceeds int64 range.
-   * (weight 5 means 10000^5 = 10^20, but int64 max is ~9.2e18)
-   */
-  if (weight > 4)
-    return false;
-
-  /* Number of integral digits is weight + 1 */
-  integralNdigits = weight + 1;
+/**
+ * @brief Add this backend's counts since the last flush to the shared totals
+ */
+static void
+flushStats(void) {
+  for (int i = 0; i < NUM2INT_STAT_COUNT; i++) {
+    uint64 delta = localStats[i] - flushedStats[i];
 
-  if (integralNdigits <= 0) {
-    /*
-     * No integral digits (e.g., 0.5 has weight=-1).
-     * floor(positive fraction) = 0, floor(negative fraction) = -1
-     */
-    *result = (sign == NUM2INT_NUMERIC_POS) ? 0 : -1;
-    return true;
+    if (delta != 0) {
+      pg_atomic_fetch_add_u64(&sharedStats->counters[i], delta);
+      flushedStats[i] = localStats[i];
+    }
   }
+}
 
-  /* Check if value is integral (no fractional part) */
-  if (ndigits <= integralNdigits) {
-    /* Integral - use existing extraction */
-    return numericToint64(num, result);
+/**
+ * @brief Flush counters to shared memory at transaction end
+ */
+static void
+statsXactCallback(XactEvent event, void *arg) {
+  if (sharedStats == NULL) {
+    return;
   }
+  if (event == XACT_EVENT_COMMIT || event == XACT_EVENT_ABORT ||
+      event == XACT_EVENT_PARALLEL_COMMIT ||
+      event == XACT_EVENT_PARALLEL_ABORT) {
+    flushStats();
+  }
+}
 
-  /*
-   * Has fractional part - extract only integral digits
-   * padding with zeros if ndigits < integralNdigits
-   */
-  floorVal = 0;
-  for (i = 0; i < integralNdigits; i++) {
-    Num2IntNumericDigit digit = (i < ndigits) ? digits[i] : 0;
+#if PG_VERSION_NUM >= 150000
+/**
+ * @brief Request shared memory for the counter totals
+ */
+static void
+statsShmemRequest(void) {
+  if (prevShmemRequestHook) {
+    prevShmemRequestHook();
+  }
+  RequestAddinShmemSpace(sizeof(Num2IntSharedStats));
+}
+#endif
 
-    /* Overflow check for multiplication */
-    if (floorVal > PG_INT64_MAX / NUM2INT_NBASE)
-      return false;
-    floorVal = floorVal * NUM2INT_NBASE;
+/**
+ * @brief Attach to (and on first use initialize) the shared counter totals
+ */
+static void
+statsShmemStartup(void) {
+  bool found;
 
-    /* Overflow check for addition */
-    if (digit > PG_INT64_MAX - floorVal)
-      return false;
-    floorVal += digit;
+  if (prevShmemStartupHook) {
+    prevShmemStartupHook();
   }
 
-  /* Apply sign and floor adjustment for negative */
-  if (sign == NUM2INT_NUMERIC_POS) {
-    *result = floorVal;
-  } else {
-    /*
-     * For negative with fractional part: floor = -trunc - 1
-     * e.g., floor(-100.5) = -101, not -100
-     *
-     * No overflow: floorVal <= PG_INT64_MAX, so
-     * -floorVal - 1 >= PG_INT64_MIN.
-     */
-    *result = -floorVal - 1;
+  LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+  sharedStats = (Num2IntSharedStats *)
+      ShmemInitStruct("pg_num2int_direct_comp stats",
+                      sizeof(Num2IntSharedStats), &found);
+  if (!found) {
+    for (int i = 0; i < NUM2INT_STAT_COUNT; i++) {
+      pg_atomic_init_u64(&sharedStats->counters[i], 0);
+    }
   }
+  LWLockRelease(AddinShmemInitLock);
+}
 
-  return true;
+/**
+ * @brief Prepare a materialized result set for a set-returning function
+ * @param fcinfo Function call information
+ * @param tupdesc Output: result row descriptor
+ * @return Tuplestore to fill with tuplestore_putvalues()
+ */
+static Tuplestorestate *
+beginMaterializedResult(FunctionCallInfo fcinfo, TupleDesc *tupdesc) {
+  ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+  Tuplestorestate *tupstore;
+  MemoryContext oldcontext;
+
+  if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo) ||
+      !(rsinfo->allowedModes & SFRM_Materialize))
+    ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+             errmsg("set-valued function called in context that cannot accept a set")));
+
+  if (get_call_result_type(fcinfo, NULL, tupdesc) != TYPEFUNC_COMPOSITE)
+    elog(ERROR, "return type must be a row type");
+
+  oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+  *tupdesc = CreateTupleDescCopy(*tupdesc);
+  tupstore = tuplestore_begin_heap(true, false, work_mem);
+  rsinfo->returnMode = SFRM_Materialize;
+  rsinfo->setResult = tupstore;
+  rsinfo->setDesc = *tupdesc;
+  MemoryContextSwitchTo(oldcontext);
+
+  return tupstore;
 }
 
 /**
  * @brief Syscache invalidation callback for operator changes
  *
  * Called by PostgreSQL when any operator is created, dropped, or modified.
- * Invalidates our cached OIDs so they are re-looked up on next use.
+ * Only entries whose OPEROID hash value matches the changed operator are
+ * dropped, so operators created by other extensions do not force all 108
+ * lookups to run again. Entries that are not resolved yet are retried, since
+ * the change may be the creation of one of our operators. A hash value of 0
+ * means the whole syscache was reset.
  */
 static void
 operatorCacheInvalidationCallback(Datum arg, int cacheid, uint32 hashvalue)
 {
-    oidCache.count = 0;
+    for (int i = 0; i < NUM2INT_OP_COUNT; i++) {
+        OperatorEntry *entry = &oidCache.ops[i];
+
+        if (hashvalue == 0 || !OidIsValid(entry->oid) ||
+            entry->hashValue == hashvalue) {
+            entry->oid = InvalidOid;
+            entry->funcid = InvalidOid;
+            oidCache.valid = false;
+        }
+    }
 }
 
 /**
@@ -398,7 +451,9 @@ operatorCacheInvalidationCallback(Datum arg, int cacheid, uint32 hashvalue)
  *
  * Registers a syscache invalidation callback so our OID cache is automatically
  * invalidated when operators are created/dropped (e.g., DROP/CREATE EXTENSION).
+ * Installs the planner hook that rewrites constant-array comparisons.
  * Also initializes the Numeric boundary cache for efficient range checking.
+ * When preloaded, requests shared memory for the instrumentation counters.
  */
 void
 _PG_init(void)
@@ -420,31 +475,347 @@ _PG_init(void)
                            NULL,               /* assign_hook */
                            NULL);              /* show_hook */
 
+    DefineCustomBoolVariable("pg_num2int_direct_comp.enableRangeFolding",
+                           "Fold integer range predicates on the same operand",
+                           "When enabled, the planner hook intersects the range and equality "
+                           "predicates that restrict the same integer expression in a WHERE or "
+                           "ON clause into one index condition, or constant FALSE if empty. "
+                           "Has no effect while enableSupportFunctions is off.",
+                           &enableRangeFolding,
+                           false,               /* boot_val */
+                           PGC_USERSET,        /* context */
+                           0,                  /* flags */
+                           NULL,               /* check_hook */
+                           NULL,               /* assign_hook */
+                           NULL);              /* show_hook */
+
     CacheRegisterSyscacheCallback(OPEROID,
                                   operatorCacheInvalidationCallback,
                                   (Datum) 0);
 
+    /* Rewrite constant-array comparisons before planning */
+    prevPlannerHook = planner_hook;
+    planner_hook = num2intPlanner;
+
     /* Initialize Numeric boundary cache for range checking */
     initNumericBoundaries(&numericBounds);
+
+    /* Shared counter totals need shared_preload_libraries */
+    if (process_shared_preload_libraries_in_progress) {
+#if PG_VERSION_NUM >= 150000
+        prevShmemRequestHook = shmem_request_hook;
+        shmem_request_hook = statsShmemRequest;
+#else
+        RequestAddinShmemSpace(sizeof(Num2IntSharedStats));
+#endif
+        prevShmemStartupHook = shmem_startup_hook;
+        shmem_startup_hook = statsShmemStartup;
+    }
+    RegisterXactCallback(statsXactCallback, NULL);
+}
+
+/**
+ * @brief Map integer type OID to lookup table index
+ * @param intType Integer type OID (INT2OID, INT4OID, or INT8OID)
+ * @return Index 0, 1, or 2 for int2, int4, int8 respectively
+ */
+static inline int
+intTypeIndex(Oid intType) {
+  return (intType == INT2OID) ? 0 :
+         (intType == INT4OID) ? 1 : /* INT8OID */ 2;
+}
+
+/**
+ * @brief Map inexact type OID to lookup table index
+ * @param inexactType Inexact type OID (NUMERICOID, FLOAT4OID, or FLOAT8OID)
+ * @return Index 0, 1, or 2 for numeric, float4, float8 respectively
+ */
+static inline int
+inexactTypeIndex(Oid inexactType) {
+  return (inexactType == NUMERICOID) ? 0 :
+         (inexactType == FLOAT4OID) ? 1 : /* FLOAT8OID */ 2;
+}
+
+/**
+ * @brief Home slot of an OID in an operator hash index
+ */
+static inline uint32
+operatorIndexSlot(Oid key) {
+  return murmurhash32((uint32) key) & (NUM2INT_OP_HASH_SIZE - 1);
+}
+
+/**
+ * @brief Insert an ops[] index into an operator hash index (linear probing)
+ * @param index byFuncid or byOid
+ * @param key Function or operator OID
+ * @param entryIndex Position of the entry in ops[]
+ */
+static void
+insertOperatorIndex(uint8 *index, Oid key, int entryIndex) {
+  uint32 slot = operatorIndexSlot(key);
+
+  while (index[slot] != 0) {
+    slot = (slot + 1) & (NUM2INT_OP_HASH_SIZE - 1);
+  }
+  index[slot] = (uint8) (entryIndex + 1);
+}
+
+/**
+ * @brief Look up a cached operator by function or operator OID
+ * @param byFuncid true to search byFuncid by funcid, false for byOid by oid
+ * @param key OID to look up
+ * @return Matching entry, or NULL
+ */
+static OperatorEntry *
+lookupOperatorEntry(bool byFuncid, Oid key) {
+  const uint8 *index = byFuncid ? oidCache.byFuncid : oidCache.byOid;
+  uint32 slot = operatorIndexSlot(key);
+
+  while (index[slot] != 0) {
+    OperatorEntry *entry = &oidCache.ops[index[slot] - 1];
+
+    if ((byFuncid ? entry->funcid : entry->oid) == key) {
+      return entry;
+    }
+    slot = (slot + 1) & (NUM2INT_OP_HASH_SIZE - 1);
+  }
+  return NULL;
+}
+
+/**
+ * @brief Position of an operator in OperatorOidCache.ops
+ * @param opType Operator type
+ * @param leftType Left operand type
+ * @param rightType Right operand type
+ * @return Entry index, or -1 if this is not one of the 108 cached operators
+ *
+ * Entries are laid out as [opType - 1][direction][first type][second type]:
+ * for each operator, the forward direction (inexact op integer) followed by
+ * the commutator direction (integer op inexact).
+ */
+static int
+operatorEntryIndex(OpType opType, Oid leftType, Oid rightType) {
+  bool leftInt = (leftType == INT2OID || leftType == INT4OID ||
+                  leftType == INT8OID);
+  bool rightInt = (rightType == INT2OID || rightType == INT4OID ||
+                   rightType == INT8OID);
+  bool leftInexact = (leftType == NUMERICOID || leftType == FLOAT4OID ||
+                      leftType == FLOAT8OID);
+  bool rightInexact = (rightType == NUMERICOID || rightType == FLOAT4OID ||
+                       rightType == FLOAT8OID);
+  int base;
+
+  if (opType == OP_TYPE_UNKNOWN) {
+    return -1;
+  }
+  base = (opType - 1) * 18;
+
+  if (leftInexact && rightInt) {
+    return base + inexactTypeIndex(leftType) * 3 + intTypeIndex(rightType);
+  }
+  if (leftInt && rightInexact) {
+    return base + 9 + intTypeIndex(leftType) * 3 + inexactTypeIndex(rightType);
+  }
+  return -1;
+}
+
+/**
+ * @brief Find the extension's OID map table
+ * @return Relation OID of NUM2INT_OID_MAP_NAME, or InvalidOid if the
+ *         extension or the table does not exist
+ *
+ * The table is looked up in the extension's current schema, so it is found
+ * whether or not that schema is in search_path, and after
+ * ALTER EXTENSION ... SET SCHEMA.
+ */
+static Oid
+getOidMapRelid(void) {
+  Oid extOid = get_extension_oid(NUM2INT_EXTENSION_NAME, true);
+  Oid nspOid = InvalidOid;
+  Relation rel;
+  SysScanDesc scan;
+  ScanKeyData key;
+  HeapTuple tuple;
+
+  if (!OidIsValid(extOid)) {
+    return InvalidOid;
+  }
+
+  rel = table_open(ExtensionRelationId, AccessShareLock);
+  ScanKeyInit(&key, Anum_pg_extension_oid, BTEqualStrategyNumber, F_OIDEQ,
+              ObjectIdGetDatum(extOid));
+  scan = systable_beginscan(rel, ExtensionOidIndexId, true, NULL, 1, &key);
+  tuple = systable_getnext(scan);
+  if (HeapTupleIsValid(tuple)) {
+    nspOid = ((Form_pg_extension) GETSTRUCT(tuple))->extnamespace;
+  }
+  systable_endscan(scan);
+  table_close(rel, AccessShareLock);
+
+  if (!OidIsValid(nspOid)) {
+    return InvalidOid;
+  }
+  return get_relname_relid(NUM2INT_OID_MAP_NAME, nspOid);
+}
+
+/**
+ * @brief Resolve unresolved cache entries from the extension's OID map
+ * @param cache Cache to populate
+ * @return true if the runtime key functions were loaded as well
+ *
+ * The install script records the OIDs of the extension's operators and
+ * runtime key functions in NUM2INT_OID_MAP_NAME, so a new backend resolves
+ * the whole cache with one scan of a small table instead of 108 operator
+ * name lookups and 27 function name lookups. Each operator row is checked
+ * against pg_operator (a syscache probe by OID), so a stale map, for example
+ * one carried over by pg_upgrade, where operator OIDs are not preserved,
+ * only costs the name lookups it was meant to save. A stale map is reported
+ * once per backend in the server log, with a hint to rebuild it with
+ * pg_num2int_direct_comp_refresh_oid_map().
+ */
+static bool
+loadOidMap(OperatorOidCache *cache) {
+  static const char *const kindNames[NUM2INT_KEY_KIND_COUNT] = {
+    "eq", "lower", "upper"
+  };
+  static const char *const inexactNames[3] = {"numeric", "float4", "float8"};
+  static const char *const intNames[3] = {"int2", "int4", "int8"};
+  char keyNames[NUM2INT_KEY_KIND_COUNT][3][3][NAMEDATALEN];
+  Oid keyFuncs[NUM2INT_KEY_KIND_COUNT][3][3];
+  int keyFuncCount = 0;
+  bool stale = false;
+  Oid relid = getOidMapRelid();
+  Relation rel;
+  TupleDesc desc;
+  SysScanDesc scan;
+  HeapTuple tuple;
+
+  if (!OidIsValid(relid)) {
+    return false;
+  }
+
+  memset(keyFuncs, 0, sizeof(keyFuncs));
+  for (int k = 0; k < NUM2INT_KEY_KIND_COUNT; k++) {
+    for (int t = 0; t < 3; t++) {
+      for (int i = 0; i < 3; i++) {
+        snprintf(keyNames[k][t][i], NAMEDATALEN, "%s_%s_key_%s",
+                 inexactNames[t], kindNames[k], intNames[i]);
+      }
+    }
+  }
+
+  rel = table_open(relid, AccessShareLock);
+  desc = RelationGetDescr(rel);
+  if (desc->natts != NUM2INT_OID_MAP_NATTS) {
+    table_close(rel, AccessShareLock);
+    return false;
+  }
+  scan = systable_beginscan(rel, InvalidOid, false, NULL, 0, NULL);
+
+  while (HeapTupleIsValid(tuple = systable_getnext(scan))) {
+    Datum values[NUM2INT_OID_MAP_NATTS];
+    bool nulls[NUM2INT_OID_MAP_NATTS];
+    char *name;
+    Oid leftType, rightType, objid, funcid;
+    int idx;
+
+    heap_deform_tuple(tuple, desc, values, nulls);
+    if (nulls[0] || nulls[1] || nulls[2] || nulls[3] || nulls[4]) {
+      continue;
+    }
+    name = TextDatumGetCString(values[0]);
+    leftType = DatumGetObjectId(values[1]);
+    rightType = DatumGetObjectId(values[2]);
+    objid = DatumGetObjectId(values[3]);
+    funcid = DatumGetObjectId(values[4]);
+
+    idx = operatorEntryIndex(opTypeFromName(name), leftType, rightType);
+    if (idx >= 0) {
+      OperatorEntry *entry = &cache->ops[idx];
+
+      if (get_opcode(objid) != funcid) {
+        stale = true;
+      } else if (!OidIsValid(entry->oid)) {
+        entry->oid = objid;
+        entry->funcid = funcid;
+        entry->hashValue = GetSysCacheHashValue1(OPEROID,
+                                                 ObjectIdGetDatum(objid));
+      }
+      continue;
+    }
+
+    /* Runtime key function: "<inexact>_<kind>_key_<int>" */
+    for (int k = 0; k < NUM2INT_KEY_KIND_COUNT; k++) {
+      for (int t = 0; t < 3; t++) {
+        for (int i = 0; i < 3; i++) {
+          if (strcmp(name, keyNames[k][t][i]) == 0 &&
+              !OidIsValid(keyFuncs[k][t][i])) {
+            keyFuncs[k][t][i] = funcid;
+            keyFuncCount++;
+          }
+        }
+      }
+    }
+  }
+
+  systable_endscan(scan);
+  table_close(rel, AccessShareLock);
+
+  /*
+   * Key function rows are only trusted when every operator row checked out:
+   * a map whose OIDs do not match the catalog is not from this installation.
+   */
+  if (stale || keyFuncCount != NUM2INT_KEY_KIND_COUNT * 3 * 3) {
+    static bool reported = false;
+
+    if (stale && !reported) {
+      reported = true;
+      ereport(LOG,
+              (errmsg("pg_num2int_direct_comp OID map does not match the "
+                      "catalog, resolving operators by name"),
+               errhint("Run SELECT pg_num2int_direct_comp_refresh_oid_map() "
+                       "in this database, as needed after pg_upgrade.")));
+    }
+    return false;
+  }
+  memcpy(cache->keyFuncs, keyFuncs, sizeof(keyFuncs));
+  return true;
 }
 
 /**
  * @brief Initialize the operator OID cache
  * @param cache Pointer to cache structure to populate
  *
- * Performs lazy initialization of operator OIDs by looking up operator
- * names in the system catalog. This function is called once per backend
- * on first invocation of the support function and after cache invalidation.
+ * Performs lazy initialization of operator OIDs, first from the extension's
+ * OID map (see loadOidMap()) and then by looking up the names of any
+ * operators still unresolved in the system catalog. This function is called
+ * once per backend on first invocation of the support function, and after a
+ * cache invalidation to re-resolve the dropped entries. The runtime key
+ * functions are reloaded whenever any operator entry was re-resolved, which
+ * covers DROP/CREATE EXTENSION.
  */
 void
 initOidCache(OperatorOidCache *cache) {
+  /* Operator names indexed by OpType - 1 */
+  static const char *const opNames[6] = {"=", "<>", "<", ">", "<=", ">="};
+  static const Oid inexactTypes[3] = {NUMERICOID, FLOAT4OID, FLOAT8OID};
+  static const Oid intTypes[3] = {INT2OID, INT4OID, INT8OID};
   MemoryContext oldcontext;
   MemoryContext tmpcontext;
+  bool resolved = false;
+  bool keyFuncsLoaded = false;
+  int idx = 0;
 
-  if (cache->count > 0) {
+  if (cache->valid) {
     return;
   }
 
+  /*
+   * Mark valid before any catalog access: an invalidation processed during
+   * the lookups below clears the flag again, so it is not lost.
+   */
+  cache->valid = true;
+
   /*
    * Create a temporary memory context for intermediate allocations.
    * OpernameGetOprid's list_make1(makeString(...)) calls allocate List and
@@ -455,150 +826,84 @@ initOidCache(OperatorOidCache *cache) {
                                      ALLOCSET_SMALL_SIZES);
   oldcontext = MemoryContextSwitchTo(tmpcontext);
 
+  for (int i = 0; i < NUM2INT_OP_COUNT; i++) {
+    if (!OidIsValid(cache->ops[i].oid)) {
+      resolved = true;
+      break;
+    }
+  }
+  if (resolved) {
+    keyFuncsLoaded = loadOidMap(cache);
+  }
+
+  /*
+   * Look up by name whatever the map did not provide. Entries are laid out as
+   * in operatorEntryIndex(); only entries dropped by
+   * operatorCacheInvalidationCallback() are looked up again.
+   */
+  cache->count = 0;
+  for (int op = 0; op < 6; op++) {
+    for (int dir = 0; dir < 2; dir++) {
+      for (int a = 0; a < 3; a++) {
+        for (int b = 0; b < 3; b++, idx++) {
+          OperatorEntry *entry = &cache->ops[idx];
+
+          entry->type = (OpType) (op + 1);
+          if (!OidIsValid(entry->oid)) {
+            Oid leftType = (dir == 0) ? inexactTypes[a] : intTypes[a];
+            Oid rightType = (dir == 0) ? intTypes[b] : inexactTypes[b];
+
+            entry->oid = OpernameGetOprid(list_make1(makeString((char *) opNames[op])),
+                                          leftType, rightType);
+            if (OidIsValid(entry->oid)) {
+              entry->funcid = get_opcode(entry->oid);
+              entry->hashValue = GetSysCacheHashValue1(OPEROID,
+                                                       ObjectIdGetDatum(entry->oid));
+            }
+          }
+          if (OidIsValid(entry->oid)) {
+            cache->count++;
+          }
+        }
+      }
+    }
+  }
+
+  /* Rebuild the hash indexes (no catalog access) */
+  memset(cache->byFuncid, 0, sizeof(cache->byFuncid));
+  memset(cache->byOid, 0, sizeof(cache->byOid));
+  for (int i = 0; i < NUM2INT_OP_COUNT; i++) {
+    if (OidIsValid(cache->ops[i].oid)) {
+      insertOperatorIndex(cache->byFuncid, cache->ops[i].funcid, i);
+      insertOperatorIndex(cache->byOid, cache->ops[i].oid, i);
+    }
+  }
+
   /*
-   * Helper macro to add an operator to the cache.
-   * Looks up the operator by name and type pair, stores OID, funcid, and type.
-   * Only adds to cache if operator is found (OidIsValid).
+   * Runtime index key functions, indexed [kind][inexact type][integer type]
+   * (see inexactTypeIndex() and intTypeIndex()).
    */
-  #define ADD_OP(op_str, left_type, right_type, opType) \
-    do { \
-      Oid _oid = OpernameGetOprid(list_make1(makeString(op_str)), \
-                                  left_type, right_type); \
-      if (OidIsValid(_oid)) { \
-        cache->ops[cache->count].oid = _oid; \
-        cache->ops[cache->count].funcid = get_opcode(_oid); \
-        cache->ops[cache->count].type = opType; \
-        cache->count++; \
-      } \
-    } while(0)
-
-  /* Equality operators (=) - forward direction */
-  ADD_OP("=", NUMERICOID, INT2OID, OP_TYPE_EQ);
-  ADD_OP("=", NUMERICOID, INT4OID, OP_TYPE_EQ);
-  ADD_OP("=", NUMERICOID, INT8OID, OP_TYPE_EQ);
-  ADD_OP("=", FLOAT4OID, INT2OID, OP_TYPE_EQ);
-  ADD_OP("=", FLOAT4OID, INT4OID, OP_TYPE_EQ);
-  ADD_OP("=", FLOAT4OID, INT8OID, OP_TYPE_EQ);
-  ADD_OP("=", FLOAT8OID, INT2OID, OP_TYPE_EQ);
-  ADD_OP("=", FLOAT8OID, INT4OID, OP_TYPE_EQ);
-  ADD_OP("=", FLOAT8OID, INT8OID, OP_TYPE_EQ);
-  /* Equality operators (=) - commutator direction */
-  ADD_OP("=", INT2OID, NUMERICOID, OP_TYPE_EQ);
-  ADD_OP("=", INT2OID, FLOAT4OID, OP_TYPE_EQ);
-  ADD_OP("=", INT2OID, FLOAT8OID, OP_TYPE_EQ);
-  ADD_OP("=", INT4OID, NUMERICOID, OP_TYPE_EQ);
-  ADD_OP("=", INT4OID, FLOAT4OID, OP_TYPE_EQ);
-  ADD_OP("=", INT4OID, FLOAT8OID, OP_TYPE_EQ);
-  ADD_OP("=", INT8OID, NUMERICOID, OP_TYPE_EQ);
-  ADD_OP("=", INT8OID, FLOAT4OID, OP_TYPE_EQ);
-  ADD_OP("=", INT8OID, FLOAT8OID, OP_TYPE_EQ);
-
-  /* Inequality operators (<>) - forward direction */
-  ADD_OP("<>", NUMERICOID, INT2OID, OP_TYPE_NE);
-  ADD_OP("<>", NUMERICOID, INT4OID, OP_TYPE_NE);
-  ADD_OP("<>", NUMERICOID, INT8OID, OP_TYPE_NE);
-  ADD_OP("<>", FLOAT4OID, INT2OID, OP_TYPE_NE);
-  ADD_OP("<>", FLOAT4OID, INT4OID, OP_TYPE_NE);
-  ADD_OP("<>", FLOAT4OID, INT8OID, OP_TYPE_NE);
-  ADD_OP("<>", FLOAT8OID, INT2OID, OP_TYPE_NE);
-  ADD_OP("<>", FLOAT8OID, INT4OID, OP_TYPE_NE);
-  ADD_OP("<>", FLOAT8OID, INT8OID, OP_TYPE_NE);
-  /* Inequality operators (<>) - commutator direction */
-  ADD_OP("<>", INT2OID, NUMERICOID, OP_TYPE_NE);
-  ADD_OP("<>", INT2OID, FLOAT4OID, OP_TYPE_NE);
-  ADD_OP("<>", INT2OID, FLOAT8OID, OP_TYPE_NE);
-  ADD_OP("<>", INT4OID, NUMERICOID, OP_TYPE_NE);
-  ADD_OP("<>", INT4OID, FLOAT4OID, OP_TYPE_NE);
-  ADD_OP("<>", INT4OID, FLOAT8OID, OP_TYPE_NE);
-  ADD_OP("<>", INT8OID, NUMERICOID, OP_TYPE_NE);
-  ADD_OP("<>", INT8OID, FLOAT4OID, OP_TYPE_NE);
-  ADD_OP("<>", INT8OID, FLOAT8OID, OP_TYPE_NE);
-
-  /* Less than operators (<) - forward direction */
-  ADD_OP("<", NUMERICOID, INT2OID, OP_TYPE_LT);
-  ADD_OP("<", NUMERICOID, INT4OID, OP_TYPE_LT);
-  ADD_OP("<", NUMERICOID, INT8OID, OP_TYPE_LT);
-  ADD_OP("<", FLOAT4OID, INT2OID, OP_TYPE_LT);
-  ADD_OP("<", FLOAT4OID, INT4OID, OP_TYPE_LT);
-  ADD_OP("<", FLOAT4OID, INT8OID, OP_TYPE_LT);
-  ADD_OP("<", FLOAT8OID, INT2OID, OP_TYPE_LT);
-  ADD_OP("<", FLOAT8OID, INT4OID, OP_TYPE_LT);
-  ADD_OP("<", FLOAT8OID, INT8OID, OP_TYPE_LT);
-  /* Less than operators (<) - commutator direction */
-  ADD_OP("<", INT2OID, NUMERICOID, OP_TYPE_LT);
-  ADD_OP("<", INT2OID, FLOAT4OID, OP_TYPE_LT);
-  ADD_OP("<", INT2OID, FLOAT8OID, OP_TYPE_LT);
-  ADD_OP("<", INT4OID, NUMERICOID, OP_TYPE_LT);
-  ADD_OP("<", INT4OID, FLOAT4OID, OP_TYPE_LT);
-  ADD_OP("<", INT4OID, FLOAT8OID, OP_TYPE_LT);
-  ADD_OP("<", INT8OID, NUMERICOID, OP_TYPE_LT);
-  ADD_OP("<", INT8OID, FLOAT4OID, OP_TYPE_LT);
-  ADD_OP("<", INT8OID, FLOAT8OID, OP_TYPE_LT);
-
-  /* Greater than operators (>) - forward direction */
-  ADD_OP(">", NUMERICOID, INT2OID, OP_TYPE_GT);
-  ADD_OP(">", NUMERICOID, INT4OID, OP_TYPE_GT);
-  ADD_OP(">", NUMERICOID, INT8OID, OP_TYPE_GT);
-  ADD_OP(">", FLOAT4OID, INT2OID, OP_TYPE_GT);
-  ADD_OP(">", FLOAT4OID, INT4OID, OP_TYPE_GT);
-  ADD_OP(">", FLOAT4OID, INT8OID, OP_TYPE_GT);
-  ADD_OP(">", FLOAT8OID, INT2OID, OP_TYPE_GT);
-  ADD_OP(">", FLOAT8OID, INT4OID, OP_TYPE_GT);
-  ADD_OP(">", FLOAT8OID, INT8OID, OP_TYPE_GT);
-  /* Greater than operators (>) - commutator direction */
-  ADD_OP(">", INT2OID, NUMERICOID, OP_TYPE_GT);
-  ADD_OP(">", INT2OID, FLOAT4OID, OP_TYPE_GT);
-  ADD_OP(">", INT2OID, FLOAT8OID, OP_TYPE_GT);
-  ADD_OP(">", INT4OID, NUMERICOID, OP_TYPE_GT);
-  ADD_OP(">", INT4OID, FLOAT4OID, OP_TYPE_GT);
-  ADD_OP(">", INT4OID, FLOAT8OID, OP_TYPE_GT);
-  ADD_OP(">", INT8OID, NUMERICOID, OP_TYPE_GT);
-  ADD_OP(">", INT8OID, FLOAT4OID, OP_TYPE_GT);
-  ADD_OP(">", INT8OID, FLOAT8OID, OP_TYPE_GT);
-
-  /* Less than or equal operators (<=) - forward direction */
-  ADD_OP("<=", NUMERICOID, INT2OID, OP_TYPE_LE);
-  ADD_OP("<=", NUMERICOID, INT4OID, OP_TYPE_LE);
-  ADD_OP("<=", NUMERICOID, INT8OID, OP_TYPE_LE);
-  ADD_OP("<=", FLOAT4OID, INT2OID, OP_TYPE_LE);
-  ADD_OP("<=", FLOAT4OID, INT4OID, OP_TYPE_LE);
-  ADD_OP("<=", FLOAT4OID, INT8OID, OP_TYPE_LE);
-  ADD_OP("<=", FLOAT8OID, INT2OID, OP_TYPE_LE);
-  ADD_OP("<=", FLOAT8OID, INT4OID, OP_TYPE_LE);
-  ADD_OP("<=", FLOAT8OID, INT8OID, OP_TYPE_LE);
-  /* Less than or equal operators (<=) - commutator direction */
-  ADD_OP("<=", INT2OID, NUMERICOID, OP_TYPE_LE);
-  ADD_OP("<=", INT2OID, FLOAT4OID, OP_TYPE_LE);
-  ADD_OP("<=", INT2OID, FLOAT8OID, OP_TYPE_LE);
-  ADD_OP("<=", INT4OID, NUMERICOID, OP_TYPE_LE);
-  ADD_OP("<=", INT4OID, FLOAT4OID, OP_TYPE_LE);
-  ADD_OP("<=", INT4OID, FLOAT8OID, OP_TYPE_LE);
-  ADD_OP("<=", INT8OID, NUMERICOID, OP_TYPE_LE);
-  ADD_OP("<=", INT8OID, FLOAT4OID, OP_TYPE_LE);
-  ADD_OP("<=", INT8OID, FLOAT8OID, OP_TYPE_LE);
-
-  /* Greater than or equal operators (>=) - forward direction */
-  ADD_OP(">=", NUMERICOID, INT2OID, OP_TYPE_GE);
-  ADD_OP(">=", NUMERICOID, INT4OID, OP_TYPE_GE);
-  ADD_OP(">=", NUMERICOID, INT8OID, OP_TYPE_GE);
-  ADD_OP(">=", FLOAT4OID, INT2OID, OP_TYPE_GE);
-  ADD_OP(">=", FLOAT4OID, INT4OID, OP_TYPE_GE);
-  ADD_OP(">=", FLOAT4OID, INT8OID, OP_TYPE_GE);
-  ADD_OP(">=", FLOAT8OID, INT2OID, OP_TYPE_GE);
-  ADD_OP(">=", FLOAT8OID, INT4OID, OP_TYPE_GE);
-  ADD_OP(">=", FLOAT8OID, INT8OID, OP_TYPE_GE);
-  /* Greater than or equal operators (>=) - commutator direction */
-  ADD_OP(">=", INT2OID, NUMERICOID, OP_TYPE_GE);
-  ADD_OP(">=", INT2OID, FLOAT4OID, OP_TYPE_GE);
-  ADD_OP(">=", INT2OID, FLOAT8OID, OP_TYPE_GE);
-  ADD_OP(">=", INT4OID, NUMERICOID, OP_TYPE_GE);
-  ADD_OP(">=", INT4OID, FLOAT4OID, OP_TYPE_GE);
-  ADD_OP(">=", INT4OID, FLOAT8OID, OP_TYPE_GE);
-  ADD_OP(">=", INT8OID, NUMERICOID, OP_TYPE_GE);
-  ADD_OP(">=", INT8OID, FLOAT4OID, OP_TYPE_GE);
-  ADD_OP(">=", INT8OID, FLOAT8OID, OP_TYPE_GE);
-
-  #undef ADD_OP
+  if (resolved && !keyFuncsLoaded) {
+    static const char *const kindNames[NUM2INT_KEY_KIND_COUNT] = {
+      "eq", "lower", "upper"
+    };
+    static const char *const inexactNames[3] = {"numeric", "float4", "float8"};
+    static const char *const intNames[3] = {"int2", "int4", "int8"};
+
+    for (int k = 0; k < NUM2INT_KEY_KIND_COUNT; k++) {
+      for (int t = 0; t < 3; t++) {
+        for (int i = 0; i < 3; i++) {
+          Oid argtypes[2] = {inexactTypes[t], BOOLOID};
+          char *fname = psprintf("%s_%s_key_%s", inexactNames[t],
+                                 kindNames[k], intNames[i]);
+
+          cache->keyFuncs[k][t][i] =
+            LookupFuncName(list_make1(makeString(fname)),
+                           (k == NUM2INT_KEY_EQ) ? 1 : 2, argtypes, true);
+        }
+      }
+    }
+  }
 
   /* Switch back and delete temp context (frees all List/String nodes) */
   MemoryContextSwitchTo(oldcontext);
@@ -617,6 +922,7 @@ initOidCache(OperatorOidCache *cache) {
  */
 typedef struct {
   bool valid;            /**< True if conversion succeeded */
+  bool isSpecial;        /**< True if constant is NaN or +/-Infinity */
   bool hasFraction;      /**< True if constant has fractional part */
   bool outOfRangeHigh;   /**< True if floor exceeds integer type max */
   bool outOfRangeLow;    /**< True if floor is below integer type min */
@@ -629,26 +935,45 @@ typedef struct {
  * @param opType Output: operator type classification
  * @return Matching operator OID or InvalidOid
  *
- * Searches the cached operator OIDs to find one whose implementing function
- * matches the given function OID. This is used to identify which operator
- * is being called when the support function receives a function call.
+ * Looks up the cached operator whose implementing function matches the
+ * given function OID in the byFuncid hash index. This is used to identify
+ * which operator is being called when the support function receives a
+ * function call.
  */
 static Oid
 findOperatorByFuncid(Oid funcid, OpType *opType) {
+  OperatorEntry *entry;
 
   /* Initialize cache if needed */
   initOidCache(&oidCache);
 
-  /* Linear scan through the lookup array */
-  for (int i = 0; i < oidCache.count; i++) {
-    if (oidCache.ops[i].funcid == funcid) {
-      *opType = oidCache.ops[i].type;
-      return oidCache.ops[i].oid;
-    }
+  entry = lookupOperatorEntry(true, funcid);
+  if (entry == NULL) {
+    *opType = OP_TYPE_UNKNOWN;
+    return InvalidOid;
   }
 
-  *opType = OP_TYPE_UNKNOWN;
-  return InvalidOid;
+  *opType = entry->type;
+  return entry->oid;
+}
+
+/**
+ * @brief Find operator type from operator OID by searching cached operators
+ * @param opno Operator OID to match
+ * @return Operator type classification, or OP_TYPE_UNKNOWN if not cached
+ *
+ * Used by the selectivity estimator, which is called with the operator OID
+ * rather than the implementing function.
+ */
+static OpType
+findOpTypeByOid(Oid opno) {
+  OperatorEntry *entry;
+
+  /* Initialize cache if needed */
+  initOidCache(&oidCache);
+
+  entry = lookupOperatorEntry(false, opno);
+  return (entry != NULL) ? entry->type : OP_TYPE_UNKNOWN;
 }
 
 /**
@@ -662,6 +987,7 @@ static ConstConversion
 convertConstToInt(Const *constNode, Oid intType) {
   ConstConversion result = {
     .valid = false,
+    .isSpecial = false,
     .hasFraction = false,
     .outOfRangeHigh = false,
     .outOfRangeLow = false,
@@ -675,19 +1001,25 @@ convertConstToInt(Const *constNode, Oid intType) {
   }
 
   if (constType == NUMERICOID) {
-    Numeric num = DatumGetNumeric(constNode->constvalue);
+    Num2IntNumericInfo info;
+
+    decodeNumericHeader(DatumGetNumeric(constNode->constvalue), &info);
 
     /* Special value NaN, +Inf, -Inf */
-    if (NUM2INT_NUMERIC_IS_SPECIAL(num))
+    if (info.special != 0) {
+      result.isSpecial = true;
       return result;
+    }
 
     /* Check if value has fractional part */
-    result.hasFraction = !num2int_numeric_is_integral(num);
+    result.hasFraction = !info.isIntegral;
 
     /*
      * Extract floor value directly from digit array.
      */
-    if (numericFloorToInt64(num, &result.intVal)) {
+    decodeNumericValue(&info);
+    if (info.fitsInt64) {
+      result.intVal = info.floorVal;
       /* Check narrower ranges for int2/int4 */
       if (intType == INT2OID) {
         if (result.intVal < PG_INT16_MIN) {
@@ -714,7 +1046,7 @@ convertConstToInt(Const *constNode, Oid intType) {
        * Direct extraction failed - value is outside int64 range.
        * Determine direction using sign.
        */
-      if (num2int_numeric_sign(num) < 0)
+      if (info.sign < 0)
         result.outOfRangeLow = true;
       else
         result.outOfRangeHigh = true;
@@ -724,6 +1056,7 @@ convertConstToInt(Const *constNode, Oid intType) {
     float4 floorVal;
 
     if (isnan(fval) || isinf(fval)) {
+      result.isSpecial = true;
       return result;
     }
 
@@ -750,15 +1083,21 @@ convertConstToInt(Const *constNode, Oid intType) {
         result.valid = true;
       }
     } else if (intType == INT8OID) {
-      /* float4 always fits in int8 range */
-      result.intVal = (int64) floorVal;
-      result.valid = true;
+      if (floorVal < FLOAT4_INT64_MIN) {
+        result.outOfRangeLow = true;
+      } else if (floorVal >= FLOAT4_INT64_MAX) {
+        result.outOfRangeHigh = true;
+      } else {
+        result.intVal = (int64) floorVal;
+        result.valid = true;
+      }
     }
   } else if (constType == FLOAT8OID) {
     float8 dval = DatumGetFloat8(constNode->constvalue);
     float8 floorVal;
 
     if (isnan(dval) || isinf(dval)) {
+      result.isSpecial = true;
       return result;
     }
 
@@ -787,7 +1126,7 @@ convertConstToInt(Const *constNode, Oid intType) {
     } else if (intType == INT8OID) {
       if (floorVal < FLOAT8_INT64_MIN) {
         result.outOfRangeLow = true;
-      } else if (floorVal > FLOAT8_INT64_MAX) {
+      } else if (floorVal >= FLOAT8_INT64_MAX) {
         result.outOfRangeHigh = true;
       } else {
         result.intVal = (int64) floorVal;
@@ -800,21 +1139,10 @@ convertConstToInt(Const *constNode, Oid intType) {
 }
 
 /**
- * @brief Map integer type OID to lookup table index
- * @param intType Integer type OID (INT2OID, INT4OID, or INT8OID)
- * @return Index 0, 1, or 2 for int2, int4, int8 respectively
- */
-static inline int
-intTypeIndex(Oid intType) {
-  return (intType == INT2OID) ? 0 :
-         (intType == INT4OID) ? 1 : /* INT8OID */ 2;
-}
-
-/**
- * @brief Native operator OID lookup table [opType - 1][intTypeIndex]
- *
- * Indexed by (OpType - 1) for rows and intTypeIndex() for columns.
- * OP_TYPE_UNKNOWN (0) is handled separately before table lookup.
+ * @brief Native operator OID lookup table [opType - 1][intTypeIndex]
+ *
+ * Indexed by (OpType - 1) for rows and intTypeIndex() for columns.
+ * OP_TYPE_UNKNOWN (0) is handled separately before table lookup.
  */
 static const Oid NativeOpOids[6][3] = {
   /* OP_TYPE_EQ (1) */ { NUM2INT_INT2EQ_OID, NUM2INT_INT4EQ_OID, NUM2INT_INT8EQ_OID },
@@ -838,6 +1166,47 @@ getNativeOpOid(OpType opType, Oid intType) {
   return NativeOpOids[opType - 1][intTypeIndex(intType)];
 }
 
+/**
+ * @brief Native inexact-type operator OID lookup table [opType - 1][inexactTypeIndex]
+ */
+static const Oid NativeInexactOpOids[6][3] = {
+  /* OP_TYPE_EQ (1) */ { NUM2INT_NUMERICEQ_OID, NUM2INT_FLOAT4EQ_OID, NUM2INT_FLOAT8EQ_OID },
+  /* OP_TYPE_NE (2) */ { NUM2INT_NUMERICNE_OID, NUM2INT_FLOAT4NE_OID, NUM2INT_FLOAT8NE_OID },
+  /* OP_TYPE_LT (3) */ { NUM2INT_NUMERICLT_OID, NUM2INT_FLOAT4LT_OID, NUM2INT_FLOAT8LT_OID },
+  /* OP_TYPE_GT (4) */ { NUM2INT_NUMERICGT_OID, NUM2INT_FLOAT4GT_OID, NUM2INT_FLOAT8GT_OID },
+  /* OP_TYPE_LE (5) */ { NUM2INT_NUMERICLE_OID, NUM2INT_FLOAT4LE_OID, NUM2INT_FLOAT8LE_OID },
+  /* OP_TYPE_GE (6) */ { NUM2INT_NUMERICGE_OID, NUM2INT_FLOAT4GE_OID, NUM2INT_FLOAT8GE_OID },
+};
+
+/**
+ * @brief Get native operator OID for given operator type and inexact type
+ * @param opType Operator type classification
+ * @param inexactType numeric, float4 or float8 type OID
+ * @return Native operator OID for same-type comparison
+ */
+static Oid
+getNativeInexactOpOid(OpType opType, Oid inexactType) {
+  if (opType == OP_TYPE_UNKNOWN)
+    return InvalidOid;
+  return NativeInexactOpOids[opType - 1][inexactTypeIndex(inexactType)];
+}
+
+/**
+ * @brief Create a numeric, float4 or float8 constant node
+ * @param inexactType Type OID
+ * @param value Datum of that type
+ * @return New Const node
+ */
+static Const *
+makeInexactConst(Oid inexactType, Datum value) {
+  int16 typLen;
+  bool typByVal;
+
+  get_typlenbyval(inexactType, &typLen, &typByVal);
+  return makeConst(inexactType, -1, InvalidOid, typLen, value, false,
+                   typByVal);
+}
+
 /**
  * @brief Create an integer constant node
  * @param intType Integer type OID
@@ -863,7 +1232,7 @@ makeIntConst(Oid intType, int64 intVal) {
 /**
  * @brief Build transformed OpExpr using native integer operator
  * @param nativeOpOid Native operator OID
- * @param varNode Variable node (will be copied)
+ * @param operand Integer-typed operand (will be copied)
  * @param intVal Integer constant value
  * @param intType Integer type OID
  * @param location Source location for new expression
@@ -871,15 +1240,15 @@ makeIntConst(Oid intType, int64 intVal) {
  * @return New OpExpr node
  */
 static OpExpr *
-buildNativeOpExpr(Oid nativeOpOid, Var *varNode, int64 intVal,
+buildNativeOpExpr(Oid nativeOpOid, Node *operand, int64 intVal,
                   Oid intType, int location, Oid inputcollid) {
-  Var *newVar = (Var *) copyObject(varNode);
+  Node *newOperand = (Node *) copyObject(operand);
   Const *newConst = makeIntConst(intType, intVal);
 
   OpExpr *newClause = (OpExpr *) make_opclause(nativeOpOid,
                                                 BOOLOID,
                                                 false,
-                                                (Expr *) newVar,
+                                                (Expr *) newOperand,
                                                 (Expr *) newConst,
                                                 InvalidOid,
                                                 InvalidOid);
@@ -948,1996 +1317,6700 @@ computeRangeTransform(OpType opType, Oid intType, int64 intVal,
   return getNativeOpOid(opType, intType);
 }
 
-/*
- * ============================================================================
- * Main Support Function
- * ============================================================================
+/**
+ * @brief Swap the operand order of an operator type
+ * @param opType Operator type for "left op right"
+ * @return Operator type for "right op left"
+ *
+ * Used when the integer operand is on the right-hand side, so that the
+ * classification always reads as "intExpr op constant".
  */
+static OpType
+commuteOpType(OpType opType) {
+  switch (opType) {
+  case OP_TYPE_LT:
+    return OP_TYPE_GT;
+  case OP_TYPE_GT:
+    return OP_TYPE_LT;
+  case OP_TYPE_LE:
+    return OP_TYPE_GE;
+  case OP_TYPE_GE:
+    return OP_TYPE_LE;
+  default:
+    /* =, <> and unknown are symmetric */
+    return opType;
+  }
+}
 
 /**
- * @brief Support function for query optimization via SupportRequestSimplify
- * @param fcinfo Function call context
- * @return Node pointer for simplified expression or NULL
+ * @brief Map a converted constant onto an equivalent native integer predicate
+ * @param opType Operator type, oriented as "intExpr op constant"
+ * @param intType Integer type OID of the non-constant operand
+ * @param conv Result of convertConstToInt() for the constant
+ * @param intVal Output: integer constant for the native predicate
+ * @param isAlwaysTrue Output: predicate holds for every non-NULL integer
+ * @param isAlwaysFalse Output: predicate holds for no integer
+ * @return Native operator OID, or InvalidOid if the result is constant
+ *         or the constant cannot be mapped (NaN, Infinity)
  *
- * Simplifies constant predicates during query planning:
- * - Equality with fractional value → FALSE (no integer can equal a fraction)
- * - Equality with exact integer → native integer operator (enables index use)
- * - Range with fraction → adjusted boundary (e.g., > 10.5 becomes >= 11)
- * - Out-of-range constants → TRUE/FALSE based on operator semantics
- *
- * Index optimization works because transformed expressions use native integer
- * operators which the planner automatically recognizes for btree index scans.
+ * Shared by the SupportRequestSimplify rewrite and the selectivity estimator
+ * so that both see the same integer-domain predicate:
+ * - FR-015: Equality with fractional value → FALSE
+ * - FR-016: Equality with exact integer → native operator
+ * - FR-017: Range with fraction → adjusted boundary
  */
-PG_FUNCTION_INFO_V1(num2int_support);
-Datum
-num2int_support(PG_FUNCTION_ARGS) {
-  Node *rawreq = (Node *) PG_GETARG_POINTER(0);
-  Node *ret = NULL;
-
-  /* Initialize OID cache on first use */
-  initOidCache(&oidCache);
+static Oid
+computeIntPredicate(OpType opType, Oid intType, const ConstConversion *conv,
+                    int64 *intVal, bool *isAlwaysTrue, bool *isAlwaysFalse) {
+  *intVal = conv->intVal;
+  *isAlwaysTrue = false;
+  *isAlwaysFalse = false;
 
-  if (IsA(rawreq, SupportRequestSimplify)) {
+  /* Handle out-of-range constants */
+  if (conv->outOfRangeHigh || conv->outOfRangeLow) {
     /*
-     * SupportRequestSimplify: Transform constant predicates at simplification time
-     *
-     * - FR-015: Equality with fractional value → FALSE
-     * - FR-016: Equality with exact integer → native operator
-     * - FR-017: Range with fraction → adjusted boundary
+     * Constant is outside the range of the integer type.
+     * We can determine the result based on operator type:
+     * - EQ: always FALSE (no integer can equal an out-of-range value)
+     * - NE: always TRUE (every integer differs from an out-of-range value)
+     * - LT/LE: TRUE if const is high, FALSE if const is low
+     * - GT/GE: FALSE if const is high, TRUE if const is low
      */
-    SupportRequestSimplify *req = (SupportRequestSimplify *) rawreq;
-    FuncExpr *func = req->fcall;
-    Node *leftop;
-    Node *rightop;
-    Var *varNode = NULL;
-    Const *constNode = NULL;
-    OpType opType;
-    Oid opno;
-    Oid intType;
-    ConstConversion conv;
-
-    /* Check if support functions are disabled via GUC */
-    if (!enableSupportFunctions) {
-      elog(DEBUG1, "SupportRequestSimplify disabled by pg_num2int_direct_comp.enableSupportFunctions");
-      PG_RETURN_POINTER(NULL);
+    switch (opType) {
+      case OP_TYPE_EQ:
+        *isAlwaysFalse = true;
+        break;
+      case OP_TYPE_NE:
+        *isAlwaysTrue = true;
+        break;
+      case OP_TYPE_LT:
+      case OP_TYPE_LE:
+        /* intCol < hugeValue is always TRUE; intCol < tinyValue is always FALSE */
+        *isAlwaysTrue = conv->outOfRangeHigh;
+        *isAlwaysFalse = conv->outOfRangeLow;
+        break;
+      case OP_TYPE_GT:
+      case OP_TYPE_GE:
+        /* intCol > tinyValue is always TRUE; intCol > hugeValue is always FALSE */
+        *isAlwaysTrue = conv->outOfRangeLow;
+        *isAlwaysFalse = conv->outOfRangeHigh;
+        break;
+      default:
+        break;
     }
+    return InvalidOid;
+  }
 
-    elog(DEBUG1, "SupportRequestSimplify called for function %u", func->funcid);
+  if (!conv->valid) {
+    return InvalidOid;
+  }
 
-    if (list_length(func->args) != 2) {
-      PG_RETURN_POINTER(NULL);
+  if (opType == OP_TYPE_EQ) {
+    if (conv->hasFraction) {
+      /* FR-015: Equality with fractional value is always FALSE */
+      *isAlwaysFalse = true;
+      return InvalidOid;
     }
+    /* FR-016: Equality with exact integer - native operator */
+    return getNativeOpOid(OP_TYPE_EQ, intType);
+  }
 
-    leftop = (Node *) linitial(func->args);
-    rightop = (Node *) lsecond(func->args);
-
-    /* Identify Var and Const positions and determine their types */
-    if (IsA(leftop, Const) && IsA(rightop, Var)) {
-      constNode = (Const *) leftop;
-      varNode = (Var *) rightop;
-    } else if (IsA(leftop, Var) && IsA(rightop, Const)) {
-      varNode = (Var *) leftop;
-      constNode = (Const *) rightop;
-    } else {
-      PG_RETURN_POINTER(NULL);
+  if (opType == OP_TYPE_NE) {
+    if (conv->hasFraction) {
+      /* Inequality with fractional value is always TRUE */
+      *isAlwaysTrue = true;
+      return InvalidOid;
     }
+    return getNativeOpOid(OP_TYPE_NE, intType);
+  }
 
-    if (constNode->constisnull) {
-      PG_RETURN_POINTER(NULL);
-    }
+  /* FR-017: Range boundary transformation */
+  return computeRangeTransform(opType, intType, conv->intVal,
+                               conv->hasFraction, intVal,
+                               isAlwaysTrue, isAlwaysFalse);
+}
 
-    /* Find the operator that uses this function */
-    opno = findOperatorByFuncid(func->funcid, &opType);
-    if (opno == InvalidOid) {
-      PG_RETURN_POINTER(NULL);
-    }
+/**
+ * @brief Map an integer constant onto an equivalent native inexact predicate
+ * @param opType Operator type, oriented as "inexactExpr op constant"
+ * @param inexactType Type OID of the non-constant operand
+ * @param intVal Integer constant
+ * @param value Output: constant of inexactType for the native predicate
+ * @param isAlwaysTrue Output: predicate holds for every non-NULL value
+ * @param isAlwaysFalse Output: predicate holds for no value
+ * @return Native operator OID, or InvalidOid if the result is constant
+ *
+ * Mirror of computeIntPredicate() for "inexact_col op int_const". numeric
+ * holds every integer exactly. An integer a float type cannot represent
+ * (float4 beyond 2^24, float8 beyond 2^53) lies strictly between two adjacent
+ * floats below < intVal < above, so:
+ * - Equality → FALSE, inequality → TRUE (for non-NULL values; the caller
+ *   keeps NULL for a NULL column)
+ * - col < intVal, col <= intVal → col <= below
+ * - col > intVal, col >= intVal → col >= above
+ * NaN sorts above every integer in both the cross-type and the native
+ * operators, so the native predicate gives the same result for it.
+ */
+static Oid
+computeInexactPredicate(OpType opType, Oid inexactType, int64 intVal,
+                        Datum *value, bool *isAlwaysTrue,
+                        bool *isAlwaysFalse) {
+  bool exact;
+  bool roundedUp = false;
+  float8 below = 0;
+  float8 above = 0;
 
-    /* Convert constant to integer */
-    intType = varNode->vartype;
-    conv = convertConstToInt(constNode, intType);
+  *isAlwaysTrue = false;
+  *isAlwaysFalse = false;
 
-    elog(DEBUG1,
-       "SupportRequestSimplify: constType=%u, varType=%u, valid=%d, "
-       "hasFraction=%d, outOfRangeLow=%d, outOfRangeHigh=%d, "
-       "intVal=%ld",
-       constNode->consttype, varNode->vartype, conv.valid,
-       conv.hasFraction, conv.outOfRangeLow, conv.outOfRangeHigh,
-       conv.intVal);
+  if (opType == OP_TYPE_UNKNOWN) {
+    return InvalidOid;
+  }
 
-    /* Handle out-of-range constants */
-    if (conv.outOfRangeHigh || conv.outOfRangeLow) {
-      /*
-       * Constant is outside the range of the integer type.
-       * We can determine the result based on operator type:
-       * - EQ: always FALSE (no integer can equal an out-of-range value)
-       * - NE: always TRUE (every integer differs from an out-of-range value)
-       * - LT/LE: TRUE if const is high, FALSE if const is low
-       * - GT/GE: FALSE if const is high, TRUE if const is low
-       */
-      switch (opType) {
-        case OP_TYPE_EQ:
-          ret = (Node *) makeBoolConst(false, false);
-          break;
-        case OP_TYPE_NE:
-          ret = (Node *) makeBoolConst(true, false);
-          break;
-        case OP_TYPE_LT:
-        case OP_TYPE_LE:
-          /* intCol < hugeValue is always TRUE; intCol < tinyValue is always FALSE */
-          ret = (Node *) makeBoolConst(conv.outOfRangeHigh, false);
-          break;
-        case OP_TYPE_GT:
-        case OP_TYPE_GE:
-          /* intCol > tinyValue is always TRUE; intCol > hugeValue is always FALSE */
-          ret = (Node *) makeBoolConst(conv.outOfRangeLow, false);
-          break;
-        default:
-          break;
-      }
-      PG_RETURN_POINTER(ret);
-    }
+  if (inexactType == NUMERICOID) {
+    *value = DirectFunctionCall1(int8_numeric, Int64GetDatum(intVal));
+    return getNativeInexactOpOid(opType, NUMERICOID);
+  }
 
-    if (!conv.valid) {
-      PG_RETURN_POINTER(NULL);
+  /* (float) PG_INT64_MAX rounds up to 2^63, which must not be cast back */
+  if (inexactType == FLOAT4OID) {
+    float4 f = (float4) intVal;
+
+    roundedUp = f >= FLOAT4_INT64_MAX || (int64) f > intVal;
+    exact = !roundedUp && (int64) f == intVal;
+    if (exact) {
+      *value = Float4GetDatum(f);
+    } else {
+      below = roundedUp ? nextafterf(f, -INFINITY) : f;
+      above = roundedUp ? f : nextafterf(f, INFINITY);
     }
+  } else {
+    float8 f = (float8) intVal;
 
-    /* Apply transformation based on operator type and fractional status */
-    if (opType == OP_TYPE_EQ) {
-      if (conv.hasFraction) {
-        /* FR-015: Equality with fractional value is always FALSE */
-        ret = (Node *) makeBoolConst(false, false);
-      } else {
-        /* FR-016: Equality with exact integer - transform to native operator */
-        Oid nativeOpOid = getNativeOpOid(OP_TYPE_EQ, intType);
-        ret = (Node *) buildNativeOpExpr(nativeOpOid, varNode, conv.intVal,
-                                         intType, func->location, InvalidOid);
-      }
-    } else if (opType == OP_TYPE_NE) {
-      if (conv.hasFraction) {
-        /* Inequality with fractional value is always TRUE */
-        ret = (Node *) makeBoolConst(true, false);
-      } else {
-        /* Transform to native inequality operator */
-        Oid nativeOpOid = getNativeOpOid(OP_TYPE_NE, intType);
-        ret = (Node *) buildNativeOpExpr(nativeOpOid, varNode, conv.intVal,
-                                         intType, func->location, InvalidOid);
-      }
+    roundedUp = f >= FLOAT8_INT64_MAX || (int64) f > intVal;
+    exact = !roundedUp && (int64) f == intVal;
+    if (exact) {
+      *value = Float8GetDatum(f);
     } else {
-      /* FR-017: Range boundary transformation */
-      int64 adjustedVal;
-      bool isAlwaysTrue, isAlwaysFalse;
-      Oid nativeOpOid = computeRangeTransform(opType, intType, conv.intVal,
-                                              conv.hasFraction, &adjustedVal,
-                                              &isAlwaysTrue, &isAlwaysFalse);
-      if (isAlwaysTrue) {
-        ret = (Node *) makeBoolConst(true, false);
-      } else if (isAlwaysFalse) {
-        ret = (Node *) makeBoolConst(false, false);
-      } else {
-        ret = (Node *) buildNativeOpExpr(nativeOpOid, varNode, adjustedVal,
-                                         intType, func->location, InvalidOid);
-      }
+      below = roundedUp ? nextafter(f, -INFINITY) : f;
+      above = roundedUp ? f : nextafter(f, INFINITY);
     }
   }
 
-  PG_RETURN_POINTER(ret);
+  if (exact) {
+    return getNativeInexactOpOid(opType, inexactType);
+  }
+
+  switch (opType) {
+    case OP_TYPE_EQ:
+      *isAlwaysFalse = true;
+      return InvalidOid;
+    case OP_TYPE_NE:
+      *isAlwaysTrue = true;
+      return InvalidOid;
+    case OP_TYPE_LT:
+    case OP_TYPE_LE:
+      *value = (inexactType == FLOAT4OID) ? Float4GetDatum((float4) below)
+                                          : Float8GetDatum(below);
+      return getNativeInexactOpOid(OP_TYPE_LE, inexactType);
+    case OP_TYPE_GT:
+    case OP_TYPE_GE:
+    default:
+      *value = (inexactType == FLOAT4OID) ? Float4GetDatum((float4) above)
+                                          : Float8GetDatum(above);
+      return getNativeInexactOpOid(OP_TYPE_GE, inexactType);
+  }
 }
 
 /*
- * Core comparison functions (9 total)
- *
- * These functions implement the actual comparison logic, returning:
- *   -1 if left < right
- *    0 if left == right
- *    1 if left > right
- *
- * Implementation converts integer to numeric/float and uses native comparison
- * to avoid calling internal PostgreSQL functions that may not be exported.
+ * ============================================================================
+ * Runtime Index Keys
+ * ============================================================================
+ * Comparisons against values that are only known at execution time (Params
+ * of generic plans, stable expressions) cannot be folded at plan time. They
+ * are rewritten to native integer comparisons against a key function of the
+ * value, which btree evaluates once per scan as a runtime index key:
+ *   int_col = $1    →  int_col = numeric_eq_key_int4($1)
+ *   int_col > $1    →  int_col >= numeric_lower_key_int4($1, false)
+ *   int_col <= $1   →  int_col <= numeric_upper_key_int4($1, true)
+ * A NULL key (fraction for =, out of range, NaN) matches no row, where the
+ * original comparison is FALSE. The two only agree in a qualification, so
+ * the planner hook applies the rewrite to WHERE/ON conjunctions only (see
+ * runtimeKeyQuals()).
  */
 
 /**
- * @brief Compare numeric value with int64 value using direct structure access
- * @param num Numeric value (left operand)
- * @param val int64 value (right operand)
- * @return -1 if num < val, 0 if num == val, 1 if num > val
+ * @brief Compute the integer key equivalent to comparing with a value
+ * @param kind Key kind (=, >= or <= against the result)
+ * @param inclusive For LOWER/UPPER: original operator was >= / <= (vs > / <)
+ * @param value Inexact value
+ * @param valueType Type of value (NUMERICOID, FLOAT4OID, FLOAT8OID)
+ * @param intType Integer type of the compared expression
+ * @param key Output: integer key
+ * @return false if no integer of intType satisfies the comparison
  *
- * This optimized version avoids int64_to_numeric() and OidFunctionCall overhead
- * by directly inspecting the Numeric structure.
+ * Values beyond the integer range on the always-true side are clamped to the
+ * type bound, so that "int_col > -1e30" still matches every non-NULL row.
+ * NaN sorts above every integer, like +Infinity.
  */
-static int
-numericCmpInt64Direct(Numeric num, int64 val)
-{
-  int numSign;
-  int valSign;
-  int64 numAsInt64;
-
-  /* Handle special values first */
-  if (NUM2INT_NUMERIC_IS_SPECIAL(num)) {
-    if (NUM2INT_NUMERIC_IS_NAN(num))
-      return 1;  /* NaN > everything for consistent ordering */
-    if (NUM2INT_NUMERIC_IS_PINF(num))
-      return 1;  /* +Inf > any integer */
-    /* -Inf */
-    return -1;   /* -Inf < any integer */
-  }
-
-  /* Get signs for quick comparison */
-  numSign = num2int_numeric_sign(num);
-  valSign = (val > 0) ? 1 : ((val < 0) ? -1 : 0);
-
-  /* Different signs - easy comparison */
-  if (numSign != valSign) {
-    if (numSign < valSign)
-      return -1;
-    // (numSign > valSign)
-    return 1;
+static bool
+computeIntKey(Num2IntKeyKind kind, bool inclusive, Datum value,
+              Oid valueType, Oid intType, int64 *key) {
+  Const valueConst;
+  ConstConversion conv;
+  int64 typeMin, typeMax;
+  int special = 0;   /* 1 for NaN/+Infinity, -1 for -Infinity */
+
+  if (intType == INT2OID) {
+    typeMin = PG_INT16_MIN;
+    typeMax = PG_INT16_MAX;
+  } else if (intType == INT4OID) {
+    typeMin = PG_INT32_MIN;
+    typeMax = PG_INT32_MAX;
+  } else {
+    typeMin = PG_INT64_MIN;
+    typeMax = PG_INT64_MAX;
   }
 
-  /* Both zero */
-  if (numSign == 0)
-    return 0;
+  if (valueType == NUMERICOID) {
+    Numeric num = DatumGetNumeric(value);
 
-  /* Try direct int64 extraction */
-  if (numericToint64(num, &numAsInt64)) {
-    /* Successfully converted - simple integer comparison */
-    if (numAsInt64 < val)
-      return -1;
-    if (numAsInt64 > val)
-      return 1;
-    return 0;
+    if (NUM2INT_NUMERIC_IS_SPECIAL(num))
+      special = NUM2INT_NUMERIC_IS_NINF(num) ? -1 : 1;
+  } else if (valueType == FLOAT4OID) {
+    float4 fval = DatumGetFloat4(value);
+
+    if (isnan(fval))
+      special = 1;
+    else if (isinf(fval))
+      special = (fval > 0) ? 1 : -1;
+  } else {
+    float8 dval = DatumGetFloat8(value);
+
+    if (isnan(dval))
+      special = 1;
+    else if (isinf(dval))
+      special = (dval > 0) ? 1 : -1;
   }
 
-  /*
-   * Numeric is either:
-   * 1. Out of int64 range (huge), or
-   * 2. Has fractional part
-   *
-   * For case 1: sign already tells us the answer
-   * For case 2: we need more careful comparison
-   */
-  if (num2int_numeric_is_integral(num)) {
-    /* Huge integral value - sign determines result */
-    return numSign;  /* positive huge > val, negative huge < val */
+  if (special != 0) {
+    switch (kind) {
+      case NUM2INT_KEY_LOWER:
+        /* int_col > -Infinity holds for every integer */
+        *key = typeMin;
+        return special < 0;
+      case NUM2INT_KEY_UPPER:
+        /* int_col < NaN / +Infinity holds for every integer */
+        *key = typeMax;
+        return special > 0;
+      default:
+        return false;
+    }
   }
 
-  /*
-   * Has fractional part. Compute floor locally by extracting only integral digits.
-   * For negative numbers with fractional part, floor = trunc - 1.
-   */
-  {
-    int weight = NUM2INT_NUMERIC_WEIGHT(num);
-    Num2IntNumericDigit *digits = NUM2INT_NUMERIC_DIGITS(num);
-    int ndigits = NUM2INT_NUMERIC_NDIGITS(num);
-    int integralNdigits;
-    int64 floorVal;
-    int i;
+  memset(&valueConst, 0, sizeof(valueConst));
+  valueConst.xpr.type = T_Const;
+  valueConst.consttype = valueType;
+  valueConst.constvalue = value;
+  valueConst.constisnull = false;
+  conv = convertConstToInt(&valueConst, intType);
 
-    /*
-     * If weight > 4, the integral part exceeds int64 range.
-     * (weight 5 means 10000^5 = 10^20, but int64 max is ~9.2e18)
-     * Fall back to sign-based comparison for huge values.
-     */
-    if (weight > 4)
-      return numSign;
+  if (conv.outOfRangeHigh) {
+    *key = typeMax;
+    return kind == NUM2INT_KEY_UPPER;
+  }
+  if (conv.outOfRangeLow) {
+    *key = typeMin;
+    return kind == NUM2INT_KEY_LOWER;
+  }
+  if (!conv.valid) {
+    return false;
+  }
 
-    /* Number of integral digits is weight + 1 */
-    integralNdigits = weight + 1;
-    if (integralNdigits <= 0) {
-      /*
-       * No integral digits (e.g., 0.5 has weight=-1).
-       * floor(positive fraction) = 0, floor(negative fraction) = -1
-       */
-      floorVal = (numSign > 0) ? 0 : -1;
-    } else {
-      /* Extract integral portion (padding with zeros if ndigits < integralNdigits) */
-      floorVal = 0;
-      for (i = 0; i < integralNdigits; i++) {
-        Num2IntNumericDigit digit = (i < ndigits) ? digits[i] : 0;
-
-        /* Overflow check for multiplication */
-        if (floorVal > PG_INT64_MAX / NUM2INT_NBASE)
-          return numSign;  /* Huge value */
-        floorVal = floorVal * NUM2INT_NBASE;
-
-        /* Overflow check for addition */
-        if (digit > PG_INT64_MAX - floorVal)
-          return numSign;  /* Huge value */
-        floorVal += digit;
+  switch (kind) {
+    case NUM2INT_KEY_EQ:
+      /* FR-015: no integer equals a fraction */
+      *key = conv.intVal;
+      return !conv.hasFraction;
+    case NUM2INT_KEY_LOWER:
+      /* Smallest integer > value (>= value if inclusive) */
+      if (inclusive && !conv.hasFraction) {
+        *key = conv.intVal;
+        return true;
       }
-
-      /* Apply sign */
-      if (numSign < 0) {
-        /*
-         * For negative with fractional part: floor = -trunc - 1
-         * e.g., floor(-100.5) = -101, not -100
-         *
-         * No overflow: floorVal <= PG_INT64_MAX from loop checks, so
-         * -floorVal >= -PG_INT64_MAX = PG_INT64_MIN + 1, and
-         * -floorVal - 1 >= PG_INT64_MIN (exactly representable).
-         */
-        floorVal = -floorVal - 1;
+      if (conv.intVal >= typeMax) {
+        return false;
       }
-    }
-
-    /* Compare floorVal compensated with fractional part with val */
-    if (floorVal < val)
-      return -1;
-    /* (floorVal > val) ... not equal here, that was handled above */
-    return 1;
+      *key = conv.intVal + 1;
+      return true;
+    case NUM2INT_KEY_UPPER:
+      /* Largest integer < value (<= value if inclusive) */
+      if (inclusive || conv.hasFraction) {
+        *key = conv.intVal;
+        return true;
+      }
+      if (conv.intVal <= typeMin) {
+        return false;
+      }
+      *key = conv.intVal - 1;
+      return true;
   }
+
+  return false;
 }
 
 /**
- * @brief Check equality of numeric with int64 - optimized for early-out
- * @param num Numeric value
- * @param val int64 value
- * @return true if num == val exactly, false otherwise
- *
- * Optimized equality check that avoids floor extraction for non-equal cases:
- * - NaN/Inf: immediately false (never equal to integers)
- * - Different signs: immediately false
- * - Fractional values: immediately false (can't equal an integer)
- * - Out-of-range: immediately false (extraction fails)
+ * @brief Find nodes that prevent an expression from being a runtime key
  */
 static bool
-numericEqInt64Direct(Numeric num, int64 val) {
-  int64 numAsInt64;
-  int numSign, valSign;
-
-  // NaN/Inf never equal integers
-  if (NUM2INT_NUMERIC_IS_SPECIAL(num))
-    return false;
-
-  // Sign check - different signs can't be equal
-  numSign = num2int_numeric_sign(num);
-  valSign = (val > 0) ? 1 : ((val < 0) ? -1 : 0);
-  if (numSign != valSign)
+runtimeKeyDisallowedWalker(Node *node, void *context) {
+  if (node == NULL) {
     return false;
-
-  // Both zero
-  if (numSign == 0)
+  }
+  if (IsA(node, Var) || IsA(node, PlaceHolderVar) || IsA(node, SubLink) ||
+      IsA(node, SubPlan) || IsA(node, AlternativeSubPlan) ||
+      IsA(node, Aggref) || IsA(node, WindowFunc) ||
+      IsA(node, GroupingFunc) || IsA(node, CurrentOfExpr)) {
     return true;
-
-  // Try extraction - fails for fractions and out-of-range → not equal
-  if (!numericToint64(num, &numAsInt64))
-    return false;
-
-  return numAsInt64 == val;
+  }
+  return expression_tree_walker(node, runtimeKeyDisallowedWalker, context);
 }
 
 /**
- * @brief Compare numeric value with int2 value
- * @param num Numeric value (left operand)
- * @param val int2 value (right operand)
- * @return -1 if num < val, 0 if num == val, 1 if num > val
+ * @brief Check whether an expression can serve as a runtime index key
+ * @param node Operand expression
+ * @return true if the expression is inexact-typed, not a Const, and constant
+ *         within a single scan (no Vars, sublinks, aggregates, or volatile
+ *         functions)
  */
-int
-numeric_cmp_int2_internal(Numeric num, int16 val) {
-  return numericCmpInt64Direct(num, (int64)val);
-}
+static bool
+isRuntimeKeyExpr(Node *node) {
+  Oid type = exprType(node);
 
-/**
- * @brief Compare numeric value with int4 value
- * @param num Numeric value (left operand)
- * @param val int4 value (right operand)
- * @return -1 if num < val, 0 if num == val, 1 if num > val
- */
-int
-numeric_cmp_int4_internal(Numeric num, int32 val) {
-  return numericCmpInt64Direct(num, (int64)val);
+  if (IsA(node, Const)) {
+    return false;
+  }
+  if (type != NUMERICOID && type != FLOAT4OID && type != FLOAT8OID) {
+    return false;
+  }
+  return !runtimeKeyDisallowedWalker(node, NULL) &&
+         !contain_volatile_functions(node);
 }
 
 /**
- * @brief Compare numeric value with int8 value
+ * @brief Check whether an expression can take the place of a column
+ * @param node Operand expression
+ * @return true if the expression is not a Const and has no volatile functions
+ *
+ * Rewrites keep the operand as is and only replace the operator and the
+ * comparand, so columns, coercions (RelabelType), arithmetic and expression
+ * index keys all qualify; the native operator then lets expression indexes
+ * and partial-index predicates match.
  */
-int
-numeric_cmp_int8_internal(Numeric num, int64 val) {
-  return numericCmpInt64Direct(num, val);
+static bool
+isComparisonOperand(Node *node) {
+  return !IsA(node, Const) && !contain_volatile_functions(node);
 }
 
 /**
- * @brief Compare float4 value with int2 value
+ * @brief Build "intExpr op key(expr)" for a runtime-valued comparand
+ * @param opType Operator type, oriented as "operand op keyExpr"
+ * @param operand Integer-typed operand (see isComparisonOperand())
+ * @param keyExpr Runtime-valued inexact operand (see isRuntimeKeyExpr())
+ * @param location Source location for new expression
+ * @return New native OpExpr, or NULL if the comparison is not rewritten
+ *
+ * <> is left alone: it is never an index key.
  */
-int
-float4_cmp_int2_internal(float4 fval, int16 ival) {
-  float4 ivalAsFloat4;
-
-  /* Handle NaN - NaN never equals anything */
-  if (isnan(fval)) {
-    return 1;  /* Treat NaN as greater for consistent ordering */
+static Node *
+buildRuntimeKeyPredicate(OpType opType, Node *operand, Node *keyExpr,
+                         int location) {
+  Oid intType = exprType(operand);
+  Oid keyType = exprType(keyExpr);
+  Num2IntKeyKind kind;
+  OpType nativeOpType;
+  bool inclusive = true;
+  Oid keyFunc;
+  List *keyArgs;
+  FuncExpr *keyCall;
+  OpExpr *newClause;
+
+  if (intType != INT2OID && intType != INT4OID && intType != INT8OID) {
+    return NULL;
   }
 
-  /* Handle infinity */
-  if (isinf(fval)) {
-    return (fval > 0) ? 1 : -1;
+  switch (opType) {
+    case OP_TYPE_EQ:
+      kind = NUM2INT_KEY_EQ;
+      nativeOpType = OP_TYPE_EQ;
+      break;
+    case OP_TYPE_GT:
+      inclusive = false;
+      /* FALLTHROUGH */
+    case OP_TYPE_GE:
+      kind = NUM2INT_KEY_LOWER;
+      nativeOpType = OP_TYPE_GE;
+      break;
+    case OP_TYPE_LT:
+      inclusive = false;
+      /* FALLTHROUGH */
+    case OP_TYPE_LE:
+      kind = NUM2INT_KEY_UPPER;
+      nativeOpType = OP_TYPE_LE;
+      break;
+    default:
+      return NULL;
   }
 
-  /* Convert integer to float4 and compare */
-  ivalAsFloat4 = (float4)ival;
+  keyFunc = oidCache.keyFuncs[kind][inexactTypeIndex(keyType)][intTypeIndex(intType)];
+  if (!OidIsValid(keyFunc)) {
+    return NULL;
+  }
 
-  /* Check if representation lost precision */
-  if ((int16)ivalAsFloat4 != ival) {
-    /* This shouldn't happen for int2 values, but handle it */
-    return (fval < ival) ? -1 : 1;
+  keyArgs = list_make1(copyObject(keyExpr));
+  if (kind != NUM2INT_KEY_EQ) {
+    keyArgs = lappend(keyArgs, makeBoolConst(inclusive, false));
   }
+  keyCall = makeFuncExpr(keyFunc, intType, keyArgs, InvalidOid, InvalidOid,
+                         COERCE_EXPLICIT_CALL);
+  keyCall->location = location;
+
+  newClause = (OpExpr *) make_opclause(getNativeOpOid(nativeOpType, intType),
+                                       BOOLOID, false,
+                                       (Expr *) copyObject(operand),
+                                       (Expr *) keyCall,
+                                       InvalidOid, InvalidOid);
+  newClause->location = location;
 
-  if (fval < ivalAsFloat4) return -1;
-  if (fval > ivalAsFloat4) return 1;
-  return 0;
+  elog(DEBUG1, "planner hook: runtime key rewrite, opType=%d, keyFunc=%u",
+       opType, keyFunc);
+
+  return (Node *) newClause;
 }
 
+/*
+ * ============================================================================
+ * Selectivity Estimation
+ * ============================================================================
+ * Cross-type predicates that survive simplification (non-Var expressions,
+ * stable expressions, direct function calls) are estimated in the integer
+ * domain so that the integer column's own MCV list and histogram are used.
+ */
+
 /**
- * @brief Compare float4 value with int4 value
+ * @brief Classify an operator name as an operator type
+ * @param oprname Operator name (e.g. "<=")
+ * @return Operator type, or OP_TYPE_UNKNOWN
+ *
+ * Used when the operator is not in the OID cache (for example when the
+ * extension schema is not in search_path).
  */
-int
-float4_cmp_int4_internal(float4 fval, int32 ival) {
-  float4 ivalAsFloat4;
+static OpType
+opTypeFromName(const char *oprname) {
+  if (oprname == NULL)
+    return OP_TYPE_UNKNOWN;
+  if (strcmp(oprname, "=") == 0)
+    return OP_TYPE_EQ;
+  if (strcmp(oprname, "<>") == 0)
+    return OP_TYPE_NE;
+  if (strcmp(oprname, "<") == 0)
+    return OP_TYPE_LT;
+  if (strcmp(oprname, ">") == 0)
+    return OP_TYPE_GT;
+  if (strcmp(oprname, "<=") == 0)
+    return OP_TYPE_LE;
+  if (strcmp(oprname, ">=") == 0)
+    return OP_TYPE_GE;
+  return OP_TYPE_UNKNOWN;
+}
 
-  if (isnan(fval)) return 1;
-  if (isinf(fval)) return (fval > 0) ? 1 : -1;
+/**
+ * @brief Estimate selectivity of a cross-type restriction in the integer domain
+ * @param root Planner information
+ * @param opType Operator type, oriented as "linitial(args) op lsecond(args)"
+ * @param args Two-element operator argument list
+ * @param varRelid Relation being estimated, or 0 (see restriction_selectivity)
+ * @param selec Output: estimated selectivity
+ * @return true if an estimate was produced, false to use the generic estimator
+ *
+ * Maps the constant onto the integer domain with convertConstToInt() and
+ * computeIntPredicate(), then asks the native integer operator's estimator.
+ * A predicate such as (expr = 10.5) is estimated as matching nothing, and
+ * (expr > 10.5) is estimated exactly like (expr >= 11).
+ */
+static bool
+estimateIntDomainSelectivity(PlannerInfo *root, OpType opType, List *args,
+                             int varRelid, Selectivity *selec) {
+  VariableStatData vardata;
+  Node *other;
+  bool varonleft;
+  Node *intExpr;
+  Const *constNode;
+  Oid intType;
+  ConstConversion conv;
+  Oid nativeOpOid;
+  int64 intVal;
+  bool isAlwaysTrue, isAlwaysFalse;
+  bool result = true;
+
+  if (opType == OP_TYPE_UNKNOWN || list_length(args) != 2) {
+    return false;
+  }
 
-  ivalAsFloat4 = (float4)ival;
+  /* Identify the variable side; the other side is constant-folded for us */
+  if (!get_restriction_variable(root, args, varRelid,
+                                &vardata, &other, &varonleft)) {
+    return false;
+  }
 
-  /* Check if integer exceeds float4 precision (>2^24) */
-  if (labs((long)ival) > 16777216L) {
-    /* Check if round-trip conversion preserves value */
-    if ((int32)ivalAsFloat4 != ival) {
-      /* Precision lost - can't be equal */
-      /* Compare based on which direction the rounding went */
-      if (fval < ivalAsFloat4) return -1;
-      if (fval > ivalAsFloat4) return 1;
-      /* If fval == ivalAsFloat4, they still can't be truly equal since ivalAsFloat4 != ival */
-      return (ivalAsFloat4 < ival) ? -1 : 1;
-    }
+  intType = vardata.vartype;
+  if ((intType != INT2OID && intType != INT4OID && intType != INT8OID) ||
+      !IsA(other, Const)) {
+    ReleaseVariableStats(vardata);
+    return false;
   }
 
-  if (fval < ivalAsFloat4) return -1;
-  if (fval > ivalAsFloat4) return 1;
-  return 0;
-}
+  constNode = (Const *) other;
+  if (constNode->constisnull) {
+    /* Strict operator: a NULL comparand matches nothing */
+    ReleaseVariableStats(vardata);
+    *selec = 0.0;
+    return true;
+  }
 
-/**
- * @brief Compare float4 value with int8 value
- */
-int
-float4_cmp_int8_internal(float4 fval, int64 ival) {
-  float4 ivalAsFloat4;
+  intExpr = varonleft ? (Node *) linitial(args) : (Node *) lsecond(args);
+  if (!varonleft) {
+    opType = commuteOpType(opType);
+  }
 
-  if (isnan(fval)) return 1;
-  if (isinf(fval)) return (fval > 0) ? 1 : -1;
+  conv = convertConstToInt(constNode, intType);
+  nativeOpOid = computeIntPredicate(opType, intType, &conv, &intVal,
+                                    &isAlwaysTrue, &isAlwaysFalse);
+
+  if (isAlwaysFalse) {
+    *selec = 0.0;
+  } else if (isAlwaysTrue) {
+    /* Every non-NULL integer qualifies */
+    *selec = nulltestsel(root, IS_NOT_NULL, intExpr, varRelid,
+                         JOIN_INNER, NULL);
+  } else if (OidIsValid(nativeOpOid)) {
+    *selec = restriction_selectivity(root, nativeOpOid,
+                                     list_make2(intExpr,
+                                                makeIntConst(intType, intVal)),
+                                     InvalidOid, varRelid);
+  } else {
+    /* NaN or Infinity: leave it to the generic estimator */
+    result = false;
+  }
 
-  ivalAsFloat4 = (float4)ival;
+  ReleaseVariableStats(vardata);
 
-  /* Check if integer exceeds float4 precision */
-  if (llabs(ival) > 16777216LL) {
-    if ((int64)ivalAsFloat4 != ival) {
-      if (fval < ivalAsFloat4) return -1;
-      if (fval > ivalAsFloat4) return 1;
-      return (ivalAsFloat4 < ival) ? -1 : 1;
-    }
-  }
+  elog(DEBUG1, "num2int selectivity: intType=%u, handled=%d, selec=%g",
+       intType, result, result ? *selec : -1.0);
 
-  if (fval < ivalAsFloat4) return -1;
-  if (fval > ivalAsFloat4) return 1;
-  return 0;
+  return result;
 }
 
 /**
- * @brief Compare float8 value with int2 value
+ * @brief Restriction selectivity estimator for the cross-type operators
+ * @param fcinfo Standard restriction estimator arguments
+ *        (root, operator, args, varRelid)
+ * @return Estimated selectivity as float8
+ *
+ * Used as RESTRICT for all 108 operators. Estimates in the integer domain
+ * when the comparand is a constant at planning time; otherwise, or when
+ * pg_num2int_direct_comp.enableSupportFunctions is off, defers to the
+ * generic estimator (eqsel, neqsel, scalarltsel, ...) the operators used
+ * before.
  */
-int
-float8_cmp_int2_internal(float8 fval, int16 ival) {
-  float8 ivalAsFloat8;
+PG_FUNCTION_INFO_V1(num2int_restrictsel);
+Datum
+num2int_restrictsel(PG_FUNCTION_ARGS) {
+  PlannerInfo *root = (PlannerInfo *) PG_GETARG_POINTER(0);
+  Oid operator = PG_GETARG_OID(1);
+  List *args = (List *) PG_GETARG_POINTER(2);
+  int varRelid = PG_GETARG_INT32(3);
+  OpType opType = findOpTypeByOid(operator);
+  Selectivity selec;
+  PGFunction genericsel;
+
+  if (opType == OP_TYPE_UNKNOWN) {
+    opType = opTypeFromName(get_opname(operator));
+  }
 
-  if (isnan(fval)) return 1;
-  if (isinf(fval)) return (fval > 0) ? 1 : -1;
+  if (enableSupportFunctions &&
+      estimateIntDomainSelectivity(root, opType, args, varRelid, &selec)) {
+    CLAMP_PROBABILITY(selec);
+    PG_RETURN_FLOAT8((float8) selec);
+  }
 
-  ivalAsFloat8 = (float8)ival;
+  switch (opType) {
+    case OP_TYPE_EQ:
+      genericsel = eqsel;
+      break;
+    case OP_TYPE_NE:
+      genericsel = neqsel;
+      break;
+    case OP_TYPE_LT:
+      genericsel = scalarltsel;
+      break;
+    case OP_TYPE_GT:
+      genericsel = scalargtsel;
+      break;
+    case OP_TYPE_LE:
+      genericsel = scalarlesel;
+      break;
+    case OP_TYPE_GE:
+      genericsel = scalargesel;
+      break;
+    default:
+      PG_RETURN_FLOAT8(DEFAULT_INEQ_SEL);
+  }
 
-  if (fval < ivalAsFloat8) return -1;
-  if (fval > ivalAsFloat8) return 1;
-  return 0;
+  PG_RETURN_DATUM(DirectFunctionCall4Coll(genericsel,
+                                          PG_GET_COLLATION(),
+                                          PG_GETARG_DATUM(0),
+                                          PG_GETARG_DATUM(1),
+                                          PG_GETARG_DATUM(2),
+                                          PG_GETARG_DATUM(3)));
 }
 
-/**
- * @brief Compare float8 value with int4 value
+/*
+ * ============================================================================
+ * Cost Estimation
+ * ============================================================================
+ * Every comparison function would otherwise be costed at procost (1) ×
+ * cpu_operator_cost. Report what the comparison actually costs so that the
+ * planner can weigh numeric × integer quals against their alternatives.
  */
-int
-float8_cmp_int4_internal(float8 fval, int32 ival) {
-  float8 ivalAsFloat8;
 
-  if (isnan(fval)) return 1;
-  if (isinf(fval)) return (fval > 0) ? 1 : -1;
+/**
+ * @brief Check whether a numeric typmod only admits integers within int64
+ * @param typmod Type modifier of a numeric expression, or -1
+ * @return true for numeric(p,s) with s <= 0 and p - s <= 18
+ */
+static bool
+isIntegralNumericTypmod(int32 typmod) {
+  int precision;
+  int scale;
 
-  ivalAsFloat8 = (float8)ival;
+  if (typmod < (int32) VARHDRSZ) {
+    return false;
+  }
+  precision = ((typmod - VARHDRSZ) >> 16) & 0xffff;
+  /* Sign-extend the 11-bit scale; negative scales exist since PG 15 */
+  scale = (((typmod - VARHDRSZ) & 0x7ff) ^ 1024) - 1024;
 
-  if (fval < ivalAsFloat8) return -1;
-  if (fval > ivalAsFloat8) return 1;
-  return 0;
+  return scale <= 0 && precision - scale <= NUM2INT_INTEGRAL_NUMERIC_MAX_DIGITS;
 }
 
 /**
- * @brief Compare float8 value with int8 value
+ * @brief Classify the comparison cost for a numeric operand
+ * @param arg Numeric operand expression
+ * @return Cost factor in multiples of cpu_operator_cost
+ *
+ * The cost follows the call-site cache the operand will get: a constant is
+ * decoded once, and numeric(p,s) with s <= 0 and at most 18 integral digits
+ * takes the typmod fast path. Any other numeric takes the general path.
  */
-int
-float8_cmp_int8_internal(float8 fval, int64 ival) {
-  float8 ivalAsFloat8;
-  float8 fvalRounded;
+static double
+numericOperandCostFactor(Node *arg) {
+  if (IsA(arg, Const)) {
+    return NUM2INT_COST_NUMERIC_INT_CONST;
+  }
+
+  if (isIntegralNumericTypmod(exprTypmod(arg))) {
+    return NUM2INT_COST_NUMERIC_INT_INTEGRAL;
+  }
 
-  if (isnan(fval)) return 1;
-  if (isinf(fval)) return (fval > 0) ? 1 : -1;
+  return NUM2INT_COST_NUMERIC_INT;
+}
 
-  /* Check if float has fractional part - never equals integer */
-  fvalRounded = trunc(fval);
-  if (fval != fvalRounded) {
-    return (fval < ival) ? -1 : 1;
+/**
+ * @brief Estimate the per-call cost of a cross-type comparison function
+ * @param funcid Comparison function OID
+ * @param node Calling FuncExpr/OpExpr, or NULL if not available
+ * @return Per-call cost
+ */
+static Cost
+estimateComparisonCost(Oid funcid, Node *node) {
+  List *args = NIL;
+  ListCell *lc;
+
+  if (node != NULL && IsA(node, FuncExpr)) {
+    args = ((FuncExpr *) node)->args;
+  } else if (node != NULL && IsA(node, OpExpr)) {
+    args = ((OpExpr *) node)->args;
   }
 
-  ivalAsFloat8 = (float8)ival;
+  if (args != NIL) {
+    foreach (lc, args) {
+      Node *arg = (Node *) lfirst(lc);
 
-  /* float8 has 53-bit mantissa, check precision beyond 2^53 */
-  if (llabs(ival) > 9007199254740992LL) {
-    /* Integer is beyond exact float8 representation */
-    if ((int64)ivalAsFloat8 != ival) {
-      /* Integer cannot be exactly represented as float8 */
-      /* For equality, this means they can never be equal */
-      if (fval < ivalAsFloat8) return -1;
-      if (fval > ivalAsFloat8) return 1;
-      /* fval == ivalAsFloat8, but ivalAsFloat8 != ival due to rounding */
-      /* Therefore fval != ival (precision loss detected) */
-      return (ivalAsFloat8 < ival) ? -1 : 1;
+      if (exprType(arg) == NUMERICOID) {
+        return numericOperandCostFactor(arg) * cpu_operator_cost;
+      }
     }
+    return NUM2INT_COST_FLOAT_INT * cpu_operator_cost;
+  } else {
+    /* No call site (e.g. ScalarArrayOpExpr): classify by signature */
+    Oid *argtypes;
+    int nargs;
+
+    get_func_signature(funcid, &argtypes, &nargs);
+    for (int i = 0; i < nargs; i++) {
+      if (argtypes[i] == NUMERICOID) {
+        return NUM2INT_COST_NUMERIC_INT * cpu_operator_cost;
+      }
+    }
+    return NUM2INT_COST_FLOAT_INT * cpu_operator_cost;
   }
-
-  if (fval < ivalAsFloat8) return -1;
-  if (fval > ivalAsFloat8) return 1;
-  return 0;
 }
 
 /*
- * Btree support function wrappers
- *
- * These SQL-callable wrappers expose the internal comparison functions
- * for btree operator family support function registration.
- * Each returns int4: -1 for <, 0 for =, 1 for >
+ * ============================================================================
+ * Planner Hook: Constant-Array Rewrite
+ * ============================================================================
+ * SupportRequestSimplify is only issued for FuncExpr/OpExpr nodes, so
+ * "int_col IN (1.0, 2.0)", "int_col = ANY($1::numeric[])" and
+ * "int_col NOT IN (...)" never reach num2int_support. The planner hook
+ * rewrites them into native integer ScalarArrayOpExprs, which btree can scan
+ * as array keys, before the query is planned. The same list spelled out as
+ * "int_col = 1.0 OR int_col = 2.0 OR ..." is collected into one such array
+ * too, instead of one native equality and one BitmapOr arm per value.
  */
 
-PG_FUNCTION_INFO_V1(numeric_cmp_int2);
-Datum
-numeric_cmp_int2(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int16 val = PG_GETARG_INT16(1);
-  PG_RETURN_INT32(numeric_cmp_int2_internal(num, val));
-}
+/**
+ * @brief Context for the constant-array rewrite
+ */
+typedef struct {
+  ParamListInfo boundParams;  /**< Parameter values (custom plans), or NULL */
+} ArrayRewriteContext;
 
-PG_FUNCTION_INFO_V1(numeric_cmp_int4);
-Datum
-numeric_cmp_int4(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int32 val = PG_GETARG_INT32(1);
-  PG_RETURN_INT32(numeric_cmp_int4_internal(num, val));
-}
+/**
+ * @brief qsort comparator for int64 values
+ */
+static int
+compareInt64(const void *a, const void *b) {
+  int64 x = *(const int64 *) a;
+  int64 y = *(const int64 *) b;
 
-PG_FUNCTION_INFO_V1(numeric_cmp_int8);
-Datum
-numeric_cmp_int8(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int64 val = PG_GETARG_INT64(1);
-  PG_RETURN_INT32(numeric_cmp_int8_internal(num, val));
+  return (x < y) ? -1 : ((x > y) ? 1 : 0);
 }
 
-/*
- * Reverse comparison functions for int <op> numeric
- * These are needed for the integer_ops btree family where the integer
- * is the left (indexed) operand.
- * int_cmp_numeric(i, n) = -numeric_cmp_int(n, i)
+/**
+ * @brief Get the value of a parameter bound for a custom plan
+ * @param param Parameter
+ * @param boundParams Parameter values, or NULL
+ * @return Constant, or NULL if the value is not fixed for this plan
+ *
+ * Parameters are only used when their values are bound for a custom plan
+ * (PARAM_FLAG_CONST), exactly as eval_const_expressions() would: the fetch is
+ * speculative, and a by-reference value is copied into the planner's memory
+ * context instead of pointing into the parameter list.
  */
-PG_FUNCTION_INFO_V1(int2_cmp_numeric);
-Datum
-int2_cmp_numeric(PG_FUNCTION_ARGS) {
-  int16 val = PG_GETARG_INT16(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  PG_RETURN_INT32(-numeric_cmp_int2_internal(num, val));
-}
+static Const *
+evalBoundParam(Param *param, ParamListInfo boundParams) {
+  ParamExternData *prm;
+  ParamExternData prmdata;
+  int16 typLen;
+  bool typByVal;
+  Datum value;
+
+  if (boundParams == NULL || param->paramkind != PARAM_EXTERN ||
+      param->paramid <= 0 || param->paramid > boundParams->numParams) {
+    return NULL;
+  }
 
-PG_FUNCTION_INFO_V1(int4_cmp_numeric);
-Datum
-int4_cmp_numeric(PG_FUNCTION_ARGS) {
-  int32 val = PG_GETARG_INT32(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  PG_RETURN_INT32(-numeric_cmp_int4_internal(num, val));
-}
+  if (boundParams->paramFetch != NULL) {
+    prm = boundParams->paramFetch(boundParams, param->paramid, true,
+                                  &prmdata);
+  } else {
+    prm = &boundParams->params[param->paramid - 1];
+  }
 
-PG_FUNCTION_INFO_V1(int8_cmp_numeric);
-Datum
-int8_cmp_numeric(PG_FUNCTION_ARGS) {
-  int64 val = PG_GETARG_INT64(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  PG_RETURN_INT32(-numeric_cmp_int8_internal(num, val));
-}
+  if (!OidIsValid(prm->ptype) || prm->ptype != param->paramtype ||
+      !(prm->pflags & PARAM_FLAG_CONST)) {
+    return NULL;
+  }
 
-PG_FUNCTION_INFO_V1(float4_cmp_int2);
-Datum
-float4_cmp_int2(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int16 ival = PG_GETARG_INT16(1);
-  PG_RETURN_INT32(float4_cmp_int2_internal(fval, ival));
+  get_typlenbyval(param->paramtype, &typLen, &typByVal);
+  if (prm->isnull || typByVal) {
+    value = prm->value;
+  } else {
+    value = datumCopy(prm->value, typByVal, typLen);
+  }
+  return makeConst(param->paramtype, param->paramtypmod, param->paramcollid,
+                   (int) typLen, value, prm->isnull, typByVal);
 }
 
-PG_FUNCTION_INFO_V1(float4_cmp_int4);
-Datum
-float4_cmp_int4(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int32 ival = PG_GETARG_INT32(1);
-  PG_RETURN_INT32(float4_cmp_int4_internal(fval, ival));
-}
+/**
+ * @brief Reduce the array operand of a ScalarArrayOpExpr to a constant
+ * @param arrayArg Array operand
+ * @param boundParams Parameter values for a custom plan, or NULL
+ * @return Array constant, or NULL if the operand is not constant
+ *
+ * The hook runs before eval_const_expressions(), so IN lists still appear as
+ * ArrayExpr nodes whose elements may be implicit casts of constants, and
+ * parameters are not yet substituted. Parameters are only used when their
+ * values are bound for a custom plan (PARAM_FLAG_CONST), exactly as
+ * eval_const_expressions() would; generic plans keep the original expression.
+ */
+static Const *
+evalConstArrayArg(Node *arrayArg, ParamListInfo boundParams) {
+  if (IsA(arrayArg, Const)) {
+    return (Const *) arrayArg;
+  }
 
-PG_FUNCTION_INFO_V1(float4_cmp_int8);
-Datum
-float4_cmp_int8(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int64 ival = PG_GETARG_INT64(1);
-  PG_RETURN_INT32(float4_cmp_int8_internal(fval, ival));
-}
+  if (IsA(arrayArg, ArrayExpr)) {
+    ArrayExpr *arrayExpr = (ArrayExpr *) arrayArg;
+    ListCell *lc;
+    Node *folded;
 
-PG_FUNCTION_INFO_V1(float8_cmp_int2);
-Datum
-float8_cmp_int2(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int16 ival = PG_GETARG_INT16(1);
-  PG_RETURN_INT32(float8_cmp_int2_internal(fval, ival));
-}
+    if (arrayExpr->multidims) {
+      return NULL;
+    }
 
-PG_FUNCTION_INFO_V1(float8_cmp_int4);
-Datum
-float8_cmp_int4(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int32 ival = PG_GETARG_INT32(1);
-  PG_RETURN_INT32(float8_cmp_int4_internal(fval, ival));
-}
+    /* Accept only constants, possibly wrapped in a type coercion */
+    foreach (lc, arrayExpr->elements) {
+      Node *elem = (Node *) lfirst(lc);
 
-PG_FUNCTION_INFO_V1(float8_cmp_int8);
-Datum
-float8_cmp_int8(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int64 ival = PG_GETARG_INT64(1);
-  PG_RETURN_INT32(float8_cmp_int8_internal(fval, ival));
+      if (IsA(elem, FuncExpr) &&
+          ((FuncExpr *) elem)->funcformat != COERCE_EXPLICIT_CALL &&
+          list_length(((FuncExpr *) elem)->args) == 1) {
+        elem = (Node *) linitial(((FuncExpr *) elem)->args);
+      } else if (IsA(elem, RelabelType)) {
+        elem = (Node *) ((RelabelType *) elem)->arg;
+      }
+      if (!IsA(elem, Const)) {
+        return NULL;
+      }
+    }
+
+    folded = eval_const_expressions(NULL, arrayArg);
+    return IsA(folded, Const) ? (Const *) folded : NULL;
+  }
+
+  if (IsA(arrayArg, Param)) {
+    return evalBoundParam((Param *) arrayArg, boundParams);
+  }
+
+  return NULL;
 }
 
-/*
- * Reverse comparison functions for btree operator families
+/**
+ * @brief Reduce a scalar comparand to a constant
+ * @param arg Comparand
+ * @param boundParams Parameter values for a custom plan, or NULL
+ * @return Constant, or NULL if the comparand is not constant
  *
- * These functions provide int x float comparisons by calling the existing
- * float x int comparison functions with swapped arguments and negated result.
+ * Accepts what evalConstArrayArg() accepts for an array element: a constant,
+ * possibly under a type coercion, or a parameter bound for a custom plan.
  */
+static Const *
+evalConstScalarArg(Node *arg, ParamListInfo boundParams) {
+  Node *inner = arg;
+  Node *folded;
 
-PG_FUNCTION_INFO_V1(int2_cmp_float4);
-Datum
-int2_cmp_float4(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  /* Reverse the comparison: int2_cmp_float4(i, f) = -float4_cmp_int2(f, i) */
-  PG_RETURN_INT32(-float4_cmp_int2_internal(fval, ival));
-}
+  if (IsA(arg, Const)) {
+    return (Const *) arg;
+  }
+  if (IsA(arg, Param)) {
+    return evalBoundParam((Param *) arg, boundParams);
+  }
 
-PG_FUNCTION_INFO_V1(int4_cmp_float4);
-Datum
-int4_cmp_float4(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  /* Reverse the comparison: int4_cmp_float4(i, f) = -float4_cmp_int4(f, i) */
-  PG_RETURN_INT32(-float4_cmp_int4_internal(fval, ival));
-}
+  if (IsA(arg, FuncExpr) &&
+      ((FuncExpr *) arg)->funcformat != COERCE_EXPLICIT_CALL &&
+      list_length(((FuncExpr *) arg)->args) == 1) {
+    inner = (Node *) linitial(((FuncExpr *) arg)->args);
+  } else if (IsA(arg, RelabelType)) {
+    inner = (Node *) ((RelabelType *) arg)->arg;
+  }
+  if (inner == arg || !IsA(inner, Const)) {
+    return NULL;
+  }
 
-PG_FUNCTION_INFO_V1(int8_cmp_float4);
-Datum
-int8_cmp_float4(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  /* Reverse the comparison: int8_cmp_float4(i, f) = -float4_cmp_int8(f, i) */
-  PG_RETURN_INT32(-float4_cmp_int8_internal(fval, ival));
+  folded = eval_const_expressions(NULL, arg);
+  return IsA(folded, Const) ? (Const *) folded : NULL;
 }
 
-PG_FUNCTION_INFO_V1(int2_cmp_float8);
-Datum
-int2_cmp_float8(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  /* Reverse the comparison: int2_cmp_float8(i, f) = -float8_cmp_int2(f, i) */
-  PG_RETURN_INT32(-float8_cmp_int2_internal(fval, ival));
+/**
+ * @brief Build a native ScalarArrayOpExpr over a one-dimensional array constant
+ * @param useOr true for ANY, false for ALL
+ * @param location Source location for the new expression
+ * @param nativeOpOid Native same-type operator OID
+ * @param scalarArg Scalar operand (will be copied)
+ * @param elemType Element type of the new array
+ * @param datums Element values
+ * @param nulls Element null flags
+ * @param nelems Number of elements
+ * @return New ScalarArrayOpExpr
+ */
+static Node *
+buildNativeArrayOp(bool useOr, int location, Oid nativeOpOid, Node *scalarArg,
+                   Oid elemType, Datum *datums, bool *nulls, int nelems) {
+  int16 elemLen;
+  bool elemByVal;
+  char elemAlign;
+  int dims[1];
+  int lbs[1];
+  ScalarArrayOpExpr *result;
+
+  get_typlenbyvalalign(elemType, &elemLen, &elemByVal, &elemAlign);
+  dims[0] = nelems;
+  lbs[0] = 1;
+
+  result = makeNode(ScalarArrayOpExpr);
+  result->opno = nativeOpOid;
+  result->opfuncid = get_opcode(nativeOpOid);
+  result->useOr = useOr;
+  result->inputcollid = InvalidOid;
+  result->args = list_make2(copyObject(scalarArg),
+                            makeConst(get_array_type(elemType), -1, InvalidOid,
+                                      -1,
+                                      PointerGetDatum(construct_md_array(
+                                          datums, nulls, 1, dims, lbs,
+                                          elemType, elemLen, elemByVal,
+                                          elemAlign)),
+                                      false, false));
+  result->location = location;
+
+  return (Node *) result;
 }
 
-PG_FUNCTION_INFO_V1(int4_cmp_float8);
-Datum
-int4_cmp_float8(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  /* Reverse the comparison: int4_cmp_float8(i, f) = -float8_cmp_int4(f, i) */
-  PG_RETURN_INT32(-float8_cmp_int4_internal(fval, ival));
+/**
+ * @brief Build a comparison result that is known except for a NULL operand
+ * @param operand Operand of the comparison (will be copied)
+ * @param value Result of the comparison for every non-NULL operand
+ * @param location Source location for the new expression
+ * @return "operand IS NOT NULL" for true, "operand IS NULL AND NULL" for false
+ *
+ * Both keep the NULL result for a NULL operand, so the replacement is also
+ * correct under NOT and outside WHERE. The planner still recognizes the false
+ * form as an empty qualification.
+ */
+static Node *
+makeNullPreservingBool(Node *operand, bool value, int location) {
+  NullTest *ntest = makeNode(NullTest);
+
+  ntest->arg = (Expr *) copyObject(operand);
+  ntest->nulltesttype = value ? IS_NOT_NULL : IS_NULL;
+  ntest->argisrow = false;
+  ntest->location = location;
+  if (value) {
+    return (Node *) ntest;
+  }
+  return (Node *) make_andclause(list_make2(ntest,
+                                            makeBoolConst(false, true)));
 }
 
-PG_FUNCTION_INFO_V1(int8_cmp_float8);
-Datum
-int8_cmp_float8(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  /* Reverse the comparison: int8_cmp_float8(i, f) = -float8_cmp_int8(f, i) */
-  PG_RETURN_INT32(-float8_cmp_int8_internal(fval, ival));
+/**
+ * @brief Sort int64 values and remove duplicates
+ * @param values Values, reordered in place
+ * @param nvalues Number of values
+ * @return Number of distinct values, now at the front of values
+ */
+static int
+sortUniqueInt64(int64 *values, int nvalues) {
+  int nunique = 1;
+
+  if (nvalues < 2) {
+    return nvalues;
+  }
+
+  qsort(values, nvalues, sizeof(int64), compareInt64);
+  for (int i = 1; i < nvalues; i++) {
+    if (values[i] != values[nunique - 1]) {
+      values[nunique++] = values[i];
+    }
+  }
+  return nunique;
 }
 
-/*
- * Equality operator wrappers (=)
+/**
+ * @brief Compare an integer operand with a list of integer values natively
+ * @param opType OP_TYPE_EQ for "= ANY", OP_TYPE_NE for "<> ALL"
+ * @param operand Integer-typed operand (will be copied)
+ * @param intType Type of operand
+ * @param values Distinct values
+ * @param nvalues Number of values
+ * @param hasNull The list also had a NULL element
+ * @param location Source location for the new expression
+ * @return Replacement expression
  *
- * These wrapper functions call the corresponding _cmp_internal function
- * and test for equality (result == 0).
+ * - No elements: FALSE for ANY, TRUE for ALL, NULL for a NULL operand (see
+ *   makeNullPreservingBool())
+ * - One element: plain native comparison
+ * - Otherwise: native ScalarArrayOpExpr over an integer array constant, with
+ *   the NULL element last
  */
+static Node *
+buildIntListComparison(OpType opType, Node *operand, Oid intType,
+                       const int64 *values, int nvalues, bool hasNull,
+                       int location) {
+  bool useOr = (opType == OP_TYPE_EQ);
+  Oid nativeOpOid;
+  Datum *intDatums;
+  bool *intNulls;
+  int nresult;
+
+  if (nvalues == 0 && !hasNull) {
+    /* = ANY: nothing can match; <> ALL: nothing can be equal */
+    return makeNullPreservingBool(operand, !useOr, location);
+  }
 
-PG_FUNCTION_INFO_V1(numeric_eq_int2);
-Datum
-numeric_eq_int2(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int16 val = PG_GETARG_INT16(1);
-  PG_RETURN_BOOL(numericEqInt64Direct(num, (int64)val));
-}
+  nativeOpOid = getNativeOpOid(opType, intType);
 
-PG_FUNCTION_INFO_V1(numeric_eq_int4);
-Datum
-numeric_eq_int4(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int32 val = PG_GETARG_INT32(1);
-  PG_RETURN_BOOL(numericEqInt64Direct(num, (int64)val));
-}
+  if (nvalues == 1 && !hasNull) {
+    return (Node *) buildNativeOpExpr(nativeOpOid, operand, values[0],
+                                      intType, location, InvalidOid);
+  }
 
-PG_FUNCTION_INFO_V1(numeric_eq_int8);
-Datum
-numeric_eq_int8(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int64 val = PG_GETARG_INT64(1);
-  PG_RETURN_BOOL(numericEqInt64Direct(num, val));
-}
+  nresult = nvalues + (hasNull ? 1 : 0);
+  intDatums = (Datum *) palloc(sizeof(Datum) * nresult);
+  intNulls = (bool *) palloc0(sizeof(bool) * nresult);
+  for (int i = 0; i < nvalues; i++) {
+    if (intType == INT2OID) {
+      intDatums[i] = Int16GetDatum((int16) values[i]);
+    } else if (intType == INT4OID) {
+      intDatums[i] = Int32GetDatum((int32) values[i]);
+    } else {
+      intDatums[i] = Int64GetDatum(values[i]);
+    }
+  }
+  if (hasNull) {
+    intDatums[nvalues] = (Datum) 0;
+    intNulls[nvalues] = true;
+  }
 
-PG_FUNCTION_INFO_V1(float4_eq_int2);
-Datum
-float4_eq_int2(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  return buildNativeArrayOp(useOr, location, nativeOpOid, operand, intType,
+                            intDatums, intNulls, nresult);
 }
 
-PG_FUNCTION_INFO_V1(float4_eq_int4);
+/**
+ * @brief Rewrite a cross-type constant-array comparison to native integers
+ * @param saop ScalarArrayOpExpr to inspect
+ * @return Replacement expression, or NULL to keep the original
+ *
+ * Handles "int = ANY(inexact[])" and "int <> ALL(inexact[])". Elements that no
+ * integer can equal (fractions, NaN, Infinity, values outside the integer
+ * type's range) cannot affect the result and are dropped, the rest are
+ * converted and deduplicated. NULL elements are kept so that NULL semantics
+ * are unchanged. The result is built by buildIntListComparison().
+ */
+static Node *
+rewriteIntArrayOp(ScalarArrayOpExpr *saop, ArrayRewriteContext *context) {
+  OpType opType;
+  Node *scalarArg;
+  Const *arrayConst;
+  Oid intType;
+  ArrayType *arr;
+  Oid elemType;
+  int16 elemLen;
+  bool elemByVal;
+  char elemAlign;
+  Datum *elems;
+  bool *elemNulls;
+  int nelems;
+  int64 *values;
+  int nvalues = 0;
+  bool hasNull = false;
+
+  if (saop->opno < FirstNormalObjectId || list_length(saop->args) != 2) {
+    return NULL;
+  }
+
+  opType = findOpTypeByOid(saop->opno);
+  if (!((opType == OP_TYPE_EQ && saop->useOr) ||
+        (opType == OP_TYPE_NE && !saop->useOr))) {
+    return NULL;
+  }
+
+  scalarArg = (Node *) linitial(saop->args);
+  if (!isComparisonOperand(scalarArg)) {
+    return NULL;
+  }
+
+  intType = exprType(scalarArg);
+  if (intType != INT2OID && intType != INT4OID && intType != INT8OID) {
+    return NULL;
+  }
+
+  arrayConst = evalConstArrayArg((Node *) lsecond(saop->args),
+                                 context->boundParams);
+  if (arrayConst == NULL || arrayConst->constisnull) {
+    return NULL;
+  }
+
+  arr = DatumGetArrayTypeP(arrayConst->constvalue);
+  elemType = ARR_ELEMTYPE(arr);
+  if (elemType != NUMERICOID && elemType != FLOAT4OID &&
+      elemType != FLOAT8OID) {
+    return NULL;
+  }
+
+  get_typlenbyvalalign(elemType, &elemLen, &elemByVal, &elemAlign);
+  deconstruct_array(arr, elemType, elemLen, elemByVal, elemAlign,
+                    &elems, &elemNulls, &nelems);
+
+  if (nelems == 0) {
+    /* An empty array gives FALSE for ANY and TRUE for ALL even for NULL */
+    return (Node *) makeBoolConst(!saop->useOr, false);
+  }
+
+  /* Convert each element with the same rules as the simplify path */
+  values = (int64 *) palloc(sizeof(int64) * Max(nelems, 1));
+  for (int i = 0; i < nelems; i++) {
+    Const elemConst;
+    ConstConversion conv;
+
+    if (elemNulls[i]) {
+      hasNull = true;
+      continue;
+    }
+
+    memset(&elemConst, 0, sizeof(elemConst));
+    elemConst.xpr.type = T_Const;
+    elemConst.consttype = elemType;
+    elemConst.constvalue = elems[i];
+    elemConst.constisnull = false;
+
+    conv = convertConstToInt(&elemConst, intType);
+    if (conv.valid && !conv.hasFraction) {
+      values[nvalues++] = conv.intVal;
+    }
+  }
+
+  nvalues = sortUniqueInt64(values, nvalues);
+
+  elog(DEBUG1, "num2int array rewrite: opType=%d, intType=%u, %d of %d elements kept, hasNull=%d",
+       opType, intType, nvalues, nelems, hasNull);
+
+  return buildIntListComparison(opType, scalarArg, intType, values, nvalues,
+                                hasNull, saop->location);
+}
+
+/**
+ * @brief Rewrite an inexact-column comparison against an integer array
+ * @param saop ScalarArrayOpExpr to inspect
+ * @param context Rewrite context
+ * @return Replacement expression, or NULL to keep the original
+ *
+ * Handles "inexact = ANY(int[])" and "inexact <> ALL(int[])". Every element
+ * is converted to the column's own type, so the comparison uses the native
+ * operator, whose hash function matches on both sides: PostgreSQL 14+ can
+ * then evaluate large lists with a hash probe instead of a linear scan.
+ * Integers a float column cannot hold exactly are dropped, since no value of
+ * the column can equal them; numeric holds every integer. Duplicates are
+ * removed and NULL elements are kept, as in rewriteIntArrayOp().
+ */
+static Node *
+rewriteInexactArrayOp(ScalarArrayOpExpr *saop, ArrayRewriteContext *context) {
+  OpType opType;
+  Node *scalarArg;
+  Const *arrayConst;
+  Oid inexactType;
+  ArrayType *arr;
+  Oid elemType;
+  int16 elemLen;
+  bool elemByVal;
+  char elemAlign;
+  Datum *elems;
+  bool *elemNulls;
+  int nelems;
+  int64 *values;
+  int nvalues = 0;
+  bool hasNull = false;
+  Oid nativeOpOid;
+  Datum *resultDatums;
+  bool *resultNulls;
+  int nresult;
+
+  if (saop->opno < FirstNormalObjectId || list_length(saop->args) != 2) {
+    return NULL;
+  }
+
+  opType = findOpTypeByOid(saop->opno);
+  if (!((opType == OP_TYPE_EQ && saop->useOr) ||
+        (opType == OP_TYPE_NE && !saop->useOr))) {
+    return NULL;
+  }
+
+  scalarArg = (Node *) linitial(saop->args);
+  if (!isComparisonOperand(scalarArg)) {
+    return NULL;
+  }
+
+  inexactType = exprType(scalarArg);
+  if (inexactType != NUMERICOID && inexactType != FLOAT4OID &&
+      inexactType != FLOAT8OID) {
+    return NULL;
+  }
+
+  arrayConst = evalConstArrayArg((Node *) lsecond(saop->args),
+                                 context->boundParams);
+  if (arrayConst == NULL || arrayConst->constisnull) {
+    return NULL;
+  }
+
+  arr = DatumGetArrayTypeP(arrayConst->constvalue);
+  elemType = ARR_ELEMTYPE(arr);
+  if (elemType != INT2OID && elemType != INT4OID && elemType != INT8OID) {
+    return NULL;
+  }
+
+  get_typlenbyvalalign(elemType, &elemLen, &elemByVal, &elemAlign);
+  deconstruct_array(arr, elemType, elemLen, elemByVal, elemAlign,
+                    &elems, &elemNulls, &nelems);
+
+  if (nelems == 0) {
+    return (Node *) makeBoolConst(!saop->useOr, false);
+  }
+
+  values = (int64 *) palloc(sizeof(int64) * Max(nelems, 1));
+  for (int i = 0; i < nelems; i++) {
+    int64 ival;
+
+    if (elemNulls[i]) {
+      hasNull = true;
+      continue;
+    }
+
+    if (elemType == INT2OID) {
+      ival = DatumGetInt16(elems[i]);
+    } else if (elemType == INT4OID) {
+      ival = DatumGetInt32(elems[i]);
+    } else {
+      ival = DatumGetInt64(elems[i]);
+    }
+
+    /* Keep only integers the float type holds exactly (see FLOAT*_INT64_MAX) */
+    if (inexactType == FLOAT4OID) {
+      float4 f = (float4) ival;
+
+      if (f >= FLOAT4_INT64_MAX || (int64) f != ival) {
+        continue;
+      }
+    } else if (inexactType == FLOAT8OID) {
+      float8 f = (float8) ival;
+
+      if (f >= FLOAT8_INT64_MAX || (int64) f != ival) {
+        continue;
+      }
+    }
+
+    values[nvalues++] = ival;
+  }
+
+  nvalues = sortUniqueInt64(values, nvalues);
+
+  elog(DEBUG1, "num2int inexact array rewrite: opType=%d, inexactType=%u, %d of %d elements kept, hasNull=%d",
+       opType, inexactType, nvalues, nelems, hasNull);
+
+  if (nvalues == 0 && !hasNull) {
+    return makeNullPreservingBool(scalarArg, !saop->useOr, saop->location);
+  }
+
+  nativeOpOid = getNativeInexactOpOid(opType, inexactType);
+
+  nresult = nvalues + (hasNull ? 1 : 0);
+  resultDatums = (Datum *) palloc(sizeof(Datum) * nresult);
+  resultNulls = (bool *) palloc0(sizeof(bool) * nresult);
+  for (int i = 0; i < nvalues; i++) {
+    if (inexactType == NUMERICOID) {
+      resultDatums[i] = DirectFunctionCall1(int8_numeric,
+                                            Int64GetDatum(values[i]));
+    } else if (inexactType == FLOAT4OID) {
+      resultDatums[i] = Float4GetDatum((float4) values[i]);
+    } else {
+      resultDatums[i] = Float8GetDatum((float8) values[i]);
+    }
+  }
+  if (hasNull) {
+    resultDatums[nvalues] = (Datum) 0;
+    resultNulls[nvalues] = true;
+  }
+
+  if (nvalues == 1 && !hasNull) {
+    OpExpr *opExpr;
+
+    opExpr = (OpExpr *) make_opclause(nativeOpOid, BOOLOID, false,
+                                      (Expr *) copyObject(scalarArg),
+                                      (Expr *) makeInexactConst(
+                                          inexactType, resultDatums[0]),
+                                      InvalidOid, InvalidOid);
+    opExpr->location = saop->location;
+    return (Node *) opExpr;
+  }
+
+  return buildNativeArrayOp(saop->useOr, saop->location, nativeOpOid,
+                            scalarArg, inexactType, resultDatums, resultNulls,
+                            nresult);
+}
+
+/**
+ * @brief Match an OR argument of the form "int_operand = inexact_constant"
+ * @param clause Argument of an OR
+ * @param context Rewrite context
+ * @param operand Output: integer-typed operand
+ * @param constNode Output: comparand, possibly a NULL constant
+ * @return true if clause is a cross-type equality with a constant comparand
+ */
+static bool
+orChainEquality(Node *clause, ArrayRewriteContext *context, Node **operand,
+                Const **constNode) {
+  OpExpr *opExpr;
+  Node *leftop;
+  Node *rightop;
+  Oid intType;
+
+  if (!IsA(clause, OpExpr)) {
+    return false;
+  }
+  opExpr = (OpExpr *) clause;
+  if (opExpr->opno < FirstNormalObjectId || list_length(opExpr->args) != 2 ||
+      findOpTypeByOid(opExpr->opno) != OP_TYPE_EQ) {
+    return false;
+  }
+
+  leftop = (Node *) linitial(opExpr->args);
+  rightop = (Node *) lsecond(opExpr->args);
+  if (isComparisonOperand(leftop) &&
+      (*constNode = evalConstScalarArg(rightop, context->boundParams)) != NULL) {
+    *operand = leftop;
+  } else if (isComparisonOperand(rightop) &&
+             (*constNode = evalConstScalarArg(leftop,
+                                              context->boundParams)) != NULL) {
+    *operand = rightop;
+  } else {
+    return false;
+  }
+
+  intType = exprType(*operand);
+  return (intType == INT2OID || intType == INT4OID || intType == INT8OID) &&
+         ((*constNode)->consttype == NUMERICOID ||
+          (*constNode)->consttype == FLOAT4OID ||
+          (*constNode)->consttype == FLOAT8OID);
+}
+
+/**
+ * @brief Equalities of an OR collected for one integer operand
+ */
+typedef struct {
+  Node *operand;    /**< Integer-typed operand */
+  int nclauses;     /**< Number of equalities on the operand */
+  int64 *values;    /**< Converted comparands */
+  int nvalues;      /**< Number of converted comparands */
+  bool hasNull;     /**< A comparand was NULL */
+  int location;     /**< Location of the first equality */
+} OrChainGroup;
+
+/**
+ * @brief Rewrite an OR of cross-type equalities into native = ANY()
+ * @param orExpr OR expression
+ * @param context Rewrite context
+ * @return Replacement expression, or NULL to keep the original
+ *
+ * Equalities on the same integer operand are replaced by a single
+ * buildIntListComparison() at the position of the first one; other arguments
+ * keep their order. Comparands that no integer can equal are dropped, as
+ * simplification would fold their equality to FALSE (FR-015). An operand left
+ * without values gets buildIntListComparison()'s NULL-preserving form, which
+ * the planner removes from an OR in WHERE; the rewrite also runs in target
+ * lists and under NOT, where a NULL operand must still give NULL. Only
+ * operands with two or more equalities are rewritten; a single one is
+ * simplified as before.
+ */
+static Node *
+rewriteOrChain(BoolExpr *orExpr, ArrayRewriteContext *context) {
+  int nargs = list_length(orExpr->args);
+  Node **operands = (Node **) palloc(nargs * sizeof(Node *));
+  Const **consts = (Const **) palloc(nargs * sizeof(Const *));
+  int *groupOf = (int *) palloc(nargs * sizeof(int));
+  OrChainGroup *groups = (OrChainGroup *) palloc(nargs * sizeof(OrChainGroup));
+  int ngroups = 0;
+  bool anyRewritten = false;
+  List *result = NIL;
+  ListCell *lc;
+  int i;
+
+  i = 0;
+  foreach (lc, orExpr->args) {
+    int g;
+
+    groupOf[i] = -1;
+    if (orChainEquality((Node *) lfirst(lc), context, &operands[i],
+                        &consts[i])) {
+      for (g = 0; g < ngroups; g++) {
+        if (equal(groups[g].operand, operands[i])) {
+          break;
+        }
+      }
+      if (g == ngroups) {
+        groups[g].operand = operands[i];
+        groups[g].nclauses = 0;
+        groups[g].values = NULL;
+        groups[g].nvalues = 0;
+        groups[g].hasNull = false;
+        groups[g].location = exprLocation((Node *) lfirst(lc));
+        ngroups++;
+      }
+      groups[g].nclauses++;
+      groupOf[i] = g;
+    }
+    i++;
+  }
+
+  for (int g = 0; g < ngroups; g++) {
+    if (groups[g].nclauses >= 2) {
+      groups[g].values = (int64 *) palloc(groups[g].nclauses * sizeof(int64));
+      anyRewritten = true;
+    }
+  }
+  if (!anyRewritten) {
+    return NULL;
+  }
+
+  /* Convert the comparands with the same rules as the simplify path */
+  for (i = 0; i < nargs; i++) {
+    OrChainGroup *group = (groupOf[i] >= 0) ? &groups[groupOf[i]] : NULL;
+    ConstConversion conv;
+
+    if (group == NULL || group->values == NULL) {
+      continue;
+    }
+    if (consts[i]->constisnull) {
+      group->hasNull = true;
+      continue;
+    }
+    conv = convertConstToInt(consts[i], exprType(group->operand));
+    if (conv.valid && !conv.hasFraction) {
+      group->values[group->nvalues++] = conv.intVal;
+    }
+  }
+
+  i = 0;
+  foreach (lc, orExpr->args) {
+    OrChainGroup *group = (groupOf[i] >= 0) ? &groups[groupOf[i]] : NULL;
+    Node *rewritten;
+
+    i++;
+    if (group == NULL || group->values == NULL) {
+      result = lappend(result, lfirst(lc));
+      continue;
+    }
+    if (group->nclauses == 0) {
+      continue;                 /* already emitted */
+    }
+
+    group->nvalues = sortUniqueInt64(group->values, group->nvalues);
+    elog(DEBUG1, "num2int OR-chain rewrite: %d equalities, %d values kept, hasNull=%d",
+         group->nclauses, group->nvalues, group->hasNull);
+
+    rewritten = buildIntListComparison(OP_TYPE_EQ, group->operand,
+                                       exprType(group->operand),
+                                       group->values, group->nvalues,
+                                       group->hasNull, group->location);
+    group->nclauses = 0;
+    result = lappend(result, rewritten);
+  }
+
+  return (list_length(result) == 1) ? (Node *) linitial(result)
+                                    : (Node *) make_orclause(result);
+}
+
+/**
+ * @brief Check whether a query contains a candidate for the array rewrite
+ * @param node Query or expression tree
+ * @param context Unused
+ * @return true if a ScalarArrayOpExpr over an extension operator, or an OR
+ *         with an extension equality among its arguments, exists
+ *
+ * Cheap pre-check so that queries without candidates are not copied.
+ */
+static bool
+containsArrayRewriteCandidate(Node *node, void *context) {
+  if (node == NULL) {
+    return false;
+  }
+
+  if (IsA(node, ScalarArrayOpExpr)) {
+    ScalarArrayOpExpr *saop = (ScalarArrayOpExpr *) node;
+
+    if (saop->opno >= FirstNormalObjectId &&
+        findOpTypeByOid(saop->opno) != OP_TYPE_UNKNOWN) {
+      return true;
+    }
+  }
+
+  if (is_orclause(node)) {
+    ListCell *lc;
+
+    foreach (lc, ((BoolExpr *) node)->args) {
+      Node *arg = (Node *) lfirst(lc);
+
+      if (IsA(arg, OpExpr) &&
+          ((OpExpr *) arg)->opno >= FirstNormalObjectId &&
+          findOpTypeByOid(((OpExpr *) arg)->opno) == OP_TYPE_EQ) {
+        return true;
+      }
+    }
+  }
+
+  if (IsA(node, Query)) {
+    return query_tree_walker((Query *) node, containsArrayRewriteCandidate,
+                             context, 0);
+  }
+
+  return expression_tree_walker(node, containsArrayRewriteCandidate, context);
+}
+
+/**
+ * @brief Tree mutator applying the array rewrites bottom-up
+ * @param node Query or expression tree
+ * @param context ArrayRewriteContext
+ * @return Mutated tree
+ */
+static Node *
+arrayRewriteMutator(Node *node, void *context) {
+  if (node == NULL) {
+    return NULL;
+  }
+
+  if (IsA(node, Query)) {
+    return (Node *) query_tree_mutator((Query *) node, arrayRewriteMutator,
+                                       context, 0);
+  }
+
+  node = expression_tree_mutator(node, arrayRewriteMutator, context);
+
+  if (IsA(node, ScalarArrayOpExpr)) {
+    Node *rewritten = rewriteIntArrayOp((ScalarArrayOpExpr *) node,
+                                        (ArrayRewriteContext *) context);
+
+    if (rewritten == NULL) {
+      rewritten = rewriteInexactArrayOp((ScalarArrayOpExpr *) node,
+                                        (ArrayRewriteContext *) context);
+    }
+    if (rewritten != NULL) {
+      return rewritten;
+    }
+  } else if (is_orclause(node)) {
+    Node *rewritten = rewriteOrChain((BoolExpr *) node,
+                                     (ArrayRewriteContext *) context);
+
+    if (rewritten != NULL) {
+      return rewritten;
+    }
+  }
+
+  return node;
+}
+
+/*
+ * ============================================================================
+ * Planner Hook: Range Folding
+ * ============================================================================
+ * Each SupportRequestSimplify call sees one clause, so "v > 10.2 AND v < 10.8"
+ * becomes "v >= 11 AND v <= 10", which only the index scan finds empty. With
+ * pg_num2int_direct_comp.enableRangeFolding on, the planner hook simplifies
+ * the comparisons of each WHERE/ON conjunction, intersects the resulting
+ * integer bounds per operand and replaces them with a single equality, a
+ * single closed range or constant FALSE. Only qualifications are folded,
+ * where a NULL result and FALSE are equivalent.
+ */
+
+/**
+ * @brief Integer bounds collected for one operand of a conjunction
+ */
+typedef struct {
+  Node *operand;    /**< Integer-typed operand (simplified) */
+  Oid intType;      /**< Type of the operand */
+  int64 lower;      /**< Inclusive lower bound */
+  int64 upper;      /**< Inclusive upper bound */
+  int nclauses;     /**< Number of clauses restricting the operand */
+  int location;     /**< Location of the first clause */
+  bool emitted;     /**< Folded clauses already added to the result */
+} RangeFoldBounds;
+
+/**
+ * @brief Get the range of an integer type
+ */
+static void
+intTypeRange(Oid intType, int64 *typeMin, int64 *typeMax) {
+  if (intType == INT2OID) {
+    *typeMin = PG_INT16_MIN;
+    *typeMax = PG_INT16_MAX;
+  } else if (intType == INT4OID) {
+    *typeMin = PG_INT32_MIN;
+    *typeMax = PG_INT32_MAX;
+  } else {
+    *typeMin = PG_INT64_MIN;
+    *typeMax = PG_INT64_MAX;
+  }
+}
+
+/**
+ * @brief Classify a native same-type integer comparison operator
+ * @param opno Operator OID
+ * @param intType Integer type of both operands
+ * @return Operator type, or OP_TYPE_UNKNOWN
+ */
+static OpType
+nativeIntOpType(Oid opno, Oid intType) {
+  int opType;
+
+  for (opType = OP_TYPE_EQ; opType <= OP_TYPE_GE; opType++) {
+    if (getNativeOpOid((OpType) opType, intType) == opno) {
+      return (OpType) opType;
+    }
+  }
+  return OP_TYPE_UNKNOWN;
+}
+
+/**
+ * @brief Find the integer operand a qual clause may restrict
+ * @param clause Conjunct of a qualification
+ * @return Integer-typed operand, or NULL if the clause cannot be an equality
+ *         or range restriction
+ *
+ * Looks only at the shape of the clause, without simplifying it, so that
+ * foldRangeQuals() can group the clauses first and simplify only those on an
+ * operand restricted more than once: a cross-type comparison against an
+ * expression without Vars, or a native comparison against a constant.
+ */
+static Node *
+rangeClauseOperand(Node *clause) {
+  OpExpr *opExpr;
+  Node *leftop;
+  Node *rightop;
+  OpType opType;
+  bool isNative;
+
+  if (!IsA(clause, OpExpr) || list_length(((OpExpr *) clause)->args) != 2) {
+    return NULL;
+  }
+
+  opExpr = (OpExpr *) clause;
+  leftop = (Node *) linitial(opExpr->args);
+  rightop = (Node *) lsecond(opExpr->args);
+  opType = findOpTypeByOid(opExpr->opno);
+  isNative = (opType == OP_TYPE_UNKNOWN);
+  if (opType == OP_TYPE_NE) {
+    return NULL;
+  }
+
+  for (int side = 0; side < 2; side++) {
+    Node *operand = (side == 0) ? leftop : rightop;
+    Node *other = (side == 0) ? rightop : leftop;
+    Oid intType = exprType(operand);
+
+    if ((intType != INT2OID && intType != INT4OID && intType != INT8OID) ||
+        !isComparisonOperand(operand)) {
+      continue;
+    }
+    if (isNative) {
+      if (IsA(other, Const) && ((Const *) other)->consttype == intType &&
+          nativeIntOpType(opExpr->opno, intType) != OP_TYPE_UNKNOWN) {
+        return operand;
+      }
+    } else if (!contain_var_clause(other)) {
+      return operand;
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @brief Map a qual clause onto an inclusive integer range of its operand
+ * @param clause Conjunct of a qualification
+ * @param simplified Output: the clause, simplified if it is cross-type
+ * @param operand Output: integer-typed operand
+ * @param lower Output: inclusive lower bound
+ * @param upper Output: inclusive upper bound
+ * @param isEmpty Output: the clause is constant FALSE
+ * @return true if the clause is an equality or range restriction of an
+ *         integer operand (or constant FALSE)
+ *
+ * Cross-type comparisons are simplified first, so the bounds are exactly the
+ * native predicates num2int_support() produces; native integer comparisons
+ * against a constant of the same type are taken as they are.
+ */
+static bool
+rangeClauseBounds(Node *clause, Node **simplified, Node **operand,
+                  int64 *lower, int64 *upper, bool *isEmpty) {
+  OpExpr *opExpr;
+  Node *leftop;
+  Node *rightop;
+  Const *constNode;
+  Oid intType;
+  OpType opType;
+  int64 typeMin, typeMax;
+  int64 intVal;
+
+  *isEmpty = false;
+  *simplified = clause;
+
+  if (!IsA(clause, OpExpr) || list_length(((OpExpr *) clause)->args) != 2) {
+    return false;
+  }
+
+  if (findOpTypeByOid(((OpExpr *) clause)->opno) != OP_TYPE_UNKNOWN) {
+    clause = eval_const_expressions(NULL, (Node *) copyObject(clause));
+    *simplified = clause;
+    if (IsA(clause, Const)) {
+      Const *c = (Const *) clause;
+
+      *isEmpty = c->constisnull || !DatumGetBool(c->constvalue);
+      return *isEmpty;
+    }
+    if (!IsA(clause, OpExpr) || list_length(((OpExpr *) clause)->args) != 2) {
+      return false;
+    }
+  }
+
+  opExpr = (OpExpr *) clause;
+  leftop = (Node *) linitial(opExpr->args);
+  rightop = (Node *) lsecond(opExpr->args);
+  if (IsA(rightop, Const) && isComparisonOperand(leftop)) {
+    *operand = leftop;
+    constNode = (Const *) rightop;
+  } else if (IsA(leftop, Const) && isComparisonOperand(rightop)) {
+    *operand = rightop;
+    constNode = (Const *) leftop;
+  } else {
+    return false;
+  }
+
+  intType = exprType(*operand);
+  if ((intType != INT2OID && intType != INT4OID && intType != INT8OID) ||
+      constNode->consttype != intType || constNode->constisnull) {
+    return false;
+  }
+
+  opType = nativeIntOpType(opExpr->opno, intType);
+  if (constNode == (Const *) leftop) {
+    opType = commuteOpType(opType);
+  }
+
+  switch (intType) {
+    case INT2OID:
+      intVal = DatumGetInt16(constNode->constvalue);
+      break;
+    case INT4OID:
+      intVal = DatumGetInt32(constNode->constvalue);
+      break;
+    default:
+      intVal = DatumGetInt64(constNode->constvalue);
+      break;
+  }
+
+  intTypeRange(intType, &typeMin, &typeMax);
+  *lower = typeMin;
+  *upper = typeMax;
+
+  switch (opType) {
+    case OP_TYPE_EQ:
+      *lower = *upper = intVal;
+      break;
+    case OP_TYPE_GE:
+      *lower = intVal;
+      break;
+    case OP_TYPE_GT:
+      if (intVal == typeMax) {
+        *isEmpty = true;
+      } else {
+        *lower = intVal + 1;
+      }
+      break;
+    case OP_TYPE_LE:
+      *upper = intVal;
+      break;
+    case OP_TYPE_LT:
+      if (intVal == typeMin) {
+        *isEmpty = true;
+      } else {
+        *upper = intVal - 1;
+      }
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Fold the integer bounds of a qualification
+ * @param quals WHERE or JOIN/ON qualification (parse tree form)
+ * @return Folded qualification; quals itself if nothing was folded
+ *
+ * Only operands restricted by two or more clauses are folded. The clauses are
+ * grouped by rangeClauseOperand() first, and only those of operands with two
+ * or more are simplified, so a lone cross-type comparison is simplified once,
+ * by the planner, and counted once in the statistics. A simplified clause that
+ * is not folded takes the place of the original. The folded clauses take the
+ * place of the first clause on the operand; all other conjuncts keep their
+ * order. An operand whose bounds span the whole type keeps one bound, so NULLs
+ * are still rejected.
+ */
+static Node *
+foldRangeQuals(Node *quals) {
+  List *args;
+  int nargs;
+  Node **candidates;
+  int *ncandidates;
+  int *candidateOf;
+  Node **simplified;
+  int *groupOf;
+  RangeFoldBounds *groups;
+  int ncandidateGroups = 0;
+  int ngroups = 0;
+  bool anyFolded = false;
+  bool anySimplified = false;
+  List *result = NIL;
+  ListCell *lc;
+  int i;
+
+  if (quals == NULL || !is_andclause(quals)) {
+    return quals;
+  }
+
+  args = ((BoolExpr *) quals)->args;
+  nargs = list_length(args);
+  candidates = (Node **) palloc(nargs * sizeof(Node *));
+  ncandidates = (int *) palloc0(nargs * sizeof(int));
+  candidateOf = (int *) palloc(nargs * sizeof(int));
+  simplified = (Node **) palloc(nargs * sizeof(Node *));
+  groupOf = (int *) palloc(nargs * sizeof(int));
+  groups = (RangeFoldBounds *) palloc(nargs * sizeof(RangeFoldBounds));
+
+  /* Group by operand without simplifying anything */
+  i = 0;
+  foreach (lc, args) {
+    Node *operand = rangeClauseOperand((Node *) lfirst(lc));
+    int g;
+
+    candidateOf[i] = -1;
+    if (operand != NULL) {
+      for (g = 0; g < ncandidateGroups; g++) {
+        if (equal(candidates[g], operand)) {
+          break;
+        }
+      }
+      if (g == ncandidateGroups) {
+        candidates[ncandidateGroups++] = operand;
+      }
+      ncandidates[g]++;
+      candidateOf[i] = g;
+    }
+    i++;
+  }
+
+  i = 0;
+  foreach (lc, args) {
+    Node *operand;
+    int64 lower, upper;
+    bool isEmpty;
+    int g;
+
+    simplified[i] = (Node *) lfirst(lc);
+    groupOf[i] = -1;
+    if (candidateOf[i] >= 0 && ncandidates[candidateOf[i]] >= 2 &&
+        rangeClauseBounds((Node *) lfirst(lc), &simplified[i], &operand,
+                          &lower, &upper, &isEmpty)) {
+      if (isEmpty) {
+        return (Node *) makeBoolConst(false, false);
+      }
+      for (g = 0; g < ngroups; g++) {
+        if (equal(groups[g].operand, operand)) {
+          break;
+        }
+      }
+      if (g == ngroups) {
+        groups[g].operand = operand;
+        groups[g].intType = exprType(operand);
+        groups[g].lower = lower;
+        groups[g].upper = upper;
+        groups[g].nclauses = 0;
+        groups[g].location = exprLocation((Node *) lfirst(lc));
+        groups[g].emitted = false;
+        ngroups++;
+      }
+      groups[g].lower = Max(groups[g].lower, lower);
+      groups[g].upper = Min(groups[g].upper, upper);
+      groups[g].nclauses++;
+      groupOf[i] = g;
+    }
+    if (simplified[i] != (Node *) lfirst(lc)) {
+      anySimplified = true;
+    }
+    i++;
+  }
+
+  for (i = 0; i < ngroups; i++) {
+    if (groups[i].nclauses < 2) {
+      continue;
+    }
+    if (groups[i].lower > groups[i].upper) {
+      elog(DEBUG1, "range folding: empty range on operand %d", i);
+      return (Node *) makeBoolConst(false, false);
+    }
+    anyFolded = true;
+  }
+
+  if (!anyFolded && !anySimplified) {
+    return quals;
+  }
+
+  for (i = 0; i < nargs; i++) {
+    RangeFoldBounds *b = (groupOf[i] >= 0) ? &groups[groupOf[i]] : NULL;
+
+    if (b == NULL || b->nclauses < 2) {
+      result = lappend(result, simplified[i]);
+      continue;
+    }
+    if (b->emitted) {
+      continue;
+    }
+    b->emitted = true;
+
+    if (b->lower == b->upper) {
+      result = lappend(result,
+                       buildNativeOpExpr(getNativeOpOid(OP_TYPE_EQ, b->intType),
+                                         b->operand, b->lower, b->intType,
+                                         b->location, InvalidOid));
+    } else {
+      int64 typeMin, typeMax;
+
+      intTypeRange(b->intType, &typeMin, &typeMax);
+      if (b->lower > typeMin || b->upper == typeMax) {
+        result = lappend(result,
+                         buildNativeOpExpr(getNativeOpOid(OP_TYPE_GE, b->intType),
+                                           b->operand, b->lower, b->intType,
+                                           b->location, InvalidOid));
+      }
+      if (b->upper < typeMax) {
+        result = lappend(result,
+                         buildNativeOpExpr(getNativeOpOid(OP_TYPE_LE, b->intType),
+                                           b->operand, b->upper, b->intType,
+                                           b->location, InvalidOid));
+      }
+    }
+  }
+
+  return (list_length(result) == 1) ? (Node *) linitial(result)
+                                    : (Node *) make_andclause(result);
+}
+
+/*
+ * ============================================================================
+ * Planner Hook: Runtime Index Keys
+ * ============================================================================
+ * The comparisons against a runtime comparand are rewritten here rather than
+ * in num2int_support(): the key functions return NULL when no integer can
+ * match, so the rewrite is only correct where NULL and FALSE are equivalent.
+ * That holds for the conjuncts of a WHERE/ON qualification and for the
+ * AND/OR trees under them, but not under NOT, in target lists, CASE, or
+ * CHECK constraints, which keep the cross-type operator.
+ */
+
+/**
+ * @brief Context for the qualification rewrites of the planner hook
+ */
+typedef struct {
+  ParamListInfo boundParams;  /**< Parameter values (custom plans), or NULL */
+  bool foldRanges;            /**< Also run range folding */
+} QualRewriteContext;
+
+/**
+ * @brief Find parameters that eval_const_expressions() will substitute
+ */
+static bool
+containsBoundParamWalker(Node *node, void *context) {
+  if (node == NULL) {
+    return false;
+  }
+  if (IsA(node, Param)) {
+    return evalBoundParam((Param *) node, (ParamListInfo) context) != NULL;
+  }
+  return expression_tree_walker(node, containsBoundParamWalker, context);
+}
+
+/**
+ * @brief Rewrite the runtime-comparand comparisons of a qualification
+ * @param clause Qualification, or an AND/OR argument under one
+ * @param boundParams Parameter values for a custom plan, or NULL
+ * @return Rewritten clause; clause itself if nothing was rewritten
+ *
+ * Comparands with a parameter bound for a custom plan are left to
+ * num2int_support(), which sees them as constants.
+ */
+static Node *
+runtimeKeyQuals(Node *clause, ParamListInfo boundParams) {
+  OpExpr *opExpr;
+  OpType opType;
+  Node *leftop;
+  Node *rightop;
+  Node *ret = NULL;
+
+  if (clause == NULL) {
+    return NULL;
+  }
+
+  if (is_andclause(clause) || is_orclause(clause)) {
+    ListCell *lc;
+
+    foreach (lc, ((BoolExpr *) clause)->args) {
+      lfirst(lc) = runtimeKeyQuals((Node *) lfirst(lc), boundParams);
+    }
+    return clause;
+  }
+
+  if (!IsA(clause, OpExpr)) {
+    return clause;
+  }
+  opExpr = (OpExpr *) clause;
+  if (opExpr->opno < FirstNormalObjectId || list_length(opExpr->args) != 2) {
+    return clause;
+  }
+  opType = findOpTypeByOid(opExpr->opno);
+  if (opType == OP_TYPE_UNKNOWN) {
+    return clause;
+  }
+
+  leftop = (Node *) linitial(opExpr->args);
+  rightop = (Node *) lsecond(opExpr->args);
+  if (isComparisonOperand(leftop) && isRuntimeKeyExpr(rightop)) {
+    if (!containsBoundParamWalker(rightop, boundParams)) {
+      ret = buildRuntimeKeyPredicate(opType, leftop, rightop,
+                                     opExpr->location);
+    }
+  } else if (isComparisonOperand(rightop) && isRuntimeKeyExpr(leftop)) {
+    if (!containsBoundParamWalker(leftop, boundParams)) {
+      ret = buildRuntimeKeyPredicate(commuteOpType(opType), rightop, leftop,
+                                     opExpr->location);
+    }
+  }
+
+  if (ret == NULL) {
+    return clause;
+  }
+  countStat(NUM2INT_STAT_SIMPLIFIED_RUNTIME_KEY);
+  return ret;
+}
+
+/**
+ * @brief Tree walker rewriting the qualifications of every query level
+ * @param node Query or expression tree
+ * @param context Rewrite context (QualRewriteContext)
+ * @return Always false (walk the whole tree)
+ */
+static bool
+qualRewriteWalker(Node *node, void *context) {
+  QualRewriteContext *ctx = (QualRewriteContext *) context;
+  Node **quals = NULL;
+
+  if (node == NULL) {
+    return false;
+  }
+
+  if (IsA(node, Query)) {
+    return query_tree_walker((Query *) node, qualRewriteWalker, context, 0);
+  }
+
+  if (IsA(node, FromExpr)) {
+    quals = &((FromExpr *) node)->quals;
+  } else if (IsA(node, JoinExpr)) {
+    quals = &((JoinExpr *) node)->quals;
+  }
+  if (quals != NULL) {
+    *quals = runtimeKeyQuals(*quals, ctx->boundParams);
+    if (ctx->foldRanges) {
+      *quals = foldRangeQuals(*quals);
+    }
+  }
+
+  return expression_tree_walker(node, qualRewriteWalker, context);
+}
+
+/**
+ * @brief Planner hook: rewrite cross-type constant-array comparisons
+ *
+ * Runs the rewrite on the query tree (including sublinks, subqueries and
+ * CTEs), then the runtime index key rewrite of the qualifications and range
+ * folding if pg_num2int_direct_comp.enableRangeFolding is on, and hands off
+ * to the previous hook or standard_planner(). Disabled together with the
+ * support functions by pg_num2int_direct_comp.enableSupportFunctions.
+ */
+static PlannedStmt *
+#if PG_VERSION_NUM >= 130000
+num2intPlanner(Query *parse, const char *queryString, int cursorOptions,
+               ParamListInfo boundParams)
+#else
+num2intPlanner(Query *parse, int cursorOptions, ParamListInfo boundParams)
+#endif
+{
+  if (enableSupportFunctions &&
+      containsArrayRewriteCandidate((Node *) parse, NULL)) {
+    ArrayRewriteContext context = {.boundParams = boundParams};
+
+    parse = query_tree_mutator(parse, arrayRewriteMutator, &context,
+                               QTW_DONT_COPY_QUERY);
+  }
+
+  if (enableSupportFunctions) {
+    QualRewriteContext context = {.boundParams = boundParams,
+                                  .foldRanges = enableRangeFolding};
+
+    qualRewriteWalker((Node *) parse, &context);
+  }
+
+#if PG_VERSION_NUM >= 130000
+  if (prevPlannerHook) {
+    return prevPlannerHook(parse, queryString, cursorOptions, boundParams);
+  }
+  return standard_planner(parse, queryString, cursorOptions, boundParams);
+#else
+  if (prevPlannerHook) {
+    return prevPlannerHook(parse, cursorOptions, boundParams);
+  }
+  return standard_planner(parse, cursorOptions, boundParams);
+#endif
+}
+
+/*
+ * ============================================================================
+ * Main Support Function
+ * ============================================================================
+ */
+
+/**
+ * @brief Support function for query optimization
+ * @param fcinfo Function call context
+ * @return Node pointer for simplified expression, the answered request, or NULL
+ *
+ * SupportRequestSimplify simplifies constant predicates during query planning:
+ * - Equality with fractional value → FALSE (no integer can equal a fraction)
+ * - Equality with exact integer → native integer operator (enables index use)
+ * - Range with fraction → adjusted boundary (e.g., > 10.5 becomes >= 11)
+ * - Out-of-range constants → TRUE/FALSE based on operator semantics
+ *
+ * Index optimization works because transformed expressions use native integer
+ * operators which the planner automatically recognizes for btree index scans.
+ *
+ * SupportRequestSelectivity estimates direct calls of the comparison
+ * functions through the corresponding operator's estimators.
+ *
+ * SupportRequestCost reports the per-call cost of the comparison, which
+ * depends on the operand types (see NUM2INT_COST_* constants).
+ */
+PG_FUNCTION_INFO_V1(num2int_support);
+Datum
+num2int_support(PG_FUNCTION_ARGS) {
+  Node *rawreq = (Node *) PG_GETARG_POINTER(0);
+  Node *ret = NULL;
+
+  /* Initialize OID cache on first use */
+  initOidCache(&oidCache);
+
+  if (IsA(rawreq, SupportRequestSimplify)) {
+    /*
+     * SupportRequestSimplify: Transform constant predicates at simplification time
+     *
+     * - FR-015: Equality with fractional value → FALSE
+     * - FR-016: Equality with exact integer → native operator
+     * - FR-017: Range with fraction → adjusted boundary
+     */
+    SupportRequestSimplify *req = (SupportRequestSimplify *) rawreq;
+    FuncExpr *func = req->fcall;
+    Node *leftop;
+    Node *rightop;
+    Node *operand = NULL;
+    Oid operandType;
+    Const *constNode = NULL;
+    OpType opType;
+    Oid opno;
+    Oid intType;
+    ConstConversion conv;
+    Oid nativeOpOid;
+    int64 intVal;
+    bool isAlwaysTrue, isAlwaysFalse;
+
+    countStat(NUM2INT_STAT_SIMPLIFY_CALLS);
+
+    /* Check if support functions are disabled via GUC */
+    if (!enableSupportFunctions) {
+      countBailout(NUM2INT_STAT_BAILOUT_DISABLED);
+      PG_RETURN_POINTER(NULL);
+    }
+
+    elog(DEBUG1, "SupportRequestSimplify called for function %u", func->funcid);
+
+    if (list_length(func->args) != 2) {
+      countBailout(NUM2INT_STAT_BAILOUT_UNSUPPORTED_SHAPE);
+      PG_RETURN_POINTER(NULL);
+    }
+
+    leftop = (Node *) linitial(func->args);
+    rightop = (Node *) lsecond(func->args);
+
+    /* Identify operand and Const positions and determine their types */
+    if (IsA(leftop, Const) && isComparisonOperand(rightop)) {
+      constNode = (Const *) leftop;
+      operand = rightop;
+    } else if (isComparisonOperand(leftop) && IsA(rightop, Const)) {
+      operand = leftop;
+      constNode = (Const *) rightop;
+    } else if ((isComparisonOperand(leftop) && isRuntimeKeyExpr(rightop)) ||
+               (isComparisonOperand(rightop) && isRuntimeKeyExpr(leftop))) {
+      /*
+       * Comparand only known at execution time. Qualifications were already
+       * rewritten to runtime index keys by the planner hook (see
+       * runtimeKeyQuals()); anywhere else FALSE must stay FALSE.
+       */
+      countBailout(NUM2INT_STAT_BAILOUT_RUNTIME_KEY);
+      PG_RETURN_POINTER(NULL);
+    } else {
+      countBailout(NUM2INT_STAT_BAILOUT_NO_CONSTANT);
+      PG_RETURN_POINTER(NULL);
+    }
+
+    if (constNode->constisnull) {
+      countBailout(NUM2INT_STAT_BAILOUT_NULL_CONSTANT);
+      PG_RETURN_POINTER(NULL);
+    }
+
+    /* Find the operator that uses this function */
+    opno = findOperatorByFuncid(func->funcid, &opType);
+    if (opno == InvalidOid) {
+      countBailout(NUM2INT_STAT_BAILOUT_UNKNOWN_FUNCTION);
+      PG_RETURN_POINTER(NULL);
+    }
+
+    /* Classify as "var op const": 10.5 < col is col > 10.5 */
+    if (constNode == (Const *) leftop) {
+      opType = commuteOpType(opType);
+    }
+
+    /* Inexact column vs integer constant: native inexact comparison */
+    operandType = exprType(operand);
+    if (operandType == NUMERICOID || operandType == FLOAT4OID ||
+        operandType == FLOAT8OID) {
+      Datum value = (Datum) 0;
+
+      switch (constNode->consttype) {
+        case INT2OID:
+          intVal = DatumGetInt16(constNode->constvalue);
+          break;
+        case INT4OID:
+          intVal = DatumGetInt32(constNode->constvalue);
+          break;
+        case INT8OID:
+          intVal = DatumGetInt64(constNode->constvalue);
+          break;
+        default:
+          countBailout(NUM2INT_STAT_BAILOUT_UNSUPPORTED_SHAPE);
+          PG_RETURN_POINTER(NULL);
+      }
+
+      nativeOpOid = computeInexactPredicate(opType, operandType, intVal,
+                                            &value, &isAlwaysTrue,
+                                            &isAlwaysFalse);
+      elog(DEBUG1,
+           "SupportRequestSimplify: inexact varType=%u, intVal=" INT64_FORMAT
+           ", nativeOp=%u, alwaysTrue=%d, alwaysFalse=%d",
+           operandType, intVal, nativeOpOid, isAlwaysTrue,
+           isAlwaysFalse);
+
+      if (isAlwaysTrue || isAlwaysFalse) {
+        /* "col <> x" becomes "col IS NOT NULL", "col = x" never matches */
+        ret = makeNullPreservingBool(operand, isAlwaysTrue, func->location);
+      } else if (OidIsValid(nativeOpOid)) {
+        OpExpr *newClause = (OpExpr *) make_opclause(
+            nativeOpOid, BOOLOID, false, (Expr *) copyObject(operand),
+            (Expr *) makeInexactConst(operandType, value),
+            InvalidOid, InvalidOid);
+
+        newClause->location = func->location;
+        ret = (Node *) newClause;
+      }
+      if (isAlwaysTrue || isAlwaysFalse) {
+        countStat(NUM2INT_STAT_SIMPLIFIED_CONSTANT);
+      } else if (ret != NULL) {
+        countStat(NUM2INT_STAT_SIMPLIFIED_NATIVE);
+      } else {
+        countBailout(NUM2INT_STAT_BAILOUT_UNSUPPORTED_SHAPE);
+      }
+      PG_RETURN_POINTER(ret);
+    }
+
+    /* Convert constant to integer */
+    intType = operandType;
+    conv = convertConstToInt(constNode, intType);
+
+    elog(DEBUG1,
+       "SupportRequestSimplify: constType=%u, varType=%u, valid=%d, "
+       "hasFraction=%d, outOfRangeLow=%d, outOfRangeHigh=%d, "
+       "intVal=%ld",
+       constNode->consttype, operandType, conv.valid,
+       conv.hasFraction, conv.outOfRangeLow, conv.outOfRangeHigh,
+       conv.intVal);
+
+    nativeOpOid = computeIntPredicate(opType, intType, &conv, &intVal,
+                                      &isAlwaysTrue, &isAlwaysFalse);
+    if (isAlwaysTrue) {
+      ret = (Node *) makeBoolConst(true, false);
+    } else if (isAlwaysFalse) {
+      ret = (Node *) makeBoolConst(false, false);
+    } else if (OidIsValid(nativeOpOid)) {
+      ret = (Node *) buildNativeOpExpr(nativeOpOid, operand, intVal,
+                                       intType, func->location, InvalidOid);
+    }
+
+    if (isAlwaysTrue || isAlwaysFalse) {
+      countStat(NUM2INT_STAT_SIMPLIFIED_CONSTANT);
+    } else if (ret != NULL) {
+      countStat(NUM2INT_STAT_SIMPLIFIED_NATIVE);
+    } else if (conv.isSpecial) {
+      countBailout(NUM2INT_STAT_BAILOUT_SPECIAL_VALUE);
+    } else {
+      countBailout(NUM2INT_STAT_BAILOUT_UNSUPPORTED_SHAPE);
+    }
+  } else if (IsA(rawreq, SupportRequestSelectivity)) {
+    /*
+     * SupportRequestSelectivity: the comparison function was called directly
+     * (e.g. WHERE numeric_eq_int4(x, col)) rather than through its operator.
+     * Estimate it exactly as the operator would be estimated.
+     */
+    SupportRequestSelectivity *req = (SupportRequestSelectivity *) rawreq;
+    OpType opType;
+    Oid opno;
+
+    if (!enableSupportFunctions) {
+      PG_RETURN_POINTER(NULL);
+    }
+
+    opno = findOperatorByFuncid(req->funcid, &opType);
+    if (opno == InvalidOid || list_length(req->args) != 2) {
+      PG_RETURN_POINTER(NULL);
+    }
+
+    if (req->is_join) {
+      req->selectivity = join_selectivity(req->root, opno, req->args,
+                                          req->inputcollid, req->jointype,
+                                          req->sjinfo);
+    } else {
+      req->selectivity = restriction_selectivity(req->root, opno, req->args,
+                                                 req->inputcollid,
+                                                 req->varRelid);
+    }
+    ret = (Node *) req;
+  } else if (IsA(rawreq, SupportRequestCost)) {
+    /*
+     * SupportRequestCost: report the per-call cost of the comparison instead
+     * of the flat procost, so that numeric × integer quals are weighed by
+     * whether they take the integral fast path.
+     */
+    SupportRequestCost *req = (SupportRequestCost *) rawreq;
+
+    if (!enableSupportFunctions) {
+      PG_RETURN_POINTER(NULL);
+    }
+
+    req->startup = 0;
+    req->per_tuple = estimateComparisonCost(req->funcid, req->node);
+    ret = (Node *) req;
+  }
+
+  PG_RETURN_POINTER(ret);
+}
+
+/*
+ * ============================================================================
+ * Per-Call-Site Comparison Cache
+ * ============================================================================
+ * Comparisons that survive planning as real cross-type calls (filters on a
+ * numeric/float column against an integer constant, constants the support
+ * function does not rewrite, enableSupportFunctions = off) usually have one
+ * operand that is the same on every call. The operator wrappers keep a
+ * Num2IntCmpCache in fn_extra with that operand pre-decoded, so each row only
+ * classifies the varying operand:
+ *   - constant inexact operand: its floor and fraction flag, so comparing with
+ *     an integer is two integer compares
+ *   - constant integer operand: its base-NBASE digit image (for numeric) or
+ *     its nearest float and rounding direction (for float4/float8)
+ * The cached operand is compared with the current argument on every call and
+ * re-decoded when it differs, so a stable argument whose value changes
+ * between calls (for example a PL/pgSQL variable) is still handled correctly.
+ * The array of a ScalarArrayOpExpr is never cached: the operator sees a
+ * different element on every call (see isCacheableArg()).
+ *
+ * When the numeric operand varies but its declared type is numeric(p,0) with
+ * p <= 18 (see isIntegralNumericTypmod()), every value is an integer within
+ * int64, so it is converted straight to int64 without the fraction and
+ * overflow handling of numericCmpInt64Direct(). This covers filters against
+ * integer parameters and nested-loop join quals such as
+ * numeric18_col = int8_col.
+ */
+
+/**
+ * @brief Check whether a call argument is declared numeric(p,0), p <= 18
+ * @param flinfo Function call information with the calling expression
+ * @param argnum Argument number
+ * @return true if every value of the argument is an integer within int64
+ */
+static bool
+isIntegralNumericArg(FmgrInfo *flinfo, int argnum) {
+  List *args;
+  Node *arg;
+
+  if (flinfo->fn_expr == NULL) {
+    return false;
+  }
+  if (IsA(flinfo->fn_expr, FuncExpr)) {
+    args = ((FuncExpr *) flinfo->fn_expr)->args;
+  } else if (IsA(flinfo->fn_expr, OpExpr)) {
+    args = ((OpExpr *) flinfo->fn_expr)->args;
+  } else {
+    return false;
+  }
+  if (argnum < 0 || argnum >= list_length(args)) {
+    return false;
+  }
+
+  arg = (Node *) list_nth(args, argnum);
+  return exprType(arg) == NUMERICOID &&
+         isIntegralNumericTypmod(exprTypmod(arg));
+}
+
+/**
+ * @brief Check whether a call argument is the same on every call
+ * @param flinfo Function call information with the calling expression
+ * @param argnum Argument number
+ * @return true if the argument is stable and not the array of a
+ *         ScalarArrayOpExpr
+ *
+ * A ScalarArrayOpExpr calls the operator once per array element, so its
+ * array argument is stable while the operand the operator sees changes on
+ * every call; caching it would re-decode (and for numeric re-copy) each
+ * element.
+ */
+static bool
+isCacheableArg(FmgrInfo *flinfo, int argnum) {
+  if (flinfo->fn_expr != NULL && IsA(flinfo->fn_expr, ScalarArrayOpExpr) &&
+      argnum == 1) {
+    return false;
+  }
+  return get_fn_expr_arg_stable(flinfo, argnum);
+}
+
+/**
+ * @brief Create the comparison cache of a call site on its first call
+ * @param flinfo FmgrInfo of an operator wrapper
+ * @param inexactArg Argument number of the numeric/float operand (0 or 1)
+ * @return New cache, stored in fn_extra
+ */
+Num2IntCmpCache *
+createCmpCache(FmgrInfo *flinfo, int inexactArg) {
+  Num2IntCmpCache *cache;
+
+  cache = (Num2IntCmpCache *) MemoryContextAllocZero(flinfo->fn_mcxt,
+                                                     sizeof(Num2IntCmpCache));
+  if (isCacheableArg(flinfo, inexactArg)) {
+    cache->mode = NUM2INT_CMP_CACHE_INEXACT;
+  } else if (isIntegralNumericArg(flinfo, inexactArg)) {
+    cache->mode = NUM2INT_CMP_CACHE_INTEGRAL;
+  } else if (isCacheableArg(flinfo, 1 - inexactArg)) {
+    cache->mode = NUM2INT_CMP_CACHE_INT;
+  } else {
+    cache->mode = NUM2INT_CMP_CACHE_NONE;
+  }
+  flinfo->fn_extra = cache;
+
+  return cache;
+}
+
+/**
+ * @brief Get the comparison cache of a call site
+ * @param fcinfo Function call information of an operator wrapper
+ * @param inexactArg Argument number of the numeric/float operand (0 or 1)
+ * @return Cache, or NULL if no operand is stable and the numeric operand is
+ *         not integral by typmod (or there is no FmgrInfo)
+ */
+static inline Num2IntCmpCache *
+getCmpCache(FunctionCallInfo fcinfo, int inexactArg) {
+  FmgrInfo *flinfo = fcinfo->flinfo;
+  Num2IntCmpCache *cache;
+
+  if (flinfo == NULL) {
+    return NULL;
+  }
+
+  cache = (Num2IntCmpCache *) flinfo->fn_extra;
+  if (unlikely(cache == NULL)) {
+    cache = createCmpCache(flinfo, inexactArg);
+  }
+
+  return (cache->mode == NUM2INT_CMP_CACHE_NONE) ? NULL : cache;
+}
+
+/**
+ * @brief Decode a stable numeric/float operand into floor and fraction
+ * @param cache Cache to fill
+ * @param value Operand value
+ * @param valueType NUMERICOID, FLOAT4OID or FLOAT8OID
+ */
+void
+cacheInexactOperand(Num2IntCmpCache *cache, Datum value, Oid valueType) {
+  Const valueConst;
+  ConstConversion conv;
+
+  cache->fixedCmp = 0;
+  if (valueType == NUMERICOID) {
+    Numeric num = DatumGetNumeric(value);
+
+    if (NUM2INT_NUMERIC_IS_SPECIAL(num)) {
+      cache->fixedCmp = NUM2INT_NUMERIC_IS_NINF(num) ? -1 : 1;
+    }
+  } else {
+    float8 fval = DatumGetFloat8(value);
+
+    if (valueType == FLOAT4OID) {
+      fval = (float8) DatumGetFloat4(value);
+    }
+    if (isnan(fval)) {
+      cache->fixedCmp = 1;   /* NaN sorts above every integer */
+    } else if (isinf(fval)) {
+      cache->fixedCmp = (fval > 0) ? 1 : -1;
+    }
+  }
+
+  if (cache->fixedCmp == 0) {
+    memset(&valueConst, 0, sizeof(valueConst));
+    valueConst.xpr.type = T_Const;
+    valueConst.consttype = valueType;
+    valueConst.constvalue = value;
+    conv = convertConstToInt(&valueConst, INT8OID);
+
+    if (conv.outOfRangeHigh) {
+      cache->fixedCmp = 1;
+    } else if (conv.outOfRangeLow) {
+      cache->fixedCmp = -1;
+    } else {
+      cache->floorVal = conv.intVal;
+      cache->hasFraction = conv.hasFraction;
+    }
+  }
+  cache->valid = true;
+}
+
+/**
+ * @brief Copy a stable numeric operand into the cache and decode it
+ * @param flinfo FmgrInfo owning the cache
+ * @param cache Cache to fill
+ * @param num Operand value
+ */
+void
+cacheNumericOperand(FmgrInfo *flinfo, Num2IntCmpCache *cache, Numeric num) {
+  Size size = VARSIZE(num);
+
+  if (cache->numKey != NULL) {
+    pfree(cache->numKey);
+  }
+  cache->numKey = (Numeric) MemoryContextAlloc(flinfo->fn_mcxt, size);
+  memcpy(cache->numKey, num, size);
+  cacheInexactOperand(cache, NumericGetDatum(cache->numKey), NUMERICOID);
+}
+
+/**
+ * @brief Compare the cached inexact operand with an integer
+ * @return -1, 0 or 1 as cached operand <, =, > ival
+ */
+static inline int
+cmpCachedInexact(const Num2IntCmpCache *cache, int64 ival) {
+  if (cache->fixedCmp != 0)
+    return cache->fixedCmp;
+  if (cache->floorVal < ival)
+    return -1;      /* operand < floor + 1 <= ival */
+  if (cache->floorVal > ival)
+    return 1;
+  return cache->hasFraction ? 1 : 0;
+}
+
+/**
+ * @brief Decode a stable integer operand
+ * @param cache Cache to fill
+ * @param ival Integer operand
+ * @param floatType FLOAT4OID or FLOAT8OID to prepare float comparisons,
+ *        NUMERICOID to prepare the base-NBASE digit image
+ */
+void
+cacheIntOperand(Num2IntCmpCache *cache, int64 ival, Oid floatType) {
+  cache->intKey = ival;
+
+  if (floatType == NUMERICOID) {
+    Num2IntNumericDigit digits[5];
+    uint64 mag = (ival < 0) ? -((uint64) ival) : (uint64) ival;
+    int n = 0;
+
+    cache->intSign = (ival > 0) ? 1 : ((ival < 0) ? -1 : 0);
+    while (mag > 0) {
+      digits[n++] = (Num2IntNumericDigit) (mag % NUM2INT_NBASE);
+      mag /= NUM2INT_NBASE;
+    }
+    cache->intWeight = n - 1;
+    for (int i = 0; i < n; i++) {
+      cache->intDigits[i] = digits[n - 1 - i];
+    }
+    while (n > 0 && cache->intDigits[n - 1] == 0) {
+      n--;
+    }
+    cache->intNdigits = n;
+  } else {
+    /*
+     * (float) ival may round up to 2^63, which is outside int64 and cannot be
+     * converted back; it is then above ival.
+     */
+    if (floatType == FLOAT4OID) {
+      float4 rounded = (float4) ival;
+
+      cache->intAsFloat = (float8) rounded;
+      if (rounded >= FLOAT4_INT64_MAX) {
+        cache->intFloatExact = false;
+        cache->intFloatBelow = false;
+      } else {
+        cache->intFloatExact = ((int64) rounded == ival);
+        cache->intFloatBelow = ((int64) rounded < ival);
+      }
+    } else {
+      float8 rounded = (float8) ival;
+
+      cache->intAsFloat = rounded;
+      if (rounded >= FLOAT8_INT64_MAX) {
+        cache->intFloatExact = false;
+        cache->intFloatBelow = false;
+      } else {
+        cache->intFloatExact = ((int64) rounded == ival);
+        cache->intFloatBelow = ((int64) rounded < ival);
+      }
+    }
+  }
+  cache->valid = true;
+}
+
+/**
+ * @brief Compare a numeric with the cached integer operand's digit image
+ * @return -1, 0 or 1 as num <, =, > cached integer
+ *
+ * Relies on stored numerics having no leading or trailing zero digits, which
+ * PostgreSQL guarantees for every value it constructs.
+ */
+static inline int
+cmpNumericCachedInt(Numeric num, const Num2IntCmpCache *cache) {
+  Num2IntNumericInfo info;
+  int mag = 0;
+
+  decodeNumericHeader(num, &info);
+  if (info.special != 0) {
+    return info.special;
+  }
+
+  if (info.sign != cache->intSign) {
+    return (info.sign < cache->intSign) ? -1 : 1;
+  }
+  if (info.sign == 0) {
+    return 0;
+  }
+
+  /* Same sign: compare magnitudes digit by digit */
+  if (info.weight != cache->intWeight) {
+    mag = (info.weight > cache->intWeight) ? 1 : -1;
+  } else {
+    for (int i = 0; i < info.ndigits && i < cache->intNdigits; i++) {
+      if (info.digits[i] != cache->intDigits[i]) {
+        mag = (info.digits[i] > cache->intDigits[i]) ? 1 : -1;
+        break;
+      }
+    }
+    if (mag == 0 && info.ndigits != cache->intNdigits) {
+      mag = (info.ndigits > cache->intNdigits) ? 1 : -1;
+    }
+  }
+
+  return (info.sign > 0) ? mag : -mag;
+}
+
+/**
+ * @brief Compare a float with the cached integer operand
+ * @return -1, 0 or 1 as fval <, =, > cached integer
+ *
+ * intAsFloat is the integer rounded to nearest, so a float below (above) it
+ * is below (above) the integer, and a float equal to it equals the integer
+ * only if the rounding was exact.
+ */
+static inline int
+cmpFloatCachedInt(float8 fval, const Num2IntCmpCache *cache) {
+  if (isnan(fval))
+    return 1;
+  if (fval < cache->intAsFloat)
+    return -1;
+  if (fval > cache->intAsFloat)
+    return 1;
+  if (cache->intFloatExact)
+    return 0;
+  return cache->intFloatBelow ? -1 : 1;
+}
+
+/**
+ * @brief Compare a numeric whose typmod makes it integral with an integer
+ * @param num Numeric operand of a numeric(p,0) expression, p <= 18
+ * @param val Integer operand
+ * @return -1 if num < val, 0 if num == val, 1 if num > val
+ *
+ * The only special value such a column can hold is NaN. Unlike
+ * numericCmpInt64Direct() there is no sign pre-check: every such value fits
+ * in int64, so the digits are decoded straight away. Values that do not
+ * match the declared typmod are still handled correctly by the decoder.
+ */
+static inline int
+integralNumericCmpInt64(Numeric num, int64 val) {
+  Num2IntNumericInfo info;
+
+  decodeNumericHeader(num, &info);
+  if (info.special == 0) {
+    decodeNumericValue(&info);
+  }
+  return cmpDecodedNumericInt64(&info, val);
+}
+
+/**
+ * @brief Compare numeric with integer, using the call site's cache
+ * @param fcinfo Function call information of the operator wrapper
+ * @param numArg Argument number of the numeric operand
+ * @param num Numeric operand
+ * @param val Integer operand
+ * @return -1 if num < val, 0 if num == val, 1 if num > val
+ */
+static inline int
+numericCmpIntCached(FunctionCallInfo fcinfo, int numArg, Numeric num,
+                    int64 val) {
+  Num2IntCmpCache *cache = getCmpCache(fcinfo, numArg);
+
+  if (cache == NULL) {
+    return numericCmpInt64Direct(num, val);
+  }
+
+  if (cache->mode == NUM2INT_CMP_CACHE_INTEGRAL) {
+    return integralNumericCmpInt64(num, val);
+  }
+
+  if (cache->mode == NUM2INT_CMP_CACHE_INEXACT) {
+    Size size = VARSIZE(num);
+
+    if (!cache->valid || VARSIZE(cache->numKey) != size ||
+        memcmp(cache->numKey, num, size) != 0) {
+      cacheNumericOperand(fcinfo->flinfo, cache, num);
+    }
+    return cmpCachedInexact(cache, val);
+  }
+
+  if (!cache->valid || cache->intKey != val) {
+    cacheIntOperand(cache, val, NUMERICOID);
+  }
+  return cmpNumericCachedInt(num, cache);
+}
+
+/**
+ * @brief Test numeric = integer, using the call site's cache
+ *
+ * Without a cache this keeps the early-out equality path of
+ * numericEqInt64Direct().
+ */
+static inline bool
+numericEqIntCached(FunctionCallInfo fcinfo, int numArg, Numeric num,
+                   int64 val) {
+  if (getCmpCache(fcinfo, numArg) == NULL) {
+    return numericEqInt64Direct(num, val);
+  }
+  return numericCmpIntCached(fcinfo, numArg, num, val) == 0;
+}
+
+/**
+ * @brief Compare float with integer, using the call site's cache
+ * @param fcinfo Function call information of the operator wrapper
+ * @param floatArg Argument number of the float operand
+ * @param fval Float operand (float4 values are widened exactly)
+ * @param floatType FLOAT4OID or FLOAT8OID
+ * @param ival Integer operand
+ * @param intType Integer operand type, selecting the uncached comparison
+ * @return -1 if fval < ival, 0 if fval == ival, 1 if fval > ival
+ *
+ * Inlined into the wrappers, where floatType and intType are constants.
+ */
+static inline int
+floatCmpIntCached(FunctionCallInfo fcinfo, int floatArg, float8 fval,
+                  Oid floatType, int64 ival, Oid intType) {
+  Num2IntCmpCache *cache = getCmpCache(fcinfo, floatArg);
+
+  if (cache == NULL) {
+    if (floatType == FLOAT4OID) {
+      if (intType == INT2OID)
+        return float4_cmp_int2_internal((float4) fval, (int16) ival);
+      if (intType == INT4OID)
+        return float4_cmp_int4_internal((float4) fval, (int32) ival);
+      return float4_cmp_int8_internal((float4) fval, ival);
+    }
+    if (intType == INT2OID)
+      return float8_cmp_int2_internal(fval, (int16) ival);
+    if (intType == INT4OID)
+      return float8_cmp_int4_internal(fval, (int32) ival);
+    return float8_cmp_int8_internal(fval, ival);
+  }
+
+  if (cache->mode == NUM2INT_CMP_CACHE_INEXACT) {
+    /* Bitwise comparison, so that NaN keys are recognized */
+    if (!cache->valid || memcmp(&cache->floatKey, &fval, sizeof(fval)) != 0) {
+      cache->floatKey = fval;
+      cacheInexactOperand(cache, Float8GetDatum(fval), FLOAT8OID);
+    }
+    return cmpCachedInexact(cache, ival);
+  }
+
+  if (!cache->valid || cache->intKey != ival) {
+    cacheIntOperand(cache, ival, floatType);
+  }
+  return cmpFloatCachedInt(fval, cache);
+}
+
+/*
+ * Btree support function wrappers
+ *
+ * These SQL-callable wrappers expose the internal comparison functions
+ * for btree operator family support function registration.
+ * Each returns int4: -1 for <, 0 for =, 1 for >
+ */
+
+PG_FUNCTION_INFO_V1(numeric_cmp_int2);
+Datum
+numeric_cmp_int2(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int16 val = PG_GETARG_INT16(1);
+  PG_RETURN_INT32(numeric_cmp_int2_internal(num, val));
+}
+
+PG_FUNCTION_INFO_V1(numeric_cmp_int4);
+Datum
+numeric_cmp_int4(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int32 val = PG_GETARG_INT32(1);
+  PG_RETURN_INT32(numeric_cmp_int4_internal(num, val));
+}
+
+PG_FUNCTION_INFO_V1(numeric_cmp_int8);
+Datum
+numeric_cmp_int8(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int64 val = PG_GETARG_INT64(1);
+  PG_RETURN_INT32(numeric_cmp_int8_internal(num, val));
+}
+
+/*
+ * Reverse comparison functions for int <op> numeric
+ * These are needed for the integer_ops btree family where the integer
+ * is the left (indexed) operand.
+ * int_cmp_numeric(i, n) = -numeric_cmp_int(n, i)
+ */
+PG_FUNCTION_INFO_V1(int2_cmp_numeric);
+Datum
+int2_cmp_numeric(PG_FUNCTION_ARGS) {
+  int16 val = PG_GETARG_INT16(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  PG_RETURN_INT32(-numeric_cmp_int2_internal(num, val));
+}
+
+PG_FUNCTION_INFO_V1(int4_cmp_numeric);
+Datum
+int4_cmp_numeric(PG_FUNCTION_ARGS) {
+  int32 val = PG_GETARG_INT32(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  PG_RETURN_INT32(-numeric_cmp_int4_internal(num, val));
+}
+
+PG_FUNCTION_INFO_V1(int8_cmp_numeric);
+Datum
+int8_cmp_numeric(PG_FUNCTION_ARGS) {
+  int64 val = PG_GETARG_INT64(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  PG_RETURN_INT32(-numeric_cmp_int8_internal(num, val));
+}
+
+PG_FUNCTION_INFO_V1(float4_cmp_int2);
+Datum
+float4_cmp_int2(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int16 ival = PG_GETARG_INT16(1);
+  PG_RETURN_INT32(float4_cmp_int2_internal(fval, ival));
+}
+
+PG_FUNCTION_INFO_V1(float4_cmp_int4);
+Datum
+float4_cmp_int4(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int32 ival = PG_GETARG_INT32(1);
+  PG_RETURN_INT32(float4_cmp_int4_internal(fval, ival));
+}
+
+PG_FUNCTION_INFO_V1(float4_cmp_int8);
+Datum
+float4_cmp_int8(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int64 ival = PG_GETARG_INT64(1);
+  PG_RETURN_INT32(float4_cmp_int8_internal(fval, ival));
+}
+
+PG_FUNCTION_INFO_V1(float8_cmp_int2);
+Datum
+float8_cmp_int2(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int16 ival = PG_GETARG_INT16(1);
+  PG_RETURN_INT32(float8_cmp_int2_internal(fval, ival));
+}
+
+PG_FUNCTION_INFO_V1(float8_cmp_int4);
+Datum
+float8_cmp_int4(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int32 ival = PG_GETARG_INT32(1);
+  PG_RETURN_INT32(float8_cmp_int4_internal(fval, ival));
+}
+
+PG_FUNCTION_INFO_V1(float8_cmp_int8);
+Datum
+float8_cmp_int8(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int64 ival = PG_GETARG_INT64(1);
+  PG_RETURN_INT32(float8_cmp_int8_internal(fval, ival));
+}
+
+/*
+ * Reverse comparison functions for btree operator families
+ *
+ * These functions provide int x float comparisons by calling the existing
+ * float x int comparison functions with swapped arguments and negated result.
+ */
+
+PG_FUNCTION_INFO_V1(int2_cmp_float4);
+Datum
+int2_cmp_float4(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  /* Reverse the comparison: int2_cmp_float4(i, f) = -float4_cmp_int2(f, i) */
+  PG_RETURN_INT32(-float4_cmp_int2_internal(fval, ival));
+}
+
+PG_FUNCTION_INFO_V1(int4_cmp_float4);
+Datum
+int4_cmp_float4(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  /* Reverse the comparison: int4_cmp_float4(i, f) = -float4_cmp_int4(f, i) */
+  PG_RETURN_INT32(-float4_cmp_int4_internal(fval, ival));
+}
+
+PG_FUNCTION_INFO_V1(int8_cmp_float4);
+Datum
+int8_cmp_float4(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  /* Reverse the comparison: int8_cmp_float4(i, f) = -float4_cmp_int8(f, i) */
+  PG_RETURN_INT32(-float4_cmp_int8_internal(fval, ival));
+}
+
+PG_FUNCTION_INFO_V1(int2_cmp_float8);
+Datum
+int2_cmp_float8(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  /* Reverse the comparison: int2_cmp_float8(i, f) = -float8_cmp_int2(f, i) */
+  PG_RETURN_INT32(-float8_cmp_int2_internal(fval, ival));
+}
+
+PG_FUNCTION_INFO_V1(int4_cmp_float8);
+Datum
+int4_cmp_float8(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  /* Reverse the comparison: int4_cmp_float8(i, f) = -float8_cmp_int4(f, i) */
+  PG_RETURN_INT32(-float8_cmp_int4_internal(fval, ival));
+}
+
+PG_FUNCTION_INFO_V1(int8_cmp_float8);
+Datum
+int8_cmp_float8(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  /* Reverse the comparison: int8_cmp_float8(i, f) = -float8_cmp_int8(f, i) */
+  PG_RETURN_INT32(-float8_cmp_int8_internal(fval, ival));
+}
+
+/*
+ * Btree sortsupport functions (support proc 2)
+ *
+ * A merge join looks up support proc 2 for the (lefttype, righttype) pair of
+ * each merge clause and, when one is registered, compares the two inputs
+ * through ssup->comparator instead of calling the proc 1 wrapper through
+ * fmgr. These comparators call the inline _internal kernels directly; the
+ * macros below define one <left>_cmp_<right>_sortsupport function per proc 1
+ * comparison function. Tuplesort and btree index scans only consult proc 2
+ * for same-type keys, so they keep using the built-in sortsupport routines.
+ */
+
+/**
+ * @brief Define the sortsupport function <name>_sortsupport
+ * @param name Name of the proc 1 comparison function (e.g. numeric_cmp_int4)
+ *
+ * The function installs <name>_fastcmp, defined by the macros below, as the
+ * comparator.
+ */
+#define NUM2INT_SORTSUPPORT_FUNCTION(name) \
+  PG_FUNCTION_INFO_V1(name##_sortsupport); \
+  Datum \
+  name##_sortsupport(PG_FUNCTION_ARGS) { \
+    SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0); \
+    ssup->comparator = name##_fastcmp; \
+    PG_RETURN_VOID(); \
+  }
+
+/**
+ * @brief Define the sortsupport for a numeric x integer comparison
+ * @param name Name of the proc 1 comparison function
+ * @param kernel numeric_cmp_int*_internal() kernel
+ * @param getInt DatumGetInt16/32/64 for the integer side
+ * @param numericLeft true if numeric is the left input, false for
+ *        int_cmp_numeric
+ *
+ * The numeric input is freed again if it had to be detoasted.
+ */
+#define NUM2INT_NUMERIC_SORTSUPPORT(name, kernel, getInt, numericLeft) \
+  static int \
+  name##_fastcmp(Datum x, Datum y, SortSupport ssup) { \
+    Datum numDatum = (numericLeft) ? x : y; \
+    Numeric num = DatumGetNumeric(numDatum); \
+    int result = kernel(num, getInt((numericLeft) ? y : x)); \
+    if ((Pointer) num != DatumGetPointer(numDatum)) { \
+      pfree(num); \
+    } \
+    return (numericLeft) ? result : -result; \
+  } \
+  NUM2INT_SORTSUPPORT_FUNCTION(name)
+
+/**
+ * @brief Define the sortsupport for a float x integer comparison
+ * @param name Name of the proc 1 comparison function
+ * @param kernel float4/float8_cmp_int*_internal() kernel
+ * @param getFloat DatumGetFloat4/8 for the float side
+ * @param getInt DatumGetInt16/32/64 for the integer side
+ * @param floatLeft true if the float is the left input, false for int_cmp_float
+ */
+#define NUM2INT_FLOAT_SORTSUPPORT(name, kernel, getFloat, getInt, floatLeft) \
+  static int \
+  name##_fastcmp(Datum x, Datum y, SortSupport ssup) { \
+    return (floatLeft) ? kernel(getFloat(x), getInt(y)) \
+                       : -kernel(getFloat(y), getInt(x)); \
+  } \
+  NUM2INT_SORTSUPPORT_FUNCTION(name)
+
+NUM2INT_NUMERIC_SORTSUPPORT(numeric_cmp_int2, numeric_cmp_int2_internal,
+                            DatumGetInt16, true)
+NUM2INT_NUMERIC_SORTSUPPORT(numeric_cmp_int4, numeric_cmp_int4_internal,
+                            DatumGetInt32, true)
+NUM2INT_NUMERIC_SORTSUPPORT(numeric_cmp_int8, numeric_cmp_int8_internal,
+                            DatumGetInt64, true)
+NUM2INT_NUMERIC_SORTSUPPORT(int2_cmp_numeric, numeric_cmp_int2_internal,
+                            DatumGetInt16, false)
+NUM2INT_NUMERIC_SORTSUPPORT(int4_cmp_numeric, numeric_cmp_int4_internal,
+                            DatumGetInt32, false)
+NUM2INT_NUMERIC_SORTSUPPORT(int8_cmp_numeric, numeric_cmp_int8_internal,
+                            DatumGetInt64, false)
+
+NUM2INT_FLOAT_SORTSUPPORT(float4_cmp_int2, float4_cmp_int2_internal,
+                          DatumGetFloat4, DatumGetInt16, true)
+NUM2INT_FLOAT_SORTSUPPORT(float4_cmp_int4, float4_cmp_int4_internal,
+                          DatumGetFloat4, DatumGetInt32, true)
+NUM2INT_FLOAT_SORTSUPPORT(float4_cmp_int8, float4_cmp_int8_internal,
+                          DatumGetFloat4, DatumGetInt64, true)
+NUM2INT_FLOAT_SORTSUPPORT(float8_cmp_int2, float8_cmp_int2_internal,
+                          DatumGetFloat8, DatumGetInt16, true)
+NUM2INT_FLOAT_SORTSUPPORT(float8_cmp_int4, float8_cmp_int4_internal,
+                          DatumGetFloat8, DatumGetInt32, true)
+NUM2INT_FLOAT_SORTSUPPORT(float8_cmp_int8, float8_cmp_int8_internal,
+                          DatumGetFloat8, DatumGetInt64, true)
+NUM2INT_FLOAT_SORTSUPPORT(int2_cmp_float4, float4_cmp_int2_internal,
+                          DatumGetFloat4, DatumGetInt16, false)
+NUM2INT_FLOAT_SORTSUPPORT(int4_cmp_float4, float4_cmp_int4_internal,
+                          DatumGetFloat4, DatumGetInt32, false)
+NUM2INT_FLOAT_SORTSUPPORT(int8_cmp_float4, float4_cmp_int8_internal,
+                          DatumGetFloat4, DatumGetInt64, false)
+NUM2INT_FLOAT_SORTSUPPORT(int2_cmp_float8, float8_cmp_int2_internal,
+                          DatumGetFloat8, DatumGetInt16, false)
+NUM2INT_FLOAT_SORTSUPPORT(int4_cmp_float8, float8_cmp_int4_internal,
+                          DatumGetFloat8, DatumGetInt32, false)
+NUM2INT_FLOAT_SORTSUPPORT(int8_cmp_float8, float8_cmp_int8_internal,
+                          DatumGetFloat8, DatumGetInt64, false)
+
+/*
+ * Btree in_range support functions (support proc 3)
+ *
+ * A RANGE window frame with an offset calls in_range(val, base, offset, sub,
+ * less) to test val <= base +/- offset (less) or val >= base +/- offset.
+ * For an integer sort column and a numeric or float offset the bound is
+ * moved onto the integer grid first: an integer is <= a bound exactly when
+ * it is <= the bound's floor, and >= a bound exactly when it is >= its
+ * ceiling. The offset's floor comes from convertConstToInt(), the conversion
+ * the simplifier uses for constants.
+ */
+
+/**
+ * @brief Decide in_range() for an integer sort column and an inexact offset
+ * @param val Value of the row being tested
+ * @param base Value of the current row
+ * @param offset Frame offset
+ * @param offsetType Type of offset (NUMERICOID, FLOAT4OID, FLOAT8OID)
+ * @param sub Subtract the offset from base (else add it)
+ * @param less Test val <= bound (else val >= bound)
+ * @return Whether val lies on the requested side of base +/- offset
+ *
+ * Negative and NaN offsets raise the same error as the built-in in_range
+ * functions. An infinite offset, or a bound outside the int64 range, puts
+ * every integer on one side of the bound.
+ */
+static bool
+inRangeIntInexact(int64 val, int64 base, Datum offset, Oid offsetType,
+                  bool sub, bool less) {
+  Const offsetConst;
+  ConstConversion conv;
+  bool invalid = false;
+  bool isInf = false;
+  bool overflow;
+  int64 step;
+  int64 bound = 0;
+
+  if (offsetType == NUMERICOID) {
+    Numeric num = DatumGetNumeric(offset);
+
+    if (NUM2INT_NUMERIC_IS_SPECIAL(num)) {
+      invalid = !NUM2INT_NUMERIC_IS_PINF(num);
+      isInf = !invalid;
+    }
+    offset = NumericGetDatum(num);
+  } else if (offsetType == FLOAT4OID) {
+    float4 fval = DatumGetFloat4(offset);
+
+    invalid = isnan(fval) || fval < 0;
+    isInf = isinf(fval) && fval > 0;
+  } else {
+    float8 dval = DatumGetFloat8(offset);
+
+    invalid = isnan(dval) || dval < 0;
+    isInf = isinf(dval) && dval > 0;
+  }
+
+  if (invalid) {
+    ereport(ERROR,
+            (errcode(ERRCODE_INVALID_PRECEDING_OR_FOLLOWING_SIZE),
+             errmsg("invalid preceding or following size in window function")));
+  }
+
+  /* base + offset above every integer, base - offset below every integer */
+  if (isInf) {
+    return less != sub;
+  }
+
+  memset(&offsetConst, 0, sizeof(offsetConst));
+  offsetConst.xpr.type = T_Const;
+  offsetConst.consttype = offsetType;
+  offsetConst.constvalue = offset;
+  offsetConst.constisnull = false;
+  conv = convertConstToInt(&offsetConst, INT8OID);
+
+  /* Negative numeric offsets, and floats that round down below zero */
+  if (conv.outOfRangeLow || conv.intVal < 0) {
+    ereport(ERROR,
+            (errcode(ERRCODE_INVALID_PRECEDING_OR_FOLLOWING_SIZE),
+             errmsg("invalid preceding or following size in window function")));
+  }
+
+  /*
+   * floor(base + r) = base + floor(r) and ceil(base - r) = base - floor(r);
+   * the other two bounds step by ceil(r).
+   */
+  overflow = conv.outOfRangeHigh;
+  step = conv.intVal;
+  if (!overflow && less == sub && conv.hasFraction) {
+    overflow = pg_add_s64_overflow(step, 1, &step);
+  }
+  if (!overflow) {
+    overflow = sub ? pg_sub_s64_overflow(base, step, &bound)
+                   : pg_add_s64_overflow(base, step, &bound);
+  }
+  if (overflow) {
+    return less != sub;
+  }
+
+  return less ? (val <= bound) : (val >= bound);
+}
+
+PG_FUNCTION_INFO_V1(in_range_int2_numeric);
+Datum
+in_range_int2_numeric(PG_FUNCTION_ARGS) {
+  int16 val = PG_GETARG_INT16(0);
+  int16 base = PG_GETARG_INT16(1);
+  PG_RETURN_BOOL(inRangeIntInexact(val, base, PG_GETARG_DATUM(2), NUMERICOID,
+                                   PG_GETARG_BOOL(3), PG_GETARG_BOOL(4)));
+}
+
+PG_FUNCTION_INFO_V1(in_range_int2_float4);
+Datum
+in_range_int2_float4(PG_FUNCTION_ARGS) {
+  int16 val = PG_GETARG_INT16(0);
+  int16 base = PG_GETARG_INT16(1);
+  PG_RETURN_BOOL(inRangeIntInexact(val, base, PG_GETARG_DATUM(2), FLOAT4OID,
+                                   PG_GETARG_BOOL(3), PG_GETARG_BOOL(4)));
+}
+
+PG_FUNCTION_INFO_V1(in_range_int2_float8);
+Datum
+in_range_int2_float8(PG_FUNCTION_ARGS) {
+  int16 val = PG_GETARG_INT16(0);
+  int16 base = PG_GETARG_INT16(1);
+  PG_RETURN_BOOL(inRangeIntInexact(val, base, PG_GETARG_DATUM(2), FLOAT8OID,
+                                   PG_GETARG_BOOL(3), PG_GETARG_BOOL(4)));
+}
+
+PG_FUNCTION_INFO_V1(in_range_int4_numeric);
+Datum
+in_range_int4_numeric(PG_FUNCTION_ARGS) {
+  int32 val = PG_GETARG_INT32(0);
+  int32 base = PG_GETARG_INT32(1);
+  PG_RETURN_BOOL(inRangeIntInexact(val, base, PG_GETARG_DATUM(2), NUMERICOID,
+                                   PG_GETARG_BOOL(3), PG_GETARG_BOOL(4)));
+}
+
+PG_FUNCTION_INFO_V1(in_range_int4_float4);
+Datum
+in_range_int4_float4(PG_FUNCTION_ARGS) {
+  int32 val = PG_GETARG_INT32(0);
+  int32 base = PG_GETARG_INT32(1);
+  PG_RETURN_BOOL(inRangeIntInexact(val, base, PG_GETARG_DATUM(2), FLOAT4OID,
+                                   PG_GETARG_BOOL(3), PG_GETARG_BOOL(4)));
+}
+
+PG_FUNCTION_INFO_V1(in_range_int4_float8);
+Datum
+in_range_int4_float8(PG_FUNCTION_ARGS) {
+  int32 val = PG_GETARG_INT32(0);
+  int32 base = PG_GETARG_INT32(1);
+  PG_RETURN_BOOL(inRangeIntInexact(val, base, PG_GETARG_DATUM(2), FLOAT8OID,
+                                   PG_GETARG_BOOL(3), PG_GETARG_BOOL(4)));
+}
+
+PG_FUNCTION_INFO_V1(in_range_int8_numeric);
+Datum
+in_range_int8_numeric(PG_FUNCTION_ARGS) {
+  int64 val = PG_GETARG_INT64(0);
+  int64 base = PG_GETARG_INT64(1);
+  PG_RETURN_BOOL(inRangeIntInexact(val, base, PG_GETARG_DATUM(2), NUMERICOID,
+                                   PG_GETARG_BOOL(3), PG_GETARG_BOOL(4)));
+}
+
+PG_FUNCTION_INFO_V1(in_range_int8_float4);
+Datum
+in_range_int8_float4(PG_FUNCTION_ARGS) {
+  int64 val = PG_GETARG_INT64(0);
+  int64 base = PG_GETARG_INT64(1);
+  PG_RETURN_BOOL(inRangeIntInexact(val, base, PG_GETARG_DATUM(2), FLOAT4OID,
+                                   PG_GETARG_BOOL(3), PG_GETARG_BOOL(4)));
+}
+
+PG_FUNCTION_INFO_V1(in_range_int8_float8);
+Datum
+in_range_int8_float8(PG_FUNCTION_ARGS) {
+  int64 val = PG_GETARG_INT64(0);
+  int64 base = PG_GETARG_INT64(1);
+  PG_RETURN_BOOL(inRangeIntInexact(val, base, PG_GETARG_DATUM(2), FLOAT8OID,
+                                   PG_GETARG_BOOL(3), PG_GETARG_BOOL(4)));
+}
+
+/*
+ * Equality operator wrappers (=)
+ *
+ * These wrapper functions call the corresponding _cmp_internal function
+ * and test for equality (result == 0).
+ */
+
+PG_FUNCTION_INFO_V1(numeric_eq_int2);
+Datum
+numeric_eq_int2(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int16 val = PG_GETARG_INT16(1);
+  PG_RETURN_BOOL(numericEqIntCached(fcinfo, 0, num, (int64)val));
+}
+
+PG_FUNCTION_INFO_V1(numeric_eq_int4);
+Datum
+numeric_eq_int4(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int32 val = PG_GETARG_INT32(1);
+  PG_RETURN_BOOL(numericEqIntCached(fcinfo, 0, num, (int64)val));
+}
+
+PG_FUNCTION_INFO_V1(numeric_eq_int8);
+Datum
+numeric_eq_int8(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int64 val = PG_GETARG_INT64(1);
+  PG_RETURN_BOOL(numericEqIntCached(fcinfo, 0, num, val));
+}
+
+PG_FUNCTION_INFO_V1(float4_eq_int2);
+Datum
+float4_eq_int2(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_eq_int4);
+Datum
+float4_eq_int4(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int32 ival = PG_GETARG_INT32(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_eq_int8);
+Datum
+float4_eq_int8(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int64 ival = PG_GETARG_INT64(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_eq_int2);
+Datum
+float8_eq_int2(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_eq_int4);
+Datum
+float8_eq_int4(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int32 ival = PG_GETARG_INT32(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_eq_int8);
+Datum
+float8_eq_int8(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int64 ival = PG_GETARG_INT64(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+/*
+ * Inequality operator wrappers (<>)
+ */
+
+PG_FUNCTION_INFO_V1(numeric_ne_int2);
+Datum
+numeric_ne_int2(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int16 val = PG_GETARG_INT16(1);
+  PG_RETURN_BOOL(!numericEqIntCached(fcinfo, 0, num, (int64)val));
+}
+
+PG_FUNCTION_INFO_V1(numeric_ne_int4);
+Datum
+numeric_ne_int4(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int32 val = PG_GETARG_INT32(1);
+  PG_RETURN_BOOL(!numericEqIntCached(fcinfo, 0, num, (int64)val));
+}
+
+PG_FUNCTION_INFO_V1(numeric_ne_int8);
+Datum
+numeric_ne_int8(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int64 val = PG_GETARG_INT64(1);
+  PG_RETURN_BOOL(!numericEqIntCached(fcinfo, 0, num, val));
+}
+
+PG_FUNCTION_INFO_V1(float4_ne_int2);
+Datum
+float4_ne_int2(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_ne_int4);
+Datum
+float4_ne_int4(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int32 ival = PG_GETARG_INT32(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_ne_int8);
+Datum
+float4_ne_int8(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int64 ival = PG_GETARG_INT64(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_ne_int2);
+Datum
+float8_ne_int2(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_ne_int4);
+Datum
+float8_ne_int4(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int32 ival = PG_GETARG_INT32(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_ne_int8);
+Datum
+float8_ne_int8(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int64 ival = PG_GETARG_INT64(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+/*
+ * Commutator wrappers for reverse-direction operators (int X = numeric/float)
+ * These simply swap arguments and call the main functions
+ */
+
+/* int2 = numeric/float */
+PG_FUNCTION_INFO_V1(int2_eq_numeric);
+Datum
+int2_eq_numeric(PG_FUNCTION_ARGS) {
+  int16 val = PG_GETARG_INT16(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  PG_RETURN_BOOL(numericEqIntCached(fcinfo, 1, num, (int64)val));
+}
+
+PG_FUNCTION_INFO_V1(int2_eq_float4);
+Datum
+int2_eq_float4(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+PG_FUNCTION_INFO_V1(int2_eq_float8);
+Datum
+int2_eq_float8(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+/* int4 = numeric/float */
+PG_FUNCTION_INFO_V1(int4_eq_numeric);
+Datum
+int4_eq_numeric(PG_FUNCTION_ARGS) {
+  int32 val = PG_GETARG_INT32(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  PG_RETURN_BOOL(numericEqIntCached(fcinfo, 1, num, (int64)val));
+}
+
+PG_FUNCTION_INFO_V1(int4_eq_float4);
+Datum
+int4_eq_float4(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+PG_FUNCTION_INFO_V1(int4_eq_float8);
+Datum
+int4_eq_float8(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+/* int8 = numeric/float */
+PG_FUNCTION_INFO_V1(int8_eq_numeric);
+Datum
+int8_eq_numeric(PG_FUNCTION_ARGS) {
+  int64 val = PG_GETARG_INT64(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  PG_RETURN_BOOL(numericEqIntCached(fcinfo, 1, num, val));
+}
+
+PG_FUNCTION_INFO_V1(int8_eq_float4);
+Datum
+int8_eq_float4(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+PG_FUNCTION_INFO_V1(int8_eq_float8);
+Datum
+int8_eq_float8(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp == 0);
+}
+
+/* int X <> numeric/float commutators */
+PG_FUNCTION_INFO_V1(int2_ne_numeric);
+Datum
+int2_ne_numeric(PG_FUNCTION_ARGS) {
+  int16 val = PG_GETARG_INT16(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  PG_RETURN_BOOL(!numericEqIntCached(fcinfo, 1, num, (int64)val));
+}
+
+PG_FUNCTION_INFO_V1(int2_ne_float4);
+Datum
+int2_ne_float4(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+PG_FUNCTION_INFO_V1(int2_ne_float8);
+Datum
+int2_ne_float8(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+PG_FUNCTION_INFO_V1(int4_ne_numeric);
+Datum
+int4_ne_numeric(PG_FUNCTION_ARGS) {
+  int32 val = PG_GETARG_INT32(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  PG_RETURN_BOOL(!numericEqIntCached(fcinfo, 1, num, (int64)val));
+}
+
+PG_FUNCTION_INFO_V1(int4_ne_float4);
+Datum
+int4_ne_float4(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+PG_FUNCTION_INFO_V1(int4_ne_float8);
+Datum
+int4_ne_float8(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+PG_FUNCTION_INFO_V1(int8_ne_numeric);
+Datum
+int8_ne_numeric(PG_FUNCTION_ARGS) {
+  int64 val = PG_GETARG_INT64(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  PG_RETURN_BOOL(!numericEqIntCached(fcinfo, 1, num, val));
+}
+
+PG_FUNCTION_INFO_V1(int8_ne_float4);
+Datum
+int8_ne_float4(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+PG_FUNCTION_INFO_V1(int8_ne_float8);
+Datum
+int8_ne_float8(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp != 0);
+}
+
+/*
+ * Less than operator wrappers (<)
+ */
+
+PG_FUNCTION_INFO_V1(numeric_lt_int2);
+Datum
+numeric_lt_int2(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int16 val = PG_GETARG_INT16(1);
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp < 0);
+}
+
+PG_FUNCTION_INFO_V1(numeric_lt_int4);
+Datum
+numeric_lt_int4(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int32 val = PG_GETARG_INT32(1);
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp < 0);
+}
+
+PG_FUNCTION_INFO_V1(numeric_lt_int8);
+Datum
+numeric_lt_int8(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int64 val = PG_GETARG_INT64(1);
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp < 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_lt_int2);
+Datum
+float4_lt_int2(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp < 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_lt_int4);
+Datum
+float4_lt_int4(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int32 ival = PG_GETARG_INT32(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp < 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_lt_int8);
+Datum
+float4_lt_int8(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int64 ival = PG_GETARG_INT64(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp < 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_lt_int2);
+Datum
+float8_lt_int2(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp < 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_lt_int4);
+Datum
+float8_lt_int4(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int32 ival = PG_GETARG_INT32(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp < 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_lt_int8);
+Datum
+float8_lt_int8(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int64 ival = PG_GETARG_INT64(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp < 0);
+}
+
+/*
+ * Greater than operator wrappers (>)
+ */
+
+PG_FUNCTION_INFO_V1(numeric_gt_int2);
+Datum
+numeric_gt_int2(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int16 val = PG_GETARG_INT16(1);
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(numeric_gt_int4);
+Datum
+numeric_gt_int4(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int32 val = PG_GETARG_INT32(1);
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(numeric_gt_int8);
+Datum
+numeric_gt_int8(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int64 val = PG_GETARG_INT64(1);
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_gt_int2);
+Datum
+float4_gt_int2(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_gt_int4);
+Datum
+float4_gt_int4(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int32 ival = PG_GETARG_INT32(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_gt_int8);
+Datum
+float4_gt_int8(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int64 ival = PG_GETARG_INT64(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_gt_int2);
 Datum
-float4_eq_int4(PG_FUNCTION_ARGS) {
+float8_gt_int2(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_gt_int4);
+Datum
+float8_gt_int4(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int32 ival = PG_GETARG_INT32(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_gt_int8);
+Datum
+float8_gt_int8(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int64 ival = PG_GETARG_INT64(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+/*
+ * Less than or equal operator wrappers (<=)
+ */
+
+PG_FUNCTION_INFO_V1(numeric_le_int2);
+Datum
+numeric_le_int2(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int16 val = PG_GETARG_INT16(1);
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp <= 0);
+}
+
+PG_FUNCTION_INFO_V1(numeric_le_int4);
+Datum
+numeric_le_int4(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int32 val = PG_GETARG_INT32(1);
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp <= 0);
+}
+
+PG_FUNCTION_INFO_V1(numeric_le_int8);
+Datum
+numeric_le_int8(PG_FUNCTION_ARGS) {
+  Numeric num = PG_GETARG_NUMERIC(0);
+  int64 val = PG_GETARG_INT64(1);
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp <= 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_le_int2);
+Datum
+float4_le_int2(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp <= 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_le_int4);
+Datum
+float4_le_int4(PG_FUNCTION_ARGS) {
   float4 fval = PG_GETARG_FLOAT4(0);
   int32 ival = PG_GETARG_INT32(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(float4_eq_int8);
+PG_FUNCTION_INFO_V1(float4_le_int8);
 Datum
-float4_eq_int8(PG_FUNCTION_ARGS) {
+float4_le_int8(PG_FUNCTION_ARGS) {
   float4 fval = PG_GETARG_FLOAT4(0);
   int64 ival = PG_GETARG_INT64(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(float8_eq_int2);
+PG_FUNCTION_INFO_V1(float8_le_int2);
 Datum
-float8_eq_int2(PG_FUNCTION_ARGS) {
+float8_le_int2(PG_FUNCTION_ARGS) {
   float8 fval = PG_GETARG_FLOAT8(0);
   int16 ival = PG_GETARG_INT16(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(float8_eq_int4);
+PG_FUNCTION_INFO_V1(float8_le_int4);
 Datum
-float8_eq_int4(PG_FUNCTION_ARGS) {
+float8_le_int4(PG_FUNCTION_ARGS) {
   float8 fval = PG_GETARG_FLOAT8(0);
   int32 ival = PG_GETARG_INT32(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(float8_eq_int8);
+PG_FUNCTION_INFO_V1(float8_le_int8);
 Datum
-float8_eq_int8(PG_FUNCTION_ARGS) {
+float8_le_int8(PG_FUNCTION_ARGS) {
   float8 fval = PG_GETARG_FLOAT8(0);
   int64 ival = PG_GETARG_INT64(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
 /*
- * Inequality operator wrappers (<>)
+ * Greater than or equal operator wrappers (>=)
  */
 
-PG_FUNCTION_INFO_V1(numeric_ne_int2);
+PG_FUNCTION_INFO_V1(numeric_ge_int2);
 Datum
-numeric_ne_int2(PG_FUNCTION_ARGS) {
+numeric_ge_int2(PG_FUNCTION_ARGS) {
   Numeric num = PG_GETARG_NUMERIC(0);
   int16 val = PG_GETARG_INT16(1);
-  PG_RETURN_BOOL(!numericEqInt64Direct(num, (int64)val));
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-PG_FUNCTION_INFO_V1(numeric_ne_int4);
+PG_FUNCTION_INFO_V1(numeric_ge_int4);
 Datum
-numeric_ne_int4(PG_FUNCTION_ARGS) {
+numeric_ge_int4(PG_FUNCTION_ARGS) {
   Numeric num = PG_GETARG_NUMERIC(0);
   int32 val = PG_GETARG_INT32(1);
-  PG_RETURN_BOOL(!numericEqInt64Direct(num, (int64)val));
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-PG_FUNCTION_INFO_V1(numeric_ne_int8);
+PG_FUNCTION_INFO_V1(numeric_ge_int8);
 Datum
-numeric_ne_int8(PG_FUNCTION_ARGS) {
+numeric_ge_int8(PG_FUNCTION_ARGS) {
   Numeric num = PG_GETARG_NUMERIC(0);
   int64 val = PG_GETARG_INT64(1);
-  PG_RETURN_BOOL(!numericEqInt64Direct(num, val));
+  int cmp = numericCmpIntCached(fcinfo, 0, num, val);
+  PG_RETURN_BOOL(cmp >= 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_ge_int2);
+Datum
+float4_ge_int2(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp >= 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_ge_int4);
+Datum
+float4_ge_int4(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int32 ival = PG_GETARG_INT32(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp >= 0);
+}
+
+PG_FUNCTION_INFO_V1(float4_ge_int8);
+Datum
+float4_ge_int8(PG_FUNCTION_ARGS) {
+  float4 fval = PG_GETARG_FLOAT4(0);
+  int64 ival = PG_GETARG_INT64(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp >= 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_ge_int2);
+Datum
+float8_ge_int2(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int16 ival = PG_GETARG_INT16(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp >= 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_ge_int4);
+Datum
+float8_ge_int4(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int32 ival = PG_GETARG_INT32(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp >= 0);
+}
+
+PG_FUNCTION_INFO_V1(float8_ge_int8);
+Datum
+float8_ge_int8(PG_FUNCTION_ARGS) {
+  float8 fval = PG_GETARG_FLOAT8(0);
+  int64 ival = PG_GETARG_INT64(1);
+  int cmp = floatCmpIntCached(fcinfo, 0, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp >= 0);
+}
+
+/*
+ * Commutator range operator wrappers (int X op numeric/float)
+ * These reverse the operands and flip the comparison operator.
+ * For example: int2 < numeric is implemented as numeric > int2
+ */
+
+/* int2 < numeric/float operators */
+PG_FUNCTION_INFO_V1(int2_lt_numeric);
+Datum
+int2_lt_numeric(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp > 0);  /* numeric > int2 means int2 < numeric */
+}
+
+PG_FUNCTION_INFO_V1(int2_lt_float4);
+Datum
+int2_lt_float4(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(int2_lt_float8);
+Datum
+int2_lt_float8(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(int4_lt_numeric);
+Datum
+int4_lt_numeric(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(int4_lt_float4);
+Datum
+int4_lt_float4(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(int4_lt_float8);
+Datum
+int4_lt_float8(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(int8_lt_numeric);
+Datum
+int8_lt_numeric(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(int8_lt_float4);
+Datum
+int8_lt_float4(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+PG_FUNCTION_INFO_V1(int8_lt_float8);
+Datum
+int8_lt_float8(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp > 0);
+}
+
+/* int2/4/8 > numeric/float operators */
+PG_FUNCTION_INFO_V1(int2_gt_numeric);
+Datum
+int2_gt_numeric(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp < 0);
+}
+
+PG_FUNCTION_INFO_V1(int2_gt_float4);
+Datum
+int2_gt_float4(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp < 0);
 }
 
-PG_FUNCTION_INFO_V1(float4_ne_int2);
+PG_FUNCTION_INFO_V1(int2_gt_float8);
 Datum
-float4_ne_int2(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+int2_gt_float8(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp < 0);
 }
 
-PG_FUNCTION_INFO_V1(float4_ne_int4);
+PG_FUNCTION_INFO_V1(int4_gt_numeric);
 Datum
-float4_ne_int4(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int32 ival = PG_GETARG_INT32(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+int4_gt_numeric(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp < 0);
 }
 
-PG_FUNCTION_INFO_V1(float4_ne_int8);
+PG_FUNCTION_INFO_V1(int4_gt_float4);
 Datum
-float4_ne_int8(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int64 ival = PG_GETARG_INT64(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+int4_gt_float4(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp < 0);
 }
 
-PG_FUNCTION_INFO_V1(float8_ne_int2);
+PG_FUNCTION_INFO_V1(int4_gt_float8);
 Datum
-float8_ne_int2(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+int4_gt_float8(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp < 0);
 }
 
-PG_FUNCTION_INFO_V1(float8_ne_int4);
+PG_FUNCTION_INFO_V1(int8_gt_numeric);
 Datum
-float8_ne_int4(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int32 ival = PG_GETARG_INT32(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+int8_gt_numeric(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  Numeric num = PG_GETARG_NUMERIC(1);
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp < 0);
 }
 
-PG_FUNCTION_INFO_V1(float8_ne_int8);
+PG_FUNCTION_INFO_V1(int8_gt_float4);
 Datum
-float8_ne_int8(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int64 ival = PG_GETARG_INT64(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+int8_gt_float4(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float4 fval = PG_GETARG_FLOAT4(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp < 0);
 }
 
-/*
- * Commutator wrappers for reverse-direction operators (int X = numeric/float)
- * These simply swap arguments and call the main functions
- */
+PG_FUNCTION_INFO_V1(int8_gt_float8);
+Datum
+int8_gt_float8(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float8 fval = PG_GETARG_FLOAT8(1);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp < 0);
+}
 
-/* int2 = numeric/float */
-PG_FUNCTION_INFO_V1(int2_eq_numeric);
+/* int2/4/8 <= numeric/float operators */
+PG_FUNCTION_INFO_V1(int2_le_numeric);
 Datum
-int2_eq_numeric(PG_FUNCTION_ARGS) {
-  int16 val = PG_GETARG_INT16(0);
+int2_le_numeric(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
   Numeric num = PG_GETARG_NUMERIC(1);
-  PG_RETURN_BOOL(numericEqInt64Direct(num, (int64)val));
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-PG_FUNCTION_INFO_V1(int2_eq_float4);
+PG_FUNCTION_INFO_V1(int2_le_float4);
 Datum
-int2_eq_float4(PG_FUNCTION_ARGS) {
+int2_le_float4(PG_FUNCTION_ARGS) {
   int16 ival = PG_GETARG_INT16(0);
   float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-PG_FUNCTION_INFO_V1(int2_eq_float8);
+PG_FUNCTION_INFO_V1(int2_le_float8);
 Datum
-int2_eq_float8(PG_FUNCTION_ARGS) {
+int2_le_float8(PG_FUNCTION_ARGS) {
   int16 ival = PG_GETARG_INT16(0);
   float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-/* int4 = numeric/float */
-PG_FUNCTION_INFO_V1(int4_eq_numeric);
+PG_FUNCTION_INFO_V1(int4_le_numeric);
 Datum
-int4_eq_numeric(PG_FUNCTION_ARGS) {
-  int32 val = PG_GETARG_INT32(0);
+int4_le_numeric(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
   Numeric num = PG_GETARG_NUMERIC(1);
-  PG_RETURN_BOOL(numericEqInt64Direct(num, (int64)val));
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-PG_FUNCTION_INFO_V1(int4_eq_float4);
+PG_FUNCTION_INFO_V1(int4_le_float4);
 Datum
-int4_eq_float4(PG_FUNCTION_ARGS) {
+int4_le_float4(PG_FUNCTION_ARGS) {
   int32 ival = PG_GETARG_INT32(0);
   float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-PG_FUNCTION_INFO_V1(int4_eq_float8);
+PG_FUNCTION_INFO_V1(int4_le_float8);
 Datum
-int4_eq_float8(PG_FUNCTION_ARGS) {
+int4_le_float8(PG_FUNCTION_ARGS) {
   int32 ival = PG_GETARG_INT32(0);
   float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-/* int8 = numeric/float */
-PG_FUNCTION_INFO_V1(int8_eq_numeric);
+PG_FUNCTION_INFO_V1(int8_le_numeric);
 Datum
-int8_eq_numeric(PG_FUNCTION_ARGS) {
-  int64 val = PG_GETARG_INT64(0);
+int8_le_numeric(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
   Numeric num = PG_GETARG_NUMERIC(1);
-  PG_RETURN_BOOL(numericEqInt64Direct(num, val));
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-PG_FUNCTION_INFO_V1(int8_eq_float4);
+PG_FUNCTION_INFO_V1(int8_le_float4);
 Datum
-int8_eq_float4(PG_FUNCTION_ARGS) {
+int8_le_float4(PG_FUNCTION_ARGS) {
   int64 ival = PG_GETARG_INT64(0);
   float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-PG_FUNCTION_INFO_V1(int8_eq_float8);
+PG_FUNCTION_INFO_V1(int8_le_float8);
 Datum
-int8_eq_float8(PG_FUNCTION_ARGS) {
+int8_le_float8(PG_FUNCTION_ARGS) {
   int64 ival = PG_GETARG_INT64(0);
   float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp == 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp >= 0);
 }
 
-/* int X <> numeric/float commutators */
-PG_FUNCTION_INFO_V1(int2_ne_numeric);
+/* int2/4/8 >= numeric/float operators */
+PG_FUNCTION_INFO_V1(int2_ge_numeric);
 Datum
-int2_ne_numeric(PG_FUNCTION_ARGS) {
-  int16 val = PG_GETARG_INT16(0);
+int2_ge_numeric(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
   Numeric num = PG_GETARG_NUMERIC(1);
-  PG_RETURN_BOOL(!numericEqInt64Direct(num, (int64)val));
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(int2_ne_float4);
+PG_FUNCTION_INFO_V1(int2_ge_float4);
 Datum
-int2_ne_float4(PG_FUNCTION_ARGS) {
+int2_ge_float4(PG_FUNCTION_ARGS) {
   int16 ival = PG_GETARG_INT16(0);
   float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(int2_ne_float8);
+PG_FUNCTION_INFO_V1(int2_ge_float8);
 Datum
-int2_ne_float8(PG_FUNCTION_ARGS) {
+int2_ge_float8(PG_FUNCTION_ARGS) {
   int16 ival = PG_GETARG_INT16(0);
   float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT2OID);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(int4_ne_numeric);
+PG_FUNCTION_INFO_V1(int4_ge_numeric);
 Datum
-int4_ne_numeric(PG_FUNCTION_ARGS) {
-  int32 val = PG_GETARG_INT32(0);
+int4_ge_numeric(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
   Numeric num = PG_GETARG_NUMERIC(1);
-  PG_RETURN_BOOL(!numericEqInt64Direct(num, (int64)val));
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(int4_ne_float4);
+PG_FUNCTION_INFO_V1(int4_ge_float4);
 Datum
-int4_ne_float4(PG_FUNCTION_ARGS) {
+int4_ge_float4(PG_FUNCTION_ARGS) {
   int32 ival = PG_GETARG_INT32(0);
   float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(int4_ne_float8);
+PG_FUNCTION_INFO_V1(int4_ge_float8);
 Datum
-int4_ne_float8(PG_FUNCTION_ARGS) {
+int4_ge_float8(PG_FUNCTION_ARGS) {
   int32 ival = PG_GETARG_INT32(0);
   float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT4OID);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(int8_ne_numeric);
+PG_FUNCTION_INFO_V1(int8_ge_numeric);
 Datum
-int8_ne_numeric(PG_FUNCTION_ARGS) {
-  int64 val = PG_GETARG_INT64(0);
+int8_ge_numeric(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
   Numeric num = PG_GETARG_NUMERIC(1);
-  PG_RETURN_BOOL(!numericEqInt64Direct(num, val));
+  int cmp = numericCmpIntCached(fcinfo, 1, num, ival);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(int8_ne_float4);
+PG_FUNCTION_INFO_V1(int8_ge_float4);
 Datum
-int8_ne_float4(PG_FUNCTION_ARGS) {
+int8_ge_float4(PG_FUNCTION_ARGS) {
   int64 ival = PG_GETARG_INT64(0);
   float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT4OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp <= 0);
 }
 
-PG_FUNCTION_INFO_V1(int8_ne_float8);
+PG_FUNCTION_INFO_V1(int8_ge_float8);
 Datum
-int8_ne_float8(PG_FUNCTION_ARGS) {
+int8_ge_float8(PG_FUNCTION_ARGS) {
   int64 ival = PG_GETARG_INT64(0);
   float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp != 0);
+  int cmp = floatCmpIntCached(fcinfo, 1, fval, FLOAT8OID, ival, INT8OID);
+  PG_RETURN_BOOL(cmp <= 0);
+}
+
+/* ============================================================================
+ * Hash Functions for Cross-Type Equality
+ * ============================================================================
+ * These wrapper functions ensure that equal values hash consistently across
+ * types. For example, 10::int4 and 10.0::numeric must produce the same hash.
+ *
+ * Strategy: Compute the same hash that hash_numeric would produce, but
+ * without allocating a Numeric structure. We build the base-10000 digit
+ * representation on the stack and hash it directly.
+ *
+ * hash_numeric algorithm:
+ *   1. Strip leading/trailing zero digits
+ *   2. hash_any() on the remaining digit array
+ *   3. XOR in the adjusted weight
+ *
+ * For int64, we need at most 5 base-10000 digits (10000^5 > 2^63).
+ */
+
+// Decompose |val| into the base-10000 digits hash_numeric would see
+// Fills a fixed 5-digit buffer most significant first via a 10^8 split (two
+// 64-bit divisions at most, the rest on 32-bit halves), so no reversal pass is
+// needed. Returns the number of significant digits, stores the offset of the
+// first one in *start and the numeric weight in *weight. Zero returns 0.
+static inline int
+int64ToHashDigits(int64 val, Num2IntNumericDigit digits[5], int *start,
+                  int *weight)
+{
+  uint64 uval;
+  uint32 lo;
+  uint32 mid;
+  int first;
+  int last;
+
+  // Unsigned negation is well defined for PG_INT64_MIN
+  uval = (val < 0) ? -((uint64) val) : (uint64) val;
+
+  if (uval == 0)
+    return 0;
+
+  if (uval < UINT64CONST(100000000)) {
+    lo = (uint32) uval;
+    mid = 0;
+    digits[0] = 0;
+  } else {
+    uint64 hi = uval / UINT64CONST(100000000);
+
+    lo = (uint32) (uval - hi * UINT64CONST(100000000));
+    if (hi < UINT64CONST(100000000)) {
+      mid = (uint32) hi;
+      digits[0] = 0;
+    } else {
+      // uval <= 2^63 < 10^20, so the top group is a single digit
+      uint64 top = hi / UINT64CONST(100000000);
+
+      mid = (uint32) (hi - top * UINT64CONST(100000000));
+      digits[0] = (Num2IntNumericDigit) top;
+    }
+  }
+
+  digits[1] = (Num2IntNumericDigit) (mid / NUM2INT_NBASE);
+  digits[2] = (Num2IntNumericDigit) (mid % NUM2INT_NBASE);
+  digits[3] = (Num2IntNumericDigit) (lo / NUM2INT_NBASE);
+  digits[4] = (Num2IntNumericDigit) (lo % NUM2INT_NBASE);
+
+  // Strip leading and trailing zero digits, as hash_numeric does
+  first = 0;
+  while (digits[first] == 0)
+    first++;
+  last = 4;
+  while (digits[last] == 0)
+    last--;
+
+  *start = first;
+  *weight = 4 - first;
+  return last - first + 1;
+}
+
+// Compute hash for int64 matching hash_numeric's output
+// Returns the hash value directly (no palloc)
+static Datum
+hash_int64_as_numeric_internal(int64 val)
+{
+  Num2IntNumericDigit digits[5];
+  int start;
+  int weight;
+  int ndigits;
+  Datum digit_hash;
+
+  ndigits = int64ToHashDigits(val, digits, &start, &weight);
+
+  // hash_numeric returns -1 for zero
+  if (ndigits == 0)
+    return UInt32GetDatum((uint32) -1);
+
+  digit_hash = hash_any((unsigned char *) (digits + start),
+                        ndigits * sizeof(Num2IntNumericDigit));
+  return UInt32GetDatum(DatumGetUInt32(digit_hash) ^ weight);
 }
 
-/*
- * Less than operator wrappers (<)
- */
+// Extended version with seed
+static Datum
+hash_int64_as_numeric_extended_internal(int64 val, uint64 seed)
+{
+  Num2IntNumericDigit digits[5];
+  int start;
+  int weight;
+  int ndigits;
+  Datum digit_hash;
+
+  ndigits = int64ToHashDigits(val, digits, &start, &weight);
+
+  // hash_numeric_extended returns seed - 1 for zero
+  if (ndigits == 0)
+    return UInt64GetDatum(seed - 1);
+
+  digit_hash = hash_any_extended((unsigned char *) (digits + start),
+                                 ndigits * sizeof(Num2IntNumericDigit),
+                                 seed);
+  return UInt64GetDatum(DatumGetUInt64(digit_hash) ^ weight);
+}
 
-PG_FUNCTION_INFO_V1(numeric_lt_int2);
+/* Numeric hash wrappers - compute hash matching hash_numeric without palloc */
+PG_FUNCTION_INFO_V1(hash_int2_as_numeric);
 Datum
-numeric_lt_int2(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int16 val = PG_GETARG_INT16(1);
-  int cmp = numeric_cmp_int2_internal(num, val);
-  PG_RETURN_BOOL(cmp < 0);
+hash_int2_as_numeric(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  return hash_int64_as_numeric_internal((int64) ival);
 }
 
-PG_FUNCTION_INFO_V1(numeric_lt_int4);
+PG_FUNCTION_INFO_V1(hash_int2_as_numeric_extended);
 Datum
-numeric_lt_int4(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int32 val = PG_GETARG_INT32(1);
-  int cmp = numeric_cmp_int4_internal(num, val);
-  PG_RETURN_BOOL(cmp < 0);
+hash_int2_as_numeric_extended(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  uint64 seed = PG_GETARG_INT64(1);
+  return hash_int64_as_numeric_extended_internal((int64) ival, seed);
 }
 
-PG_FUNCTION_INFO_V1(numeric_lt_int8);
+PG_FUNCTION_INFO_V1(hash_int4_as_numeric);
 Datum
-numeric_lt_int8(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int64 val = PG_GETARG_INT64(1);
-  int cmp = numeric_cmp_int8_internal(num, val);
-  PG_RETURN_BOOL(cmp < 0);
+hash_int4_as_numeric(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  return hash_int64_as_numeric_internal((int64) ival);
 }
 
-PG_FUNCTION_INFO_V1(float4_lt_int2);
+PG_FUNCTION_INFO_V1(hash_int4_as_numeric_extended);
 Datum
-float4_lt_int2(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+hash_int4_as_numeric_extended(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  uint64 seed = PG_GETARG_INT64(1);
+  return hash_int64_as_numeric_extended_internal((int64) ival, seed);
 }
 
-PG_FUNCTION_INFO_V1(float4_lt_int4);
+PG_FUNCTION_INFO_V1(hash_int8_as_numeric);
 Datum
-float4_lt_int4(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int32 ival = PG_GETARG_INT32(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+hash_int8_as_numeric(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  return hash_int64_as_numeric_internal(ival);
 }
 
-PG_FUNCTION_INFO_V1(float4_lt_int8);
+PG_FUNCTION_INFO_V1(hash_int8_as_numeric_extended);
 Datum
-float4_lt_int8(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int64 ival = PG_GETARG_INT64(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+hash_int8_as_numeric_extended(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  uint64 seed = PG_GETARG_INT64(1);
+  return hash_int64_as_numeric_extended_internal(ival, seed);
 }
 
-PG_FUNCTION_INFO_V1(float8_lt_int2);
+/* Float hash wrappers - cast int to float, then hash */
+PG_FUNCTION_INFO_V1(hash_int2_as_float4);
 Datum
-float8_lt_int2(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+hash_int2_as_float4(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float4 fval = (float4) ival;
+  return DirectFunctionCall1(hashfloat4, Float4GetDatum(fval));
 }
 
-PG_FUNCTION_INFO_V1(float8_lt_int4);
+PG_FUNCTION_INFO_V1(hash_int2_as_float4_extended);
 Datum
-float8_lt_int4(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int32 ival = PG_GETARG_INT32(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+hash_int2_as_float4_extended(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  int64 seed = PG_GETARG_INT64(1);
+  float4 fval = (float4) ival;
+  return DirectFunctionCall2(hashfloat4extended, Float4GetDatum(fval), Int64GetDatum(seed));
 }
 
-PG_FUNCTION_INFO_V1(float8_lt_int8);
+PG_FUNCTION_INFO_V1(hash_int4_as_float4);
 Datum
-float8_lt_int8(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int64 ival = PG_GETARG_INT64(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+hash_int4_as_float4(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float4 fval = (float4) ival;
+  return DirectFunctionCall1(hashfloat4, Float4GetDatum(fval));
 }
 
-/*
- * Greater than operator wrappers (>)
- */
-
-PG_FUNCTION_INFO_V1(numeric_gt_int2);
+PG_FUNCTION_INFO_V1(hash_int4_as_float4_extended);
 Datum
-numeric_gt_int2(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int16 val = PG_GETARG_INT16(1);
-  int cmp = numeric_cmp_int2_internal(num, val);
-  PG_RETURN_BOOL(cmp > 0);
+hash_int4_as_float4_extended(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  int64 seed = PG_GETARG_INT64(1);
+  float4 fval = (float4) ival;
+  return DirectFunctionCall2(hashfloat4extended, Float4GetDatum(fval), Int64GetDatum(seed));
 }
 
-PG_FUNCTION_INFO_V1(numeric_gt_int4);
+PG_FUNCTION_INFO_V1(hash_int8_as_float4);
 Datum
-numeric_gt_int4(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int32 val = PG_GETARG_INT32(1);
-  int cmp = numeric_cmp_int4_internal(num, val);
-  PG_RETURN_BOOL(cmp > 0);
+hash_int8_as_float4(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float4 fval = (float4) ival;
+  return DirectFunctionCall1(hashfloat4, Float4GetDatum(fval));
 }
 
-PG_FUNCTION_INFO_V1(numeric_gt_int8);
+PG_FUNCTION_INFO_V1(hash_int8_as_float4_extended);
 Datum
-numeric_gt_int8(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int64 val = PG_GETARG_INT64(1);
-  int cmp = numeric_cmp_int8_internal(num, val);
-  PG_RETURN_BOOL(cmp > 0);
+hash_int8_as_float4_extended(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  int64 seed = PG_GETARG_INT64(1);
+  float4 fval = (float4) ival;
+  return DirectFunctionCall2(hashfloat4extended, Float4GetDatum(fval), Int64GetDatum(seed));
 }
 
-PG_FUNCTION_INFO_V1(float4_gt_int2);
+PG_FUNCTION_INFO_V1(hash_int2_as_float8);
 Datum
-float4_gt_int2(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+hash_int2_as_float8(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  float8 fval = (float8) ival;
+  return DirectFunctionCall1(hashfloat8, Float8GetDatum(fval));
 }
 
-PG_FUNCTION_INFO_V1(float4_gt_int4);
+PG_FUNCTION_INFO_V1(hash_int2_as_float8_extended);
 Datum
-float4_gt_int4(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int32 ival = PG_GETARG_INT32(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+hash_int2_as_float8_extended(PG_FUNCTION_ARGS) {
+  int16 ival = PG_GETARG_INT16(0);
+  int64 seed = PG_GETARG_INT64(1);
+  float8 fval = (float8) ival;
+  return DirectFunctionCall2(hashfloat8extended, Float8GetDatum(fval), Int64GetDatum(seed));
 }
 
-PG_FUNCTION_INFO_V1(float4_gt_int8);
+PG_FUNCTION_INFO_V1(hash_int4_as_float8);
 Datum
-float4_gt_int8(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int64 ival = PG_GETARG_INT64(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+hash_int4_as_float8(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  float8 fval = (float8) ival;
+  return DirectFunctionCall1(hashfloat8, Float8GetDatum(fval));
 }
 
-PG_FUNCTION_INFO_V1(float8_gt_int2);
+PG_FUNCTION_INFO_V1(hash_int4_as_float8_extended);
 Datum
-float8_gt_int2(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+hash_int4_as_float8_extended(PG_FUNCTION_ARGS) {
+  int32 ival = PG_GETARG_INT32(0);
+  int64 seed = PG_GETARG_INT64(1);
+  float8 fval = (float8) ival;
+  return DirectFunctionCall2(hashfloat8extended, Float8GetDatum(fval), Int64GetDatum(seed));
 }
 
-PG_FUNCTION_INFO_V1(float8_gt_int4);
+PG_FUNCTION_INFO_V1(hash_int8_as_float8);
 Datum
-float8_gt_int4(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int32 ival = PG_GETARG_INT32(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+hash_int8_as_float8(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  float8 fval = (float8) ival;
+  return DirectFunctionCall1(hashfloat8, Float8GetDatum(fval));
 }
 
-PG_FUNCTION_INFO_V1(float8_gt_int8);
+PG_FUNCTION_INFO_V1(hash_int8_as_float8_extended);
 Datum
-float8_gt_int8(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int64 ival = PG_GETARG_INT64(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+hash_int8_as_float8_extended(PG_FUNCTION_ARGS) {
+  int64 ival = PG_GETARG_INT64(0);
+  int64 seed = PG_GETARG_INT64(1);
+  float8 fval = (float8) ival;
+  return DirectFunctionCall2(hashfloat8extended, Float8GetDatum(fval), Int64GetDatum(seed));
 }
 
 /*
- * Less than or equal operator wrappers (<=)
+ * Runtime index key functions
+ *
+ * Map an inexact value onto the integer key of an equivalent native integer
+ * comparison (see computeIntKey()). Return NULL when no integer can match.
  */
 
-PG_FUNCTION_INFO_V1(numeric_le_int2);
+PG_FUNCTION_INFO_V1(numeric_eq_key_int2);
 Datum
-numeric_le_int2(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int16 val = PG_GETARG_INT16(1);
-  int cmp = numeric_cmp_int2_internal(num, val);
-  PG_RETURN_BOOL(cmp <= 0);
-}
+numeric_eq_key_int2(PG_FUNCTION_ARGS) {
+  int64 key;
 
-PG_FUNCTION_INFO_V1(numeric_le_int4);
-Datum
-numeric_le_int4(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int32 val = PG_GETARG_INT32(1);
-  int cmp = numeric_cmp_int4_internal(num, val);
-  PG_RETURN_BOOL(cmp <= 0);
+  if (!computeIntKey(NUM2INT_KEY_EQ, true, PG_GETARG_DATUM(0),
+                     NUMERICOID, INT2OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) key);
 }
 
-PG_FUNCTION_INFO_V1(numeric_le_int8);
+PG_FUNCTION_INFO_V1(numeric_eq_key_int4);
 Datum
-numeric_le_int8(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int64 val = PG_GETARG_INT64(1);
-  int cmp = numeric_cmp_int8_internal(num, val);
-  PG_RETURN_BOOL(cmp <= 0);
+numeric_eq_key_int4(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_EQ, true, PG_GETARG_DATUM(0),
+                     NUMERICOID, INT4OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) key);
 }
 
-PG_FUNCTION_INFO_V1(float4_le_int2);
+PG_FUNCTION_INFO_V1(numeric_eq_key_int8);
 Datum
-float4_le_int2(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+numeric_eq_key_int8(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_EQ, true, PG_GETARG_DATUM(0),
+                     NUMERICOID, INT8OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(key);
 }
 
-PG_FUNCTION_INFO_V1(float4_le_int4);
+PG_FUNCTION_INFO_V1(numeric_lower_key_int2);
 Datum
-float4_le_int4(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int32 ival = PG_GETARG_INT32(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+numeric_lower_key_int2(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_LOWER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     NUMERICOID, INT2OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) key);
 }
 
-PG_FUNCTION_INFO_V1(float4_le_int8);
+PG_FUNCTION_INFO_V1(numeric_lower_key_int4);
 Datum
-float4_le_int8(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int64 ival = PG_GETARG_INT64(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+numeric_lower_key_int4(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_LOWER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     NUMERICOID, INT4OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) key);
 }
 
-PG_FUNCTION_INFO_V1(float8_le_int2);
+PG_FUNCTION_INFO_V1(numeric_lower_key_int8);
 Datum
-float8_le_int2(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+numeric_lower_key_int8(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_LOWER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     NUMERICOID, INT8OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(key);
 }
 
-PG_FUNCTION_INFO_V1(float8_le_int4);
+PG_FUNCTION_INFO_V1(numeric_upper_key_int2);
 Datum
-float8_le_int4(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int32 ival = PG_GETARG_INT32(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+numeric_upper_key_int2(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_UPPER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     NUMERICOID, INT2OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) key);
 }
 
-PG_FUNCTION_INFO_V1(float8_le_int8);
+PG_FUNCTION_INFO_V1(numeric_upper_key_int4);
 Datum
-float8_le_int8(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int64 ival = PG_GETARG_INT64(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+numeric_upper_key_int4(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_UPPER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     NUMERICOID, INT4OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) key);
 }
 
-/*
- * Greater than or equal operator wrappers (>=)
- */
+PG_FUNCTION_INFO_V1(numeric_upper_key_int8);
+Datum
+numeric_upper_key_int8(PG_FUNCTION_ARGS) {
+  int64 key;
 
-PG_FUNCTION_INFO_V1(numeric_ge_int2);
+  if (!computeIntKey(NUM2INT_KEY_UPPER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     NUMERICOID, INT8OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(key);
+}
+
+PG_FUNCTION_INFO_V1(float4_eq_key_int2);
 Datum
-numeric_ge_int2(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int16 val = PG_GETARG_INT16(1);
-  int cmp = numeric_cmp_int2_internal(num, val);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_eq_key_int2(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_EQ, true, PG_GETARG_DATUM(0),
+                     FLOAT4OID, INT2OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) key);
 }
 
-PG_FUNCTION_INFO_V1(numeric_ge_int4);
+PG_FUNCTION_INFO_V1(float4_eq_key_int4);
 Datum
-numeric_ge_int4(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int32 val = PG_GETARG_INT32(1);
-  int cmp = numeric_cmp_int4_internal(num, val);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_eq_key_int4(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_EQ, true, PG_GETARG_DATUM(0),
+                     FLOAT4OID, INT4OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) key);
 }
 
-PG_FUNCTION_INFO_V1(numeric_ge_int8);
+PG_FUNCTION_INFO_V1(float4_eq_key_int8);
 Datum
-numeric_ge_int8(PG_FUNCTION_ARGS) {
-  Numeric num = PG_GETARG_NUMERIC(0);
-  int64 val = PG_GETARG_INT64(1);
-  int cmp = numeric_cmp_int8_internal(num, val);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_eq_key_int8(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_EQ, true, PG_GETARG_DATUM(0),
+                     FLOAT4OID, INT8OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(key);
 }
 
-PG_FUNCTION_INFO_V1(float4_ge_int2);
+PG_FUNCTION_INFO_V1(float4_lower_key_int2);
 Datum
-float4_ge_int2(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_lower_key_int2(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_LOWER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT4OID, INT2OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) key);
 }
 
-PG_FUNCTION_INFO_V1(float4_ge_int4);
+PG_FUNCTION_INFO_V1(float4_lower_key_int4);
 Datum
-float4_ge_int4(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int32 ival = PG_GETARG_INT32(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_lower_key_int4(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_LOWER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT4OID, INT4OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) key);
 }
 
-PG_FUNCTION_INFO_V1(float4_ge_int8);
+PG_FUNCTION_INFO_V1(float4_lower_key_int8);
 Datum
-float4_ge_int8(PG_FUNCTION_ARGS) {
-  float4 fval = PG_GETARG_FLOAT4(0);
-  int64 ival = PG_GETARG_INT64(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_lower_key_int8(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_LOWER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT4OID, INT8OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(key);
 }
 
-PG_FUNCTION_INFO_V1(float8_ge_int2);
+PG_FUNCTION_INFO_V1(float4_upper_key_int2);
 Datum
-float8_ge_int2(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int16 ival = PG_GETARG_INT16(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_upper_key_int2(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_UPPER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT4OID, INT2OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) key);
 }
 
-PG_FUNCTION_INFO_V1(float8_ge_int4);
+PG_FUNCTION_INFO_V1(float4_upper_key_int4);
 Datum
-float8_ge_int4(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int32 ival = PG_GETARG_INT32(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_upper_key_int4(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_UPPER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT4OID, INT4OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) key);
 }
 
-PG_FUNCTION_INFO_V1(float8_ge_int8);
+PG_FUNCTION_INFO_V1(float4_upper_key_int8);
 Datum
-float8_ge_int8(PG_FUNCTION_ARGS) {
-  float8 fval = PG_GETARG_FLOAT8(0);
-  int64 ival = PG_GETARG_INT64(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_upper_key_int8(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_UPPER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT4OID, INT8OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(key);
 }
 
-/*
- * Commutator range operator wrappers (int X op numeric/float)
- * These reverse the operands and flip the comparison operator.
- * For example: int2 < numeric is implemented as numeric > int2
- */
+PG_FUNCTION_INFO_V1(float8_eq_key_int2);
+Datum
+float8_eq_key_int2(PG_FUNCTION_ARGS) {
+  int64 key;
 
-/* int2 < numeric/float operators */
-PG_FUNCTION_INFO_V1(int2_lt_numeric);
+  if (!computeIntKey(NUM2INT_KEY_EQ, true, PG_GETARG_DATUM(0),
+                     FLOAT8OID, INT2OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) key);
+}
+
+PG_FUNCTION_INFO_V1(float8_eq_key_int4);
 Datum
-int2_lt_numeric(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int2_internal(num, ival);
-  PG_RETURN_BOOL(cmp > 0);  /* numeric > int2 means int2 < numeric */
+float8_eq_key_int4(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_EQ, true, PG_GETARG_DATUM(0),
+                     FLOAT8OID, INT4OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) key);
 }
 
-PG_FUNCTION_INFO_V1(int2_lt_float4);
+PG_FUNCTION_INFO_V1(float8_eq_key_int8);
 Datum
-int2_lt_float4(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+float8_eq_key_int8(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_EQ, true, PG_GETARG_DATUM(0),
+                     FLOAT8OID, INT8OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(key);
 }
 
-PG_FUNCTION_INFO_V1(int2_lt_float8);
+PG_FUNCTION_INFO_V1(float8_lower_key_int2);
 Datum
-int2_lt_float8(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+float8_lower_key_int2(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_LOWER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT8OID, INT2OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) key);
 }
 
-PG_FUNCTION_INFO_V1(int4_lt_numeric);
+PG_FUNCTION_INFO_V1(float8_lower_key_int4);
 Datum
-int4_lt_numeric(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int4_internal(num, ival);
-  PG_RETURN_BOOL(cmp > 0);
+float8_lower_key_int4(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_LOWER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT8OID, INT4OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) key);
 }
 
-PG_FUNCTION_INFO_V1(int4_lt_float4);
+PG_FUNCTION_INFO_V1(float8_lower_key_int8);
 Datum
-int4_lt_float4(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+float8_lower_key_int8(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_LOWER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT8OID, INT8OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(key);
 }
 
-PG_FUNCTION_INFO_V1(int4_lt_float8);
+PG_FUNCTION_INFO_V1(float8_upper_key_int2);
 Datum
-int4_lt_float8(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+float8_upper_key_int2(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_UPPER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT8OID, INT2OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) key);
 }
 
-PG_FUNCTION_INFO_V1(int8_lt_numeric);
+PG_FUNCTION_INFO_V1(float8_upper_key_int4);
 Datum
-int8_lt_numeric(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int8_internal(num, ival);
-  PG_RETURN_BOOL(cmp > 0);
+float8_upper_key_int4(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_UPPER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT8OID, INT4OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) key);
 }
 
-PG_FUNCTION_INFO_V1(int8_lt_float4);
+PG_FUNCTION_INFO_V1(float8_upper_key_int8);
 Datum
-int8_lt_float4(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+float8_upper_key_int8(PG_FUNCTION_ARGS) {
+  int64 key;
+
+  if (!computeIntKey(NUM2INT_KEY_UPPER, PG_GETARG_BOOL(1), PG_GETARG_DATUM(0),
+                     FLOAT8OID, INT8OID, &key))
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(key);
 }
 
-PG_FUNCTION_INFO_V1(int8_lt_float8);
+/* ============================================================================
+ * Exact Conversion Functions
+ * ============================================================================
+ * num2int_exact_<int>(numeric|float4|float8) converts a value that is exactly
+ * an integer of the target type and raises an error otherwise, where a cast
+ * would round silently. num2int_exact_<int>_or_null() returns NULL instead of
+ * raising. Both classify the value with the same header decode and float
+ * range checks as the comparison kernels, and read packed numerics in place,
+ * so converting a staged column allocates nothing per row.
+ */
+
+/**
+ * @brief Outcome of an exact conversion
+ */
+typedef enum {
+  NUM2INT_EXACT_OK = 0,
+  NUM2INT_EXACT_FRACTION,       /**< In range but has a fractional part */
+  NUM2INT_EXACT_OUT_OF_RANGE,   /**< Outside the integer type's range */
+  NUM2INT_EXACT_NAN,            /**< NaN */
+  NUM2INT_EXACT_INFINITY        /**< +Infinity or -Infinity */
+} Num2IntExactStatus;
+
+/**
+ * @brief Aligned copy of a packed (1-byte header) numeric
+ */
+typedef union {
+  int32 align;
+  char bytes[VARHDRSZ + VARATT_SHORT_MAX];
+} Num2IntNumericBuf;
+
+/**
+ * @brief Get a numeric argument without allocating for packed values
+ * @param value Numeric datum, possibly with a 1-byte header
+ * @param buf Stack buffer the packed value is copied into
+ * @return Numeric with a 4-byte header
+ *
+ * Numerics read from a table are usually packed, and DatumGetNumeric()
+ * would palloc an unpacked copy of each. A packed value is at most
+ * VARATT_SHORT_MAX bytes, so it is unpacked into buf instead. Compressed
+ * and out-of-line values are still detoasted.
+ */
+static Numeric
+getNumericNoCopy(Datum value, Num2IntNumericBuf *buf) {
+  struct varlena *ptr = (struct varlena *) DatumGetPointer(value);
+
+  if (VARATT_IS_SHORT(ptr) && !VARATT_IS_EXTERNAL(ptr)) {
+    Size len = VARSIZE_SHORT(ptr) - VARHDRSZ_SHORT;
+
+    memcpy(buf->bytes + VARHDRSZ, VARDATA_SHORT(ptr), len);
+    SET_VARSIZE(buf->bytes, len + VARHDRSZ);
+    return (Numeric) buf->bytes;
+  }
+  return DatumGetNumeric(value);
+}
+
+/**
+ * @brief Test whether a negative fraction truncates to PG_INT64_MIN
+ * @param info Numeric decoded by decodeNumericHeader()
+ *
+ * decodeNumericValue() reports such a value as not fitting in int64, because
+ * its floor is one below PG_INT64_MIN, although its integral part is exactly
+ * 2^63.
+ */
+static bool
+truncatesToInt64Min(const Num2IntNumericInfo *info) {
+  uint64 mag = 0;
+  int intDigits;
+  int i;
+
+  if (info->sign >= 0 || info->isIntegral || info->weight != 4 ||
+      info->digits[0] > 922) {
+    return false;
+  }
+
+  intDigits = Min(info->ndigits, info->weight + 1);
+  for (i = 0; i < intDigits; i++) {
+    mag = mag * NUM2INT_NBASE + (uint64) info->digits[i];
+  }
+  for (; i <= info->weight; i++) {
+    mag *= NUM2INT_NBASE;
+  }
+  return mag == (uint64) PG_INT64_MAX + 1;
+}
+
+/**
+ * @brief Convert an inexact value to an integer if it is exactly one
+ * @param value Value to convert
+ * @param valueType Type of value (NUMERICOID, FLOAT4OID, FLOAT8OID)
+ * @param intType Target integer type (INT2OID, INT4OID, INT8OID)
+ * @param result Output: the integer, set only for NUM2INT_EXACT_OK
+ * @return Conversion outcome
+ *
+ * Out of range is reported before a fractional part. The range is checked on
+ * the value truncated toward zero, so -32768.4 has a fractional part for int2
+ * while -32769.5 is out of range.
+ */
+static Num2IntExactStatus
+exactConvertToInt(Datum value, Oid valueType, Oid intType, int64 *result) {
+  int64 typeMin, typeMax;
+  float8 dval;
+  float8 truncVal;
+
+  if (intType == INT2OID) {
+    typeMin = PG_INT16_MIN;
+    typeMax = PG_INT16_MAX;
+  } else if (intType == INT4OID) {
+    typeMin = PG_INT32_MIN;
+    typeMax = PG_INT32_MAX;
+  } else {
+    typeMin = PG_INT64_MIN;
+    typeMax = PG_INT64_MAX;
+  }
+
+  if (valueType == NUMERICOID) {
+    Num2IntNumericBuf buf;
+    Num2IntNumericInfo info;
+
+    decodeNumericHeader(getNumericNoCopy(value, &buf), &info);
+    if (info.special != 0) {
+      return info.isNaN ? NUM2INT_EXACT_NAN : NUM2INT_EXACT_INFINITY;
+    }
+
+    decodeNumericValue(&info);
+    if (!info.fitsInt64) {
+      /* -9223372036854775808.5 truncates to PG_INT64_MIN */
+      return (truncatesToInt64Min(&info) && typeMin == PG_INT64_MIN)
+               ? NUM2INT_EXACT_FRACTION
+               : NUM2INT_EXACT_OUT_OF_RANGE;
+    }
+    if (info.isIntegral) {
+      if (info.floorVal < typeMin || info.floorVal > typeMax) {
+        return NUM2INT_EXACT_OUT_OF_RANGE;
+      }
+      *result = info.floorVal;
+      return NUM2INT_EXACT_OK;
+    }
+    /* Truncated toward zero: floor(-100.5) + 1 = -100 */
+    if ((info.sign < 0 ? info.floorVal + 1 : info.floorVal) < typeMin ||
+        info.floorVal > typeMax) {
+      return NUM2INT_EXACT_OUT_OF_RANGE;
+    }
+    return NUM2INT_EXACT_FRACTION;
+  }
+
+  /* Every float4 is exactly a float8 */
+  dval = (valueType == FLOAT4OID) ? (float8) DatumGetFloat4(value)
+                                  : DatumGetFloat8(value);
+  if (isnan(dval)) {
+    return NUM2INT_EXACT_NAN;
+  }
+  if (isinf(dval)) {
+    return NUM2INT_EXACT_INFINITY;
+  }
+
+  /*
+   * -typeMin (2^15, 2^31, 2^63) is exact as a float8, unlike FLOAT8_INT64_MAX
+   * which rounds up to it, so the upper check is exclusive.
+   */
+  truncVal = trunc(dval);
+  if (truncVal < (float8) typeMin || truncVal >= -(float8) typeMin) {
+    return NUM2INT_EXACT_OUT_OF_RANGE;
+  }
+  if (dval != truncVal) {
+    return NUM2INT_EXACT_FRACTION;
+  }
+  *result = (int64) dval;
+  return NUM2INT_EXACT_OK;
+}
+
+/**
+ * @brief Raise the error for a failed exact conversion
+ * @param status Outcome other than NUM2INT_EXACT_OK
+ * @param intType Target integer type
+ *
+ * Range, NaN and infinity errors use the wording of the built-in casts.
+ */
+static void
+reportInexactConversion(Num2IntExactStatus status, Oid intType) {
+  const char *typeName = (intType == INT2OID) ? "smallint" :
+                         (intType == INT4OID) ? "integer" : "bigint";
+
+  switch (status) {
+    case NUM2INT_EXACT_FRACTION:
+      ereport(ERROR,
+              (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+               errmsg("cannot convert a value with a fractional part to %s exactly",
+                      typeName)));
+      break;
+    case NUM2INT_EXACT_OUT_OF_RANGE:
+      ereport(ERROR,
+              (errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+               errmsg("%s out of range", typeName)));
+      break;
+    case NUM2INT_EXACT_NAN:
+      ereport(ERROR,
+              (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+               errmsg("cannot convert NaN to %s", typeName)));
+      break;
+    case NUM2INT_EXACT_INFINITY:
+      ereport(ERROR,
+              (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+               errmsg("cannot convert infinity to %s", typeName)));
+      break;
+    case NUM2INT_EXACT_OK:
+      break;
+  }
+}
+
+/**
+ * @brief Integer expression behind an exact cast to numeric or float
+ * @param arg Argument of a num2int_exact_*() call
+ * @return The integer expression, or NULL if arg is not such a cast
+ *
+ * Every integer converts to numeric exactly, int2 and int4 to float8, and
+ * int2 to float4; converting those back is the identity.
+ */
+static Node *
+exactIntCastSource(Node *arg) {
+  FuncExpr *cast;
+  Node *source;
+  Oid sourceType;
+
+  if (!IsA(arg, FuncExpr)) {
+    return NULL;
+  }
+  cast = (FuncExpr *) arg;
+  if ((cast->funcformat != COERCE_IMPLICIT_CAST &&
+       cast->funcformat != COERCE_EXPLICIT_CAST) ||
+      list_length(cast->args) != 1) {
+    return NULL;
+  }
+
+  source = (Node *) linitial(cast->args);
+  sourceType = exprType(source);
+  if (sourceType != INT2OID && sourceType != INT4OID && sourceType != INT8OID) {
+    return NULL;
+  }
+
+  switch (cast->funcresulttype) {
+    case NUMERICOID:
+      return source;
+    case FLOAT8OID:
+      return (sourceType != INT8OID) ? source : NULL;
+    case FLOAT4OID:
+      return (sourceType == INT2OID) ? source : NULL;
+    default:
+      return NULL;
+  }
+}
+
+/**
+ * @brief SupportRequestSimplify for the exact conversion functions
+ * @param req Simplify request for a num2int_exact_*() call
+ * @param orNull The call is an _or_null variant
+ * @return Replacement expression, or NULL to keep the call
+ *
+ * Constant arguments never get here: the planner evaluates an immutable
+ * function of constants before asking its support function. What is left
+ * is an exact cast of an integer expression, which becomes that expression
+ * coerced to the result type. The _or_null variants only take widening
+ * coercions, since a narrowing cast raises where they return NULL.
+ */
+static Node *
+simplifyExactConversion(SupportRequestSimplify *req, bool orNull) {
+  FuncExpr *func = req->fcall;
+  Oid intType = func->funcresulttype;
+  Node *source;
+  Oid sourceType;
+
+  if (!enableSupportFunctions || list_length(func->args) != 1) {
+    return NULL;
+  }
+
+  source = exactIntCastSource((Node *) linitial(func->args));
+  if (source == NULL) {
+    return NULL;
+  }
+  sourceType = exprType(source);
+  if (sourceType == intType) {
+    return source;
+  }
+  if (orNull && (sourceType == INT8OID ||
+                 (sourceType == INT4OID && intType == INT2OID))) {
+    return NULL;
+  }
+  return coerce_to_target_type(NULL, source, sourceType, intType, -1,
+                               COERCION_EXPLICIT, COERCE_EXPLICIT_CAST, -1);
+}
+
+PG_FUNCTION_INFO_V1(num2int_exact_support);
 Datum
-int8_lt_float8(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp > 0);
+num2int_exact_support(PG_FUNCTION_ARGS) {
+  Node *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+  if (IsA(rawreq, SupportRequestSimplify)) {
+    PG_RETURN_POINTER(simplifyExactConversion(
+        (SupportRequestSimplify *) rawreq, false));
+  }
+  PG_RETURN_POINTER(NULL);
 }
 
-/* int2/4/8 > numeric/float operators */
-PG_FUNCTION_INFO_V1(int2_gt_numeric);
+PG_FUNCTION_INFO_V1(num2int_exact_or_null_support);
 Datum
-int2_gt_numeric(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int2_internal(num, ival);
-  PG_RETURN_BOOL(cmp < 0);
+num2int_exact_or_null_support(PG_FUNCTION_ARGS) {
+  Node *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+  if (IsA(rawreq, SupportRequestSimplify)) {
+    PG_RETURN_POINTER(simplifyExactConversion(
+        (SupportRequestSimplify *) rawreq, true));
+  }
+  PG_RETURN_POINTER(NULL);
 }
 
-PG_FUNCTION_INFO_V1(int2_gt_float4);
+PG_FUNCTION_INFO_V1(numeric_exact_int2);
 Datum
-int2_gt_float4(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+numeric_exact_int2(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+  Num2IntExactStatus status = exactConvertToInt(PG_GETARG_DATUM(0), NUMERICOID,
+                                                INT2OID, &result);
+
+  if (status != NUM2INT_EXACT_OK)
+    reportInexactConversion(status, INT2OID);
+  PG_RETURN_INT16((int16) result);
 }
 
-PG_FUNCTION_INFO_V1(int2_gt_float8);
+PG_FUNCTION_INFO_V1(numeric_exact_int2_or_null);
 Datum
-int2_gt_float8(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+numeric_exact_int2_or_null(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+
+  if (exactConvertToInt(PG_GETARG_DATUM(0), NUMERICOID, INT2OID,
+                        &result) != NUM2INT_EXACT_OK)
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) result);
 }
 
-PG_FUNCTION_INFO_V1(int4_gt_numeric);
+PG_FUNCTION_INFO_V1(numeric_exact_int4);
 Datum
-int4_gt_numeric(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int4_internal(num, ival);
-  PG_RETURN_BOOL(cmp < 0);
+numeric_exact_int4(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+  Num2IntExactStatus status = exactConvertToInt(PG_GETARG_DATUM(0), NUMERICOID,
+                                                INT4OID, &result);
+
+  if (status != NUM2INT_EXACT_OK)
+    reportInexactConversion(status, INT4OID);
+  PG_RETURN_INT32((int32) result);
 }
 
-PG_FUNCTION_INFO_V1(int4_gt_float4);
+PG_FUNCTION_INFO_V1(numeric_exact_int4_or_null);
 Datum
-int4_gt_float4(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+numeric_exact_int4_or_null(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+
+  if (exactConvertToInt(PG_GETARG_DATUM(0), NUMERICOID, INT4OID,
+                        &result) != NUM2INT_EXACT_OK)
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) result);
 }
 
-PG_FUNCTION_INFO_V1(int4_gt_float8);
+PG_FUNCTION_INFO_V1(numeric_exact_int8);
 Datum
-int4_gt_float8(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+numeric_exact_int8(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+  Num2IntExactStatus status = exactConvertToInt(PG_GETARG_DATUM(0), NUMERICOID,
+                                                INT8OID, &result);
+
+  if (status != NUM2INT_EXACT_OK)
+    reportInexactConversion(status, INT8OID);
+  PG_RETURN_INT64(result);
 }
 
-PG_FUNCTION_INFO_V1(int8_gt_numeric);
+PG_FUNCTION_INFO_V1(numeric_exact_int8_or_null);
 Datum
-int8_gt_numeric(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int8_internal(num, ival);
-  PG_RETURN_BOOL(cmp < 0);
+numeric_exact_int8_or_null(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+
+  if (exactConvertToInt(PG_GETARG_DATUM(0), NUMERICOID, INT8OID,
+                        &result) != NUM2INT_EXACT_OK)
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(result);
 }
 
-PG_FUNCTION_INFO_V1(int8_gt_float4);
+PG_FUNCTION_INFO_V1(float4_exact_int2);
 Datum
-int8_gt_float4(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+float4_exact_int2(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+  Num2IntExactStatus status = exactConvertToInt(PG_GETARG_DATUM(0), FLOAT4OID,
+                                                INT2OID, &result);
+
+  if (status != NUM2INT_EXACT_OK)
+    reportInexactConversion(status, INT2OID);
+  PG_RETURN_INT16((int16) result);
 }
 
-PG_FUNCTION_INFO_V1(int8_gt_float8);
+PG_FUNCTION_INFO_V1(float4_exact_int2_or_null);
 Datum
-int8_gt_float8(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp < 0);
+float4_exact_int2_or_null(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+
+  if (exactConvertToInt(PG_GETARG_DATUM(0), FLOAT4OID, INT2OID,
+                        &result) != NUM2INT_EXACT_OK)
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) result);
 }
 
-/* int2/4/8 <= numeric/float operators */
-PG_FUNCTION_INFO_V1(int2_le_numeric);
+PG_FUNCTION_INFO_V1(float4_exact_int4);
 Datum
-int2_le_numeric(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int2_internal(num, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_exact_int4(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+  Num2IntExactStatus status = exactConvertToInt(PG_GETARG_DATUM(0), FLOAT4OID,
+                                                INT4OID, &result);
+
+  if (status != NUM2INT_EXACT_OK)
+    reportInexactConversion(status, INT4OID);
+  PG_RETURN_INT32((int32) result);
 }
 
-PG_FUNCTION_INFO_V1(int2_le_float4);
+PG_FUNCTION_INFO_V1(float4_exact_int4_or_null);
 Datum
-int2_le_float4(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_exact_int4_or_null(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+
+  if (exactConvertToInt(PG_GETARG_DATUM(0), FLOAT4OID, INT4OID,
+                        &result) != NUM2INT_EXACT_OK)
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) result);
 }
 
-PG_FUNCTION_INFO_V1(int2_le_float8);
+PG_FUNCTION_INFO_V1(float4_exact_int8);
 Datum
-int2_le_float8(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_exact_int8(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+  Num2IntExactStatus status = exactConvertToInt(PG_GETARG_DATUM(0), FLOAT4OID,
+                                                INT8OID, &result);
+
+  if (status != NUM2INT_EXACT_OK)
+    reportInexactConversion(status, INT8OID);
+  PG_RETURN_INT64(result);
 }
 
-PG_FUNCTION_INFO_V1(int4_le_numeric);
+PG_FUNCTION_INFO_V1(float4_exact_int8_or_null);
 Datum
-int4_le_numeric(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int4_internal(num, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float4_exact_int8_or_null(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+
+  if (exactConvertToInt(PG_GETARG_DATUM(0), FLOAT4OID, INT8OID,
+                        &result) != NUM2INT_EXACT_OK)
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(result);
 }
 
-PG_FUNCTION_INFO_V1(int4_le_float4);
+PG_FUNCTION_INFO_V1(float8_exact_int2);
 Datum
-int4_le_float4(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float8_exact_int2(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+  Num2IntExactStatus status = exactConvertToInt(PG_GETARG_DATUM(0), FLOAT8OID,
+                                                INT2OID, &result);
+
+  if (status != NUM2INT_EXACT_OK)
+    reportInexactConversion(status, INT2OID);
+  PG_RETURN_INT16((int16) result);
 }
 
-PG_FUNCTION_INFO_V1(int4_le_float8);
+PG_FUNCTION_INFO_V1(float8_exact_int2_or_null);
 Datum
-int4_le_float8(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float8_exact_int2_or_null(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+
+  if (exactConvertToInt(PG_GETARG_DATUM(0), FLOAT8OID, INT2OID,
+                        &result) != NUM2INT_EXACT_OK)
+    PG_RETURN_NULL();
+  PG_RETURN_INT16((int16) result);
 }
 
-PG_FUNCTION_INFO_V1(int8_le_numeric);
+PG_FUNCTION_INFO_V1(float8_exact_int4);
 Datum
-int8_le_numeric(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int8_internal(num, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float8_exact_int4(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+  Num2IntExactStatus status = exactConvertToInt(PG_GETARG_DATUM(0), FLOAT8OID,
+                                                INT4OID, &result);
+
+  if (status != NUM2INT_EXACT_OK)
+    reportInexactConversion(status, INT4OID);
+  PG_RETURN_INT32((int32) result);
 }
 
-PG_FUNCTION_INFO_V1(int8_le_float4);
+PG_FUNCTION_INFO_V1(float8_exact_int4_or_null);
 Datum
-int8_le_float4(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float8_exact_int4_or_null(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+
+  if (exactConvertToInt(PG_GETARG_DATUM(0), FLOAT8OID, INT4OID,
+                        &result) != NUM2INT_EXACT_OK)
+    PG_RETURN_NULL();
+  PG_RETURN_INT32((int32) result);
 }
 
-PG_FUNCTION_INFO_V1(int8_le_float8);
+PG_FUNCTION_INFO_V1(float8_exact_int8);
 Datum
-int8_le_float8(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp >= 0);
+float8_exact_int8(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+  Num2IntExactStatus status = exactConvertToInt(PG_GETARG_DATUM(0), FLOAT8OID,
+                                                INT8OID, &result);
+
+  if (status != NUM2INT_EXACT_OK)
+    reportInexactConversion(status, INT8OID);
+  PG_RETURN_INT64(result);
 }
 
-/* int2/4/8 >= numeric/float operators */
-PG_FUNCTION_INFO_V1(int2_ge_numeric);
+PG_FUNCTION_INFO_V1(float8_exact_int8_or_null);
 Datum
-int2_ge_numeric(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int2_internal(num, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+float8_exact_int8_or_null(PG_FUNCTION_ARGS) {
+  int64 result = 0;
+
+  if (exactConvertToInt(PG_GETARG_DATUM(0), FLOAT8OID, INT8OID,
+                        &result) != NUM2INT_EXACT_OK)
+    PG_RETURN_NULL();
+  PG_RETURN_INT64(result);
 }
 
-PG_FUNCTION_INFO_V1(int2_ge_float4);
-Datum
-int2_ge_float4(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+/* ============================================================================
+ * Array Overlap and Containment Functions
+ * ============================================================================
+ * num2int_array_overlap/contains/contained(a, b) are a && b, a @> b and
+ * a <@ b between an integer array and a numeric/float array, in either
+ * order. Both operands become sorted, deduplicated sets of int64 values: an
+ * inexact element that no integer equals (fraction, NaN, Infinity, beyond
+ * int64) is only remembered as present, so the results agree with the
+ * built-in operators applied to int_arr::numeric[]. NULL elements follow the
+ * built-in rules: ignored by &&, and an array containing one is not contained
+ * in anything.
+ *
+ * They are functions because operators named &&, @> and <@ on concrete array
+ * types would capture int4[] && int4[] from the built-in anyarray operators
+ * during operator resolution. The support functions rewrite a call with a
+ * constant array into the built-in operator over an array of the other
+ * operand's element type, which is what GIN array_ops indexes; GIN cannot be
+ * given cross-type support functions, since it always extracts query keys
+ * with the opclass's own anyarray extractQuery function.
+ */
+
+/**
+ * @brief Array operation implemented by a function
+ */
+typedef enum {
+  NUM2INT_ARRAY_OVERLAP,    /**< left && right */
+  NUM2INT_ARRAY_CONTAINS,   /**< left @> right */
+  NUM2INT_ARRAY_CONTAINED   /**< left <@ right */
+} Num2IntArrayOp;
+
+/**
+ * @brief Integer values of one array operand
+ */
+typedef struct {
+  int64 *values;    /**< Exact elements, sorted and deduplicated */
+  int nvalues;      /**< Number of values */
+  bool hasNull;     /**< The array has a NULL element */
+  bool hasInexact;  /**< The array has an element no integer equals */
+} Num2IntArraySet;
+
+/**
+ * @brief Collect the elements of an integer, numeric or float array
+ * @param arr Array of int2, int4, int8, numeric, float4 or float8
+ * @param set Output set
+ */
+static void
+arrayToIntSet(ArrayType *arr, Num2IntArraySet *set) {
+  Oid elemType = ARR_ELEMTYPE(arr);
+  int16 elemLen;
+  bool elemByVal;
+  char elemAlign;
+  Datum *elems;
+  bool *elemNulls;
+  int nelems;
+
+  get_typlenbyvalalign(elemType, &elemLen, &elemByVal, &elemAlign);
+  deconstruct_array(arr, elemType, elemLen, elemByVal, elemAlign,
+                    &elems, &elemNulls, &nelems);
+
+  set->values = (int64 *) palloc(sizeof(int64) * Max(nelems, 1));
+  set->nvalues = 0;
+  set->hasNull = false;
+  set->hasInexact = false;
+
+  for (int i = 0; i < nelems; i++) {
+    if (elemNulls[i]) {
+      set->hasNull = true;
+    } else if (elemType == INT2OID) {
+      set->values[set->nvalues++] = DatumGetInt16(elems[i]);
+    } else if (elemType == INT4OID) {
+      set->values[set->nvalues++] = DatumGetInt32(elems[i]);
+    } else if (elemType == INT8OID) {
+      set->values[set->nvalues++] = DatumGetInt64(elems[i]);
+    } else if (exactConvertToInt(elems[i], elemType, INT8OID,
+                                 &set->values[set->nvalues]) == NUM2INT_EXACT_OK) {
+      set->nvalues++;
+    } else {
+      set->hasInexact = true;
+    }
+  }
+
+  set->nvalues = sortUniqueInt64(set->values, set->nvalues);
 }
 
-PG_FUNCTION_INFO_V1(int2_ge_float8);
-Datum
-int2_ge_float8(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int2_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+/**
+ * @brief Check whether two sets share a value
+ */
+static bool
+intSetsOverlap(const Num2IntArraySet *a, const Num2IntArraySet *b) {
+  int i = 0;
+  int j = 0;
+
+  while (i < a->nvalues && j < b->nvalues) {
+    if (a->values[i] < b->values[j]) {
+      i++;
+    } else if (a->values[i] > b->values[j]) {
+      j++;
+    } else {
+      return true;
+    }
+  }
+  return false;
 }
 
-PG_FUNCTION_INFO_V1(int4_ge_numeric);
+/**
+ * @brief Check whether every element of inner is in outer
+ *
+ * A NULL or inexact element of inner equals nothing in outer.
+ */
+static bool
+intSetContains(const Num2IntArraySet *outer, const Num2IntArraySet *inner) {
+  int i = 0;
+
+  if (inner->hasNull || inner->hasInexact) {
+    return false;
+  }
+
+  for (int j = 0; j < inner->nvalues; j++) {
+    while (i < outer->nvalues && outer->values[i] < inner->values[j]) {
+      i++;
+    }
+    if (i == outer->nvalues || outer->values[i] != inner->values[j]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Evaluate a cross-type array operation
+ * @param left Left operand
+ * @param right Right operand
+ * @param op Operation
+ * @return Result of left op right
+ */
+static bool
+evalArrayOp(ArrayType *left, ArrayType *right, Num2IntArrayOp op) {
+  Num2IntArraySet leftSet;
+  Num2IntArraySet rightSet;
+
+  arrayToIntSet(left, &leftSet);
+  arrayToIntSet(right, &rightSet);
+
+  switch (op) {
+    case NUM2INT_ARRAY_OVERLAP:
+      return intSetsOverlap(&leftSet, &rightSet);
+    case NUM2INT_ARRAY_CONTAINS:
+      return intSetContains(&leftSet, &rightSet);
+    case NUM2INT_ARRAY_CONTAINED:
+      return intSetContains(&rightSet, &leftSet);
+  }
+  return false;
+}
+
+/*
+ * One C function per operation serves every type pair: the element types are
+ * read from the arrays.
+ */
+PG_FUNCTION_INFO_V1(num2int_array_overlap);
 Datum
-int4_ge_numeric(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int4_internal(num, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+num2int_array_overlap(PG_FUNCTION_ARGS) {
+  PG_RETURN_BOOL(evalArrayOp(PG_GETARG_ARRAYTYPE_P(0), PG_GETARG_ARRAYTYPE_P(1),
+                             NUM2INT_ARRAY_OVERLAP));
 }
 
-PG_FUNCTION_INFO_V1(int4_ge_float4);
+PG_FUNCTION_INFO_V1(num2int_array_contains);
 Datum
-int4_ge_float4(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+num2int_array_contains(PG_FUNCTION_ARGS) {
+  PG_RETURN_BOOL(evalArrayOp(PG_GETARG_ARRAYTYPE_P(0), PG_GETARG_ARRAYTYPE_P(1),
+                             NUM2INT_ARRAY_CONTAINS));
 }
 
-PG_FUNCTION_INFO_V1(int4_ge_float8);
+PG_FUNCTION_INFO_V1(num2int_array_contained);
 Datum
-int4_ge_float8(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int4_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+num2int_array_contained(PG_FUNCTION_ARGS) {
+  PG_RETURN_BOOL(evalArrayOp(PG_GETARG_ARRAYTYPE_P(0), PG_GETARG_ARRAYTYPE_P(1),
+                             NUM2INT_ARRAY_CONTAINED));
 }
 
-PG_FUNCTION_INFO_V1(int8_ge_numeric);
+/**
+ * @brief Convert one array element to another integer, numeric or float type
+ * @param value Element value
+ * @param sourceType Element type of value
+ * @param targetType Element type to convert to
+ * @param result Output: converted value
+ * @return false if no value of targetType equals value
+ *
+ * One of the two types is an integer type and the other inexact.
+ */
+static bool
+convertArrayElement(Datum value, Oid sourceType, Oid targetType,
+                    Datum *result) {
+  int64 ival;
+
+  if (targetType == INT2OID || targetType == INT4OID || targetType == INT8OID) {
+    if (exactConvertToInt(value, sourceType, targetType, &ival) !=
+        NUM2INT_EXACT_OK) {
+      return false;
+    }
+    *result = (targetType == INT2OID) ? Int16GetDatum((int16) ival) :
+              (targetType == INT4OID) ? Int32GetDatum((int32) ival) :
+                                        Int64GetDatum(ival);
+    return true;
+  }
+
+  if (sourceType == INT2OID) {
+    ival = DatumGetInt16(value);
+  } else if (sourceType == INT4OID) {
+    ival = DatumGetInt32(value);
+  } else {
+    ival = DatumGetInt64(value);
+  }
+
+  /* Keep only integers the float type holds exactly (see FLOAT*_INT64_MAX) */
+  if (targetType == NUMERICOID) {
+    *result = DirectFunctionCall1(int8_numeric, Int64GetDatum(ival));
+  } else if (targetType == FLOAT4OID) {
+    float4 f = (float4) ival;
+
+    if (f >= FLOAT4_INT64_MAX || (int64) f != ival) {
+      return false;
+    }
+    *result = Float4GetDatum(f);
+  } else {
+    float8 f = (float8) ival;
+
+    if (f >= FLOAT8_INT64_MAX || (int64) f != ival) {
+      return false;
+    }
+    *result = Float8GetDatum(f);
+  }
+  return true;
+}
+
+/**
+ * @brief SupportRequestSimplify for the cross-type array functions
+ * @param req Simplify request for a num2int_array_*() call
+ * @param op Operation implemented by the function
+ * @return Built-in anyarray operator expression, constant FALSE, or NULL
+ *
+ * Applies when exactly one operand is a constant (two constants are folded
+ * by the planner before it asks). The constant is converted to the other
+ * operand's element type. An element that converts to nothing cannot be in
+ * the other array: it is dropped where the operation only looks for it
+ * (&& either side, the left of @>, the right of <@) and makes the result
+ * FALSE where every element must be found. NULL elements are kept, so the
+ * built-in operator treats them as before.
+ */
+static Node *
+simplifyArrayOp(SupportRequestSimplify *req, Num2IntArrayOp op) {
+  FuncExpr *func = req->fcall;
+  static const Oid nativeOps[3] = {
+    OID_ARRAY_OVERLAP_OP, OID_ARRAY_CONTAINS_OP, OID_ARRAY_CONTAINED_OP
+  };
+  Node *args[2];
+  int constIdx;
+  Const *arrayConst;
+  ArrayType *arr;
+  Oid sourceType;
+  Oid targetType;
+  bool mustMatchAll;
+  int16 elemLen;
+  bool elemByVal;
+  char elemAlign;
+  Datum *elems;
+  bool *elemNulls;
+  int nelems;
+  int nresult = 0;
+  int dims[1];
+  int lbs[1];
+  Const *newConst;
+  OpExpr *opExpr;
+
+  if (!enableSupportFunctions || list_length(func->args) != 2) {
+    return NULL;
+  }
+  args[0] = (Node *) linitial(func->args);
+  args[1] = (Node *) lsecond(func->args);
+
+  if (IsA(args[0], Const) && !IsA(args[1], Const)) {
+    constIdx = 0;
+  } else if (IsA(args[1], Const) && !IsA(args[0], Const)) {
+    constIdx = 1;
+  } else {
+    return NULL;
+  }
+
+  arrayConst = (Const *) args[constIdx];
+  if (arrayConst->constisnull) {
+    return NULL;
+  }
+  arr = DatumGetArrayTypeP(arrayConst->constvalue);
+  sourceType = ARR_ELEMTYPE(arr);
+  targetType = get_element_type(exprType(args[1 - constIdx]));
+  if (!OidIsValid(targetType)) {
+    return NULL;
+  }
+
+  mustMatchAll = (op == NUM2INT_ARRAY_CONTAINS && constIdx == 1) ||
+                 (op == NUM2INT_ARRAY_CONTAINED && constIdx == 0);
+
+  get_typlenbyvalalign(sourceType, &elemLen, &elemByVal, &elemAlign);
+  deconstruct_array(arr, sourceType, elemLen, elemByVal, elemAlign,
+                    &elems, &elemNulls, &nelems);
+
+  /* Convert in place: an element is never needed after its slot is reused */
+  for (int i = 0; i < nelems; i++) {
+    Datum converted;
+
+    if (elemNulls[i]) {
+      elems[nresult] = (Datum) 0;
+      elemNulls[nresult++] = true;
+    } else if (convertArrayElement(elems[i], sourceType, targetType,
+                                   &converted)) {
+      elems[nresult] = converted;
+      elemNulls[nresult++] = false;
+    } else if (mustMatchAll) {
+      return (Node *) makeBoolConst(false, false);
+    }
+  }
+
+  elog(DEBUG1, "num2int array function rewrite: op=%d, %d of %d elements kept",
+       op, nresult, nelems);
+
+  get_typlenbyvalalign(targetType, &elemLen, &elemByVal, &elemAlign);
+  dims[0] = nresult;
+  lbs[0] = 1;
+  newConst = makeConst(get_array_type(targetType), -1, InvalidOid, -1,
+                       PointerGetDatum(nresult > 0 ?
+                           construct_md_array(elems, elemNulls, 1, dims, lbs,
+                                              targetType, elemLen, elemByVal,
+                                              elemAlign) :
+                           construct_empty_array(targetType)),
+                       false, false);
+  args[constIdx] = (Node *) newConst;
+
+  opExpr = (OpExpr *) make_opclause(nativeOps[op], BOOLOID, false,
+                                    (Expr *) args[0], (Expr *) args[1],
+                                    InvalidOid, func->inputcollid);
+  opExpr->opfuncid = get_opcode(nativeOps[op]);
+  opExpr->location = func->location;
+  return (Node *) opExpr;
+}
+
+PG_FUNCTION_INFO_V1(num2int_array_overlap_support);
 Datum
-int8_ge_numeric(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  Numeric num = PG_GETARG_NUMERIC(1);
-  int cmp = numeric_cmp_int8_internal(num, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+num2int_array_overlap_support(PG_FUNCTION_ARGS) {
+  Node *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+  if (IsA(rawreq, SupportRequestSimplify)) {
+    PG_RETURN_POINTER(simplifyArrayOp((SupportRequestSimplify *) rawreq,
+                                      NUM2INT_ARRAY_OVERLAP));
+  }
+  PG_RETURN_POINTER(NULL);
 }
 
-PG_FUNCTION_INFO_V1(int8_ge_float4);
+PG_FUNCTION_INFO_V1(num2int_array_contains_support);
 Datum
-int8_ge_float4(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float4 fval = PG_GETARG_FLOAT4(1);
-  int cmp = float4_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+num2int_array_contains_support(PG_FUNCTION_ARGS) {
+  Node *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+  if (IsA(rawreq, SupportRequestSimplify)) {
+    PG_RETURN_POINTER(simplifyArrayOp((SupportRequestSimplify *) rawreq,
+                                      NUM2INT_ARRAY_CONTAINS));
+  }
+  PG_RETURN_POINTER(NULL);
 }
 
-PG_FUNCTION_INFO_V1(int8_ge_float8);
+PG_FUNCTION_INFO_V1(num2int_array_contained_support);
 Datum
-int8_ge_float8(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float8 fval = PG_GETARG_FLOAT8(1);
-  int cmp = float8_cmp_int8_internal(fval, ival);
-  PG_RETURN_BOOL(cmp <= 0);
+num2int_array_contained_support(PG_FUNCTION_ARGS) {
+  Node *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+  if (IsA(rawreq, SupportRequestSimplify)) {
+    PG_RETURN_POINTER(simplifyArrayOp((SupportRequestSimplify *) rawreq,
+                                      NUM2INT_ARRAY_CONTAINED));
+  }
+  PG_RETURN_POINTER(NULL);
 }
 
 /* ============================================================================
- * Hash Functions for Cross-Type Equality
+ * Join Selectivity Estimation
  * ============================================================================
- * These wrapper functions ensure that equal values hash consistently across
- * types. For example, 10::int4 and 10.0::numeric must produce the same hash.
- *
- * Strategy: Compute the same hash that hash_numeric would produce, but
- * without allocating a Numeric structure. We build the base-10000 digit
- * representation on the stack and hash it directly.
- *
- * hash_numeric algorithm:
- *   1. Strip leading/trailing zero digits
- *   2. hash_any() on the remaining digit array
- *   3. XOR in the adjusted weight
+ * eqjoinsel matches the two MCV lists by calling the operator's function for
+ * every pair until it finds a match, so with default_statistics_target = 1000
+ * a numeric = int4 join clause costs up to a million numeric comparisons
+ * through fmgr, repeated for every join order the planner considers.
+ * num2int_eqjoinsel converts both lists to int64 once, skipping inexact MCVs
+ * that are not exactly an integer since they equal no integer, sorts them and
+ * merge-matches. The rest is eqjoinsel's arithmetic, done in the same order,
+ * so the estimates are the same.
+ */
+
+/**
+ * @brief An MCV converted to int64, with its position in the MCV list
+ */
+typedef struct {
+  int64 value;
+  int index;
+} Num2IntMcvKey;
+
+/**
+ * @brief qsort comparator ordering MCV keys by value, then by list position
+ */
+static int
+compareMcvKeys(const void *a, const void *b) {
+  const Num2IntMcvKey *ka = (const Num2IntMcvKey *) a;
+  const Num2IntMcvKey *kb = (const Num2IntMcvKey *) b;
+
+  if (ka->value != kb->value) {
+    return ka->value < kb->value ? -1 : 1;
+  }
+  return ka->index - kb->index;
+}
+
+/**
+ * @brief Convert the first nvalues MCVs of a statistics slot to sorted keys
+ * @param sslot MCV slot
+ * @param nvalues Number of leading MCVs to convert
+ * @param type Type of the values (an integer or an inexact type)
+ * @param keys Output: room for nvalues keys
+ * @return Number of keys stored
+ */
+static int
+mcvKeysFromSlot(const AttStatsSlot *sslot, int nvalues, Oid type,
+                Num2IntMcvKey *keys) {
+  int nkeys = 0;
+
+  for (int i = 0; i < nvalues; i++) {
+    Datum value = sslot->values[i];
+    int64 key;
+
+    switch (type) {
+      case INT2OID:
+        key = DatumGetInt16(value);
+        break;
+      case INT4OID:
+        key = DatumGetInt32(value);
+        break;
+      case INT8OID:
+        key = DatumGetInt64(value);
+        break;
+      default:
+        if (exactConvertToInt(value, type, INT8OID, &key) != NUM2INT_EXACT_OK) {
+          continue;
+        }
+        break;
+    }
+    keys[nkeys].value = key;
+    keys[nkeys].index = i;
+    nkeys++;
+  }
+
+  qsort(keys, nkeys, sizeof(Num2IntMcvKey), compareMcvKeys);
+  return nkeys;
+}
+
+/**
+ * @brief Match two MCV lists by exact value
+ * @param sslot1 First MCV list
+ * @param nvalues1 Number of leading entries of sslot1 to match
+ * @param type1 Type of the sslot1 values
+ * @param sslot2 Second MCV list
+ * @param nvalues2 Number of leading entries of sslot2 to match
+ * @param type2 Type of the sslot2 values
+ * @param partner1 Output: for each sslot1 entry the index of its match in
+ *        sslot2, or -1
+ * @param hasmatch2 Output: sslot2 entries that were matched (zeroed by the
+ *        caller)
+ * @return Number of matches
  *
- * For int64, we need at most 5 base-10000 digits (10000^5 > 2^63).
+ * Equal values are paired in list order, which is the pairing eqjoinsel's
+ * "first unmatched entry" loop finds.
  */
+static int
+matchMcvLists(const AttStatsSlot *sslot1, int nvalues1, Oid type1,
+              const AttStatsSlot *sslot2, int nvalues2, Oid type2,
+              int *partner1, bool *hasmatch2) {
+  Num2IntMcvKey *keys1 = palloc(Max(nvalues1, 1) * sizeof(Num2IntMcvKey));
+  Num2IntMcvKey *keys2 = palloc(Max(nvalues2, 1) * sizeof(Num2IntMcvKey));
+  int nkeys1 = mcvKeysFromSlot(sslot1, nvalues1, type1, keys1);
+  int nkeys2 = mcvKeysFromSlot(sslot2, nvalues2, type2, keys2);
+  int i = 0, j = 0;
+  int nmatches = 0;
+
+  for (int k = 0; k < nvalues1; k++) {
+    partner1[k] = -1;
+  }
 
-// Compute hash for int64 matching hash_numeric's output
-// Returns the hash value directly (no palloc)
-static Datum
-hash_int64_as_numeric_internal(int64 val)
-{
-  Num2IntNumericDigit digits[5];  // max 5 digits for int64 in base-10000
-  int ndigits = 0;
-  int weight;
-  uint64 uval;
-  Datum digit_hash;
-  int i;
+  while (i < nkeys1 && j < nkeys2) {
+    if (keys1[i].value < keys2[j].value) {
+      i++;
+    } else if (keys1[i].value > keys2[j].value) {
+      j++;
+    } else {
+      partner1[keys1[i].index] = keys2[j].index;
+      hasmatch2[keys2[j].index] = true;
+      nmatches++;
+      i++;
+      j++;
+    }
+  }
 
-  // Handle zero specially - hash_numeric returns -1 for zero
-  if (val == 0)
-    return UInt32GetDatum((uint32) -1);
+  pfree(keys1);
+  pfree(keys2);
+  return nmatches;
+}
 
-  // Work with absolute value
-  if (val < 0) {
-    // Handle PG_INT64_MIN carefully: -PG_INT64_MIN overflows
-    if (val == PG_INT64_MIN)
-      uval = ((uint64) PG_INT64_MAX) + 1;
-    else
-      uval = (uint64) (-val);
+/**
+ * @brief Inner join selectivity, as eqjoinsel_inner() computes it
+ * @return Selectivity of "var1 = var2" between the two relations
+ */
+static double
+num2intJoinselInner(Oid type1, Oid type2, double nd1, double nd2,
+                    AttStatsSlot *sslot1, AttStatsSlot *sslot2,
+                    Form_pg_statistic stats1, Form_pg_statistic stats2,
+                    bool haveMcvs1, bool haveMcvs2) {
+  double selec;
+
+  if (haveMcvs1 && haveMcvs2) {
+    double nullfrac1 = stats1->stanullfrac;
+    double nullfrac2 = stats2->stanullfrac;
+    double matchprodfreq = 0.0;
+    double matchfreq1 = 0.0, unmatchfreq1 = 0.0, otherfreq1;
+    double matchfreq2 = 0.0, unmatchfreq2 = 0.0, otherfreq2;
+    double totalsel1, totalsel2;
+    int *partner1 = palloc(sslot1->nvalues * sizeof(int));
+    bool *hasmatch2 = palloc0(sslot2->nvalues * sizeof(bool));
+    int nmatches;
+
+    nmatches = matchMcvLists(sslot1, sslot1->nvalues, type1,
+                             sslot2, sslot2->nvalues, type2,
+                             partner1, hasmatch2);
+
+    /* Summed in sslot1 order, like eqjoinsel, for the same rounding */
+    for (int i = 0; i < sslot1->nvalues; i++) {
+      if (partner1[i] >= 0) {
+        matchprodfreq += sslot1->numbers[i] * sslot2->numbers[partner1[i]];
+      }
+    }
+    CLAMP_PROBABILITY(matchprodfreq);
+
+    for (int i = 0; i < sslot1->nvalues; i++) {
+      if (partner1[i] >= 0)
+        matchfreq1 += sslot1->numbers[i];
+      else
+        unmatchfreq1 += sslot1->numbers[i];
+    }
+    CLAMP_PROBABILITY(matchfreq1);
+    CLAMP_PROBABILITY(unmatchfreq1);
+    for (int i = 0; i < sslot2->nvalues; i++) {
+      if (hasmatch2[i])
+        matchfreq2 += sslot2->numbers[i];
+      else
+        unmatchfreq2 += sslot2->numbers[i];
+    }
+    CLAMP_PROBABILITY(matchfreq2);
+    CLAMP_PROBABILITY(unmatchfreq2);
+    pfree(partner1);
+    pfree(hasmatch2);
+
+    /* Frequency of non-null values that are not in the MCV lists */
+    otherfreq1 = 1.0 - nullfrac1 - matchfreq1 - unmatchfreq1;
+    otherfreq2 = 1.0 - nullfrac2 - matchfreq2 - unmatchfreq2;
+    CLAMP_PROBABILITY(otherfreq1);
+    CLAMP_PROBABILITY(otherfreq2);
+
+    /*
+     * Matched MCVs, plus unmatched MCVs against the other side's non-MCV
+     * population, plus non-MCVs against the other side's unmatched MCVs and
+     * non-MCVs; from each side's point of view, taking the smaller.
+     */
+    totalsel1 = matchprodfreq;
+    if (nd2 > sslot2->nvalues)
+      totalsel1 += unmatchfreq1 * otherfreq2 / (nd2 - sslot2->nvalues);
+    if (nd2 > nmatches)
+      totalsel1 += otherfreq1 * (otherfreq2 + unmatchfreq2) / (nd2 - nmatches);
+    totalsel2 = matchprodfreq;
+    if (nd1 > sslot1->nvalues)
+      totalsel2 += unmatchfreq2 * otherfreq1 / (nd1 - sslot1->nvalues);
+    if (nd1 > nmatches)
+      totalsel2 += otherfreq2 * (otherfreq1 + unmatchfreq1) / (nd1 - nmatches);
+
+    selec = (totalsel1 < totalsel2) ? totalsel1 : totalsel2;
+
+    elog(DEBUG1, "num2int join selectivity: %d of %d x %d MCVs matched",
+         nmatches, sslot1->nvalues, sslot2->nvalues);
   } else {
-    uval = (uint64) val;
+    double nullfrac1 = stats1 ? stats1->stanullfrac : 0.0;
+    double nullfrac2 = stats2 ? stats2->stanullfrac : 0.0;
+
+    /* MIN(1/nd1, 1/nd2) * (1 - nullfrac1) * (1 - nullfrac2) */
+    selec = (1.0 - nullfrac1) * (1.0 - nullfrac2);
+    if (nd1 > nd2)
+      selec /= nd1;
+    else
+      selec /= nd2;
   }
 
-  // Extract base-10000 digits (least significant first)
-  while (uval > 0) {
-    digits[ndigits++] = (Num2IntNumericDigit)(uval % NUM2INT_NBASE);
-    uval /= NUM2INT_NBASE;
+  return selec;
+}
+
+/**
+ * @brief Semi/anti join selectivity, as eqjoinsel_semi() computes it
+ * @param vardata2 Inner side variable
+ * @param innerRel The join's inner input relation
+ * @return Fraction of var1's relation that has a join partner
+ *
+ * haveMcvs1 must already be false when the operator has no commutator and
+ * the sides were swapped, matching eqjoinsel's InvalidOid check.
+ */
+static double
+num2intJoinselSemi(VariableStatData *vardata2, Oid type1, Oid type2,
+                   double nd1, double nd2, bool isdefault1, bool isdefault2,
+                   AttStatsSlot *sslot1, AttStatsSlot *sslot2,
+                   Form_pg_statistic stats1, bool haveMcvs1, bool haveMcvs2,
+                   RelOptInfo *innerRel) {
+  double selec;
+
+  /*
+   * There can't be more distinct values coming from the inner side than the
+   * rows it produces. Only nd2 is clamped: restrictions on the outer
+   * relation are already in the row count the selectivity multiplies.
+   */
+  if (vardata2->rel && nd2 >= vardata2->rel->rows) {
+    nd2 = vardata2->rel->rows;
+    isdefault2 = false;
+  }
+  if (nd2 >= innerRel->rows) {
+    nd2 = innerRel->rows;
+    isdefault2 = false;
   }
 
-  // Reverse to get most significant first (as Numeric stores them)
-  for (i = 0; i < ndigits / 2; i++) {
-    Num2IntNumericDigit tmp = digits[i];
-    digits[i] = digits[ndigits - 1 - i];
-    digits[ndigits - 1 - i] = tmp;
+  if (haveMcvs1 && haveMcvs2) {
+    double nullfrac1 = stats1->stanullfrac;
+    double matchfreq1 = 0.0;
+    double uncertainfrac, uncertain;
+    /* Assume the nd2 most common values are the ones that reach the join */
+    int clampedNvalues2 = (int) Min(sslot2->nvalues, nd2);
+    int *partner1 = palloc(sslot1->nvalues * sizeof(int));
+    bool *hasmatch2 = palloc0(Max(clampedNvalues2, 1) * sizeof(bool));
+    int nmatches;
+
+    nmatches = matchMcvLists(sslot1, sslot1->nvalues, type1,
+                             sslot2, clampedNvalues2, type2,
+                             partner1, hasmatch2);
+
+    for (int i = 0; i < sslot1->nvalues; i++) {
+      if (partner1[i] >= 0)
+        matchfreq1 += sslot1->numbers[i];
+    }
+    CLAMP_PROBABILITY(matchfreq1);
+    pfree(partner1);
+    pfree(hasmatch2);
+
+    /*
+     * Matched MCVs have a partner. Of the rest, assume all do if nd1 <= nd2
+     * and a fraction nd2/nd1 otherwise, or half without real ndistincts.
+     */
+    if (!isdefault1 && !isdefault2) {
+      nd1 -= nmatches;
+      nd2 -= nmatches;
+      if (nd1 <= nd2 || nd2 < 0)
+        uncertainfrac = 1.0;
+      else
+        uncertainfrac = nd2 / nd1;
+    } else {
+      uncertainfrac = 0.5;
+    }
+    uncertain = 1.0 - matchfreq1 - nullfrac1;
+    CLAMP_PROBABILITY(uncertain);
+    selec = matchfreq1 + uncertainfrac * uncertain;
+  } else {
+    double nullfrac1 = stats1 ? stats1->stanullfrac : 0.0;
+
+    if (!isdefault1 && !isdefault2) {
+      if (nd1 <= nd2 || nd2 < 0)
+        selec = 1.0 - nullfrac1;
+      else
+        selec = (nd2 / nd1) * (1.0 - nullfrac1);
+    } else {
+      selec = 0.5 * (1.0 - nullfrac1);
+    }
   }
 
-  // Weight is ndigits - 1 (position of most significant digit)
-  weight = ndigits - 1;
+  return selec;
+}
 
-  // Strip trailing zeros (hash_numeric does this)
-  while (ndigits > 0 && digits[ndigits - 1] == 0)
-    ndigits--;
+/**
+ * @brief Find the RelOptInfo of a join input, as selfuncs.c does
+ */
+static RelOptInfo *
+findJoinInputRel(PlannerInfo *root, Relids relids) {
+  RelOptInfo *rel = NULL;
+
+  switch (bms_membership(relids)) {
+    case BMS_EMPTY_SET:
+      break;
+    case BMS_SINGLETON:
+      rel = find_base_rel(root, bms_singleton_member(relids));
+      break;
+    case BMS_MULTIPLE:
+      rel = find_join_rel(root, relids);
+      break;
+  }
 
-  // Hash the digit array and XOR with weight
-  digit_hash = hash_any((unsigned char *) digits,
-                        ndigits * sizeof(Num2IntNumericDigit));
-  return UInt32GetDatum(DatumGetUInt32(digit_hash) ^ weight);
+  if (rel == NULL) {
+    elog(ERROR, "could not find RelOptInfo for given relids");
+  }
+  return rel;
 }
 
-// Extended version with seed
-static Datum
-hash_int64_as_numeric_extended_internal(int64 val, uint64 seed)
-{
-  Num2IntNumericDigit digits[5];
-  int ndigits = 0;
-  int weight;
-  uint64 uval;
-  Datum digit_hash;
-  int i;
+/**
+ * @brief Check whether an operator compares an integer with an inexact type
+ */
+static bool
+isIntInexactPair(Oid lefttype, Oid righttype) {
+  bool leftInt = lefttype == INT2OID || lefttype == INT4OID ||
+                 lefttype == INT8OID;
+  bool rightInt = righttype == INT2OID || righttype == INT4OID ||
+                  righttype == INT8OID;
+  bool leftInexact = lefttype == NUMERICOID || lefttype == FLOAT4OID ||
+                     lefttype == FLOAT8OID;
+  bool rightInexact = righttype == NUMERICOID || righttype == FLOAT4OID ||
+                      righttype == FLOAT8OID;
 
-  // Handle zero - hash_numeric_extended returns seed - 1 for zero
-  if (val == 0)
-    return UInt64GetDatum(seed - 1);
+  return (leftInt && rightInexact) || (leftInexact && rightInt);
+}
 
-  // Work with absolute value
-  if (val < 0) {
-    if (val == PG_INT64_MIN)
-      uval = ((uint64) PG_INT64_MAX) + 1;
-    else
-      uval = (uint64) (-val);
-  } else {
-    uval = (uint64) val;
+/**
+ * @brief Join selectivity estimator for the cross-type equality operators
+ * @param fcinfo Standard join estimator arguments
+ *        (root, operator, args, jointype, sjinfo)
+ * @return Estimated selectivity as float8
+ *
+ * Used as JOIN for the 18 = operators. Computes eqjoinsel's estimate with
+ * the MCV lists matched by a sort and merge in the integer domain. When
+ * pg_num2int_direct_comp.enableSupportFunctions is off, or the operator
+ * does not compare an integer with numeric or a float type, calls
+ * eqjoinsel.
+ */
+PG_FUNCTION_INFO_V1(num2int_eqjoinsel);
+Datum
+num2int_eqjoinsel(PG_FUNCTION_ARGS) {
+  PlannerInfo *root = (PlannerInfo *) PG_GETARG_POINTER(0);
+  Oid operator = PG_GETARG_OID(1);
+  List *args = (List *) PG_GETARG_POINTER(2);
+  SpecialJoinInfo *sjinfo = (SpecialJoinInfo *) PG_GETARG_POINTER(4);
+  Oid lefttype, righttype;
+  Oid opfuncoid;
+  VariableStatData vardata1, vardata2;
+  double nd1, nd2;
+  bool isdefault1, isdefault2;
+  AttStatsSlot sslot1, sslot2;
+  Form_pg_statistic stats1 = NULL, stats2 = NULL;
+  bool haveMcvs1 = false, haveMcvs2 = false;
+  bool joinIsReversed;
+  RelOptInfo *innerRel;
+  double selec, selecInner;
+
+  op_input_types(operator, &lefttype, &righttype);
+  if (!enableSupportFunctions || !isIntInexactPair(lefttype, righttype)) {
+    PG_RETURN_DATUM(DirectFunctionCall5Coll(eqjoinsel,
+                                            PG_GET_COLLATION(),
+                                            PG_GETARG_DATUM(0),
+                                            PG_GETARG_DATUM(1),
+                                            PG_GETARG_DATUM(2),
+                                            PG_GETARG_DATUM(3),
+                                            PG_GETARG_DATUM(4)));
   }
 
-  // Extract base-10000 digits (least significant first)
-  while (uval > 0) {
-    digits[ndigits++] = (Num2IntNumericDigit)(uval % NUM2INT_NBASE);
-    uval /= NUM2INT_NBASE;
+  get_join_variables(root, args, sjinfo, &vardata1, &vardata2,
+                     &joinIsReversed);
+  nd1 = get_variable_numdistinct(&vardata1, &isdefault1);
+  nd2 = get_variable_numdistinct(&vardata2, &isdefault2);
+  opfuncoid = get_opcode(operator);
+
+  memset(&sslot1, 0, sizeof(sslot1));
+  memset(&sslot2, 0, sizeof(sslot2));
+
+  /* nullfrac is used regardless of the security check, as in eqjoinsel */
+  if (HeapTupleIsValid(vardata1.statsTuple)) {
+    stats1 = (Form_pg_statistic) GETSTRUCT(vardata1.statsTuple);
+    if (statistic_proc_security_check(&vardata1, opfuncoid)) {
+      haveMcvs1 = get_attstatsslot(&sslot1, vardata1.statsTuple,
+                                   STATISTIC_KIND_MCV, InvalidOid,
+                                   ATTSTATSSLOT_VALUES | ATTSTATSSLOT_NUMBERS);
+    }
   }
-
-  // Reverse to most significant first
-  for (i = 0; i < ndigits / 2; i++) {
-    Num2IntNumericDigit tmp = digits[i];
-    digits[i] = digits[ndigits - 1 - i];
-    digits[ndigits - 1 - i] = tmp;
+  if (HeapTupleIsValid(vardata2.statsTuple)) {
+    stats2 = (Form_pg_statistic) GETSTRUCT(vardata2.statsTuple);
+    if (statistic_proc_security_check(&vardata2, opfuncoid)) {
+      haveMcvs2 = get_attstatsslot(&sslot2, vardata2.statsTuple,
+                                   STATISTIC_KIND_MCV, InvalidOid,
+                                   ATTSTATSSLOT_VALUES | ATTSTATSSLOT_NUMBERS);
+    }
   }
 
-  weight = ndigits - 1;
+  selecInner = num2intJoinselInner(lefttype, righttype, nd1, nd2,
+                                   &sslot1, &sslot2, stats1, stats2,
+                                   haveMcvs1, haveMcvs2);
+
+  switch (sjinfo->jointype) {
+    case JOIN_INNER:
+    case JOIN_LEFT:
+    case JOIN_FULL:
+      selec = selecInner;
+      break;
+    case JOIN_SEMI:
+    case JOIN_ANTI:
+      /* Neither join type lets rels move into or out of its RHS */
+      innerRel = findJoinInputRel(root, sjinfo->min_righthand);
+
+      if (!joinIsReversed) {
+        selec = num2intJoinselSemi(&vardata2, lefttype, righttype,
+                                   nd1, nd2, isdefault1, isdefault2,
+                                   &sslot1, &sslot2, stats1,
+                                   haveMcvs1, haveMcvs2, innerRel);
+      } else {
+        bool haveCommutator = OidIsValid(get_commutator(operator));
 
-  // Strip trailing zeros
-  while (ndigits > 0 && digits[ndigits - 1] == 0)
-    ndigits--;
+        selec = num2intJoinselSemi(&vardata1, righttype, lefttype,
+                                   nd2, nd1, isdefault2, isdefault1,
+                                   &sslot2, &sslot1, stats2,
+                                   haveMcvs2 && haveCommutator, haveMcvs1,
+                                   innerRel);
+      }
 
-  digit_hash = hash_any_extended((unsigned char *) digits,
-                                 ndigits * sizeof(Num2IntNumericDigit),
-                                 seed);
-  return UInt64GetDatum(DatumGetUInt64(digit_hash) ^ weight);
-}
+      /* A semijoin never produces more rows than the inner join would */
+      selec = Min(selec, innerRel->rows * selecInner);
+      break;
+    default:
+      elog(ERROR, "unrecognized join type: %d", (int) sjinfo->jointype);
+      selec = 0;                /* keep compiler quiet */
+      break;
+  }
 
-/* Numeric hash wrappers - compute hash matching hash_numeric without palloc */
-PG_FUNCTION_INFO_V1(hash_int2_as_numeric);
-Datum
-hash_int2_as_numeric(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  return hash_int64_as_numeric_internal((int64) ival);
-}
+  free_attstatsslot(&sslot1);
+  free_attstatsslot(&sslot2);
+  ReleaseVariableStats(vardata1);
+  ReleaseVariableStats(vardata2);
 
-PG_FUNCTION_INFO_V1(hash_int2_as_numeric_extended);
-Datum
-hash_int2_as_numeric_extended(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  uint64 seed = PG_GETARG_INT64(1);
-  return hash_int64_as_numeric_extended_internal((int64) ival, seed);
+  CLAMP_PROBABILITY(selec);
+  PG_RETURN_FLOAT8((float8) selec);
 }
 
-PG_FUNCTION_INFO_V1(hash_int4_as_numeric);
-Datum
-hash_int4_as_numeric(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  return hash_int64_as_numeric_internal((int64) ival);
-}
+/* ============================================================================
+ * Kernel Microbenchmark
+ * ============================================================================
+ * num2int_bench() runs the comparison and hash kernels directly, without the
+ * executor or fmgr in between, over fixed value distributions. The *_call
+ * cases instead call an operator wrapper through fmgr as a qual does, next to
+ * the native int8lt, which is what the SupportRequestCost multiples are
+ * measured against. Timings are only comparable between builds on the same
+ * machine; see doc/benchmark.md.
+ */
 
-PG_FUNCTION_INFO_V1(hash_int4_as_numeric_extended);
-Datum
-hash_int4_as_numeric_extended(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  uint64 seed = PG_GETARG_INT64(1);
-  return hash_int64_as_numeric_extended_internal((int64) ival, seed);
-}
+/* Values per distribution; a power of two so the index is a mask */
+#define NUM2INT_BENCH_VALUES 1024
+
+typedef enum {
+  NUM2INT_BENCH_NUMERIC_CMP = 0,
+  NUM2INT_BENCH_NUMERIC_EQ,
+  NUM2INT_BENCH_INTEGRAL_CMP,
+  NUM2INT_BENCH_FLOAT4_CMP,
+  NUM2INT_BENCH_FLOAT8_CMP,
+  NUM2INT_BENCH_HASH_NUMERIC,
+  NUM2INT_BENCH_INT8_CALL,
+  NUM2INT_BENCH_NUMERIC_CALL,
+  NUM2INT_BENCH_FLOAT8_CALL
+} Num2IntBenchKernel;
+
+typedef struct Num2IntBenchCase {
+  const char *kernel;
+  const char *distribution;
+  Num2IntBenchKernel kind;
+} Num2IntBenchCase;
+
+static const Num2IntBenchCase benchCases[] = {
+  {"numeric_cmp_int8", "short_integral", NUM2INT_BENCH_NUMERIC_CMP},
+  {"numeric_cmp_int8", "wide_integral", NUM2INT_BENCH_NUMERIC_CMP},
+  {"numeric_cmp_int8", "long_header", NUM2INT_BENCH_NUMERIC_CMP},
+  {"numeric_cmp_int8", "fraction", NUM2INT_BENCH_NUMERIC_CMP},
+  {"numeric_cmp_int8", "huge", NUM2INT_BENCH_NUMERIC_CMP},
+  {"numeric_cmp_int8", "p18", NUM2INT_BENCH_NUMERIC_CMP},
+  {"numeric_eq_int8", "short_integral", NUM2INT_BENCH_NUMERIC_EQ},
+  {"numeric_eq_int8", "wide_integral", NUM2INT_BENCH_NUMERIC_EQ},
+  {"numeric_eq_int8", "long_header", NUM2INT_BENCH_NUMERIC_EQ},
+  {"numeric_eq_int8", "fraction", NUM2INT_BENCH_NUMERIC_EQ},
+  {"numeric_eq_int8", "huge", NUM2INT_BENCH_NUMERIC_EQ},
+  {"numeric18_0_cmp_int8", "short_integral", NUM2INT_BENCH_INTEGRAL_CMP},
+  {"numeric18_0_cmp_int8", "p18", NUM2INT_BENCH_INTEGRAL_CMP},
+  {"float4_cmp_int8", "integral", NUM2INT_BENCH_FLOAT4_CMP},
+  {"float4_cmp_int8", "fraction", NUM2INT_BENCH_FLOAT4_CMP},
+  {"float4_cmp_int8", "near_2p24", NUM2INT_BENCH_FLOAT4_CMP},
+  {"float8_cmp_int8", "integral", NUM2INT_BENCH_FLOAT8_CMP},
+  {"float8_cmp_int8", "fraction", NUM2INT_BENCH_FLOAT8_CMP},
+  {"float8_cmp_int8", "near_2p53", NUM2INT_BENCH_FLOAT8_CMP},
+  {"hash_int8_as_numeric", "small", NUM2INT_BENCH_HASH_NUMERIC},
+  {"hash_int8_as_numeric", "wide", NUM2INT_BENCH_HASH_NUMERIC},
+  {"int8lt_call", "short_integral", NUM2INT_BENCH_INT8_CALL},
+  {"numeric_lt_int8_call", "short_integral", NUM2INT_BENCH_NUMERIC_CALL},
+  {"numeric_lt_int8_call", "wide_integral", NUM2INT_BENCH_NUMERIC_CALL},
+  {"numeric_lt_int8_call", "fraction", NUM2INT_BENCH_NUMERIC_CALL},
+  {"numeric_lt_int8_call", "numeric18_0", NUM2INT_BENCH_NUMERIC_CALL},
+  {"numeric_lt_int8_call", "constant", NUM2INT_BENCH_NUMERIC_CALL},
+  {"float8_lt_int8_call", "integral", NUM2INT_BENCH_FLOAT8_CALL},
+  {"float8_lt_int8_call", "fraction", NUM2INT_BENCH_FLOAT8_CALL}
+};
 
-PG_FUNCTION_INFO_V1(hash_int8_as_numeric);
-Datum
-hash_int8_as_numeric(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  return hash_int64_as_numeric_internal(ival);
+/* Deterministic LCG so every run sees the same values */
+static inline uint64
+benchNextRandom(uint64 *state) {
+  *state = *state * UINT64CONST(6364136223846793005) +
+           UINT64CONST(1442695040888963407);
+  return *state >> 17;
 }
 
-PG_FUNCTION_INFO_V1(hash_int8_as_numeric_extended);
-Datum
-hash_int8_as_numeric_extended(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  uint64 seed = PG_GETARG_INT64(1);
-  return hash_int64_as_numeric_extended_internal(ival, seed);
+/* Signed value in [-range, range] */
+static inline int64
+benchRandomInt(uint64 *state, int64 range) {
+  return (int64) (benchNextRandom(state) % (uint64) (2 * range + 1)) - range;
 }
 
-/* Float hash wrappers - cast int to float, then hash */
-PG_FUNCTION_INFO_V1(hash_int2_as_float4);
-Datum
-hash_int2_as_float4(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float4 fval = (float4) ival;
-  return DirectFunctionCall1(hashfloat4, Float4GetDatum(fval));
+/**
+ * @brief Build a numeric from its text form
+ * @param str Decimal literal
+ * @return Newly allocated Numeric
+ */
+static Numeric
+benchNumeric(const char *str) {
+  return DatumGetNumeric(DirectFunctionCall3(numeric_in,
+                                             CStringGetDatum(str),
+                                             ObjectIdGetDatum(InvalidOid),
+                                             Int32GetDatum(-1)));
 }
 
-PG_FUNCTION_INFO_V1(hash_int2_as_float4_extended);
-Datum
-hash_int2_as_float4_extended(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  int64 seed = PG_GETARG_INT64(1);
-  float4 fval = (float4) ival;
-  return DirectFunctionCall2(hashfloat4extended, Float4GetDatum(fval), Int64GetDatum(seed));
-}
+/**
+ * @brief Fill the operand arrays of one benchmark case
+ *
+ * The integer operand is the value itself, one above or one below it, so
+ * every comparison outcome occurs and early-out branches do not dominate.
+ * long_header values carry 64 zero decimals, which forces the long numeric
+ * header the short-format fast path does not cover. constant repeats one
+ * numeric against varying integers, as a comparison with a constant does.
+ * p18 values have up to 18 digits, the widest a numeric(18,0) column holds.
+ */
+static void
+benchFillValues(const Num2IntBenchCase *bc, Numeric *nums, float8 *floats,
+                int64 *keys, int64 *ints) {
+  uint64 state = UINT64CONST(0x4e554d32494e54);
+  char buf[128];
+
+  for (int i = 0; i < NUM2INT_BENCH_VALUES; i++) {
+    int64 v;
+    int64 delta = benchRandomInt(&state, 1);
+    const char *dist = bc->distribution;
+
+    if (strcmp(dist, "wide_integral") == 0 || strcmp(dist, "wide") == 0) {
+      v = (int64) (benchNextRandom(&state) % UINT64CONST(9000000000000000000));
+      if (benchNextRandom(&state) & 1)
+        v = -v;
+    } else if (strcmp(dist, "p18") == 0) {
+      /* Two draws: one draw has fewer than 18 digits */
+      v = (int64) (benchNextRandom(&state) % UINT64CONST(1000000000)) *
+              INT64CONST(1000000000) +
+          (int64) (benchNextRandom(&state) % UINT64CONST(1000000000));
+      if (benchNextRandom(&state) & 1)
+        v = -v;
+    } else if (strcmp(dist, "near_2p24") == 0) {
+      v = (INT64CONST(1) << 24) + benchRandomInt(&state, 4);
+    } else if (strcmp(dist, "near_2p53") == 0) {
+      v = (INT64CONST(1) << 53) + benchRandomInt(&state, 4);
+    } else if (strcmp(dist, "small") == 0) {
+      v = benchRandomInt(&state, 10000);
+    } else {
+      v = benchRandomInt(&state, 1000000);
+    }
+    ints[i] = v + delta;
+    if (strcmp(dist, "constant") == 0) {
+      v = 500000;
+    }
 
-PG_FUNCTION_INFO_V1(hash_int4_as_float4);
-Datum
-hash_int4_as_float4(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float4 fval = (float4) ival;
-  return DirectFunctionCall1(hashfloat4, Float4GetDatum(fval));
+    switch (bc->kind) {
+      case NUM2INT_BENCH_NUMERIC_CMP:
+      case NUM2INT_BENCH_NUMERIC_EQ:
+      case NUM2INT_BENCH_INTEGRAL_CMP:
+      case NUM2INT_BENCH_NUMERIC_CALL:
+        if (strcmp(dist, "long_header") == 0) {
+          snprintf(buf, sizeof(buf), INT64_FORMAT ".%064d", v, 0);
+        } else if (strcmp(dist, "fraction") == 0) {
+          snprintf(buf, sizeof(buf), INT64_FORMAT ".5", v);
+        } else if (strcmp(dist, "huge") == 0) {
+          /* v * 10^20: beyond int64 unless v is zero */
+          snprintf(buf, sizeof(buf), INT64_FORMAT "00000000000000000000", v);
+        } else {
+          snprintf(buf, sizeof(buf), INT64_FORMAT, v);
+        }
+        nums[i] = benchNumeric(buf);
+        break;
+      case NUM2INT_BENCH_FLOAT4_CMP:
+      case NUM2INT_BENCH_FLOAT8_CMP:
+      case NUM2INT_BENCH_FLOAT8_CALL:
+        floats[i] = (float8) v;
+        if (strcmp(dist, "fraction") == 0)
+          floats[i] += 0.25;
+        if (bc->kind == NUM2INT_BENCH_FLOAT4_CMP)
+          floats[i] = (float8) (float4) floats[i];
+        break;
+      case NUM2INT_BENCH_INT8_CALL:
+        keys[i] = v;
+        break;
+      case NUM2INT_BENCH_HASH_NUMERIC:
+        break;
+    }
+  }
 }
 
-PG_FUNCTION_INFO_V1(hash_int4_as_float4_extended);
-Datum
-hash_int4_as_float4_extended(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  int64 seed = PG_GETARG_INT64(1);
-  float4 fval = (float4) ival;
-  return DirectFunctionCall2(hashfloat4extended, Float4GetDatum(fval), Int64GetDatum(seed));
+/**
+ * @brief Prepare the FmgrInfo of a *_call case
+ * @param bc Benchmark case
+ * @param flinfo Output: call information for FunctionCall2()
+ *
+ * Without a calling expression no operand is stable, so numeric_lt_int8
+ * takes the general path. numeric18_0 and constant set its call-site cache
+ * up as a numeric(18,0) operand or a constant comparand would.
+ */
+static void
+benchInitCall(const Num2IntBenchCase *bc, FmgrInfo *flinfo) {
+  memset(flinfo, 0, sizeof(FmgrInfo));
+  flinfo->fn_oid = InvalidOid;
+  flinfo->fn_nargs = 2;
+  flinfo->fn_strict = true;
+  flinfo->fn_mcxt = CurrentMemoryContext;
+
+  switch (bc->kind) {
+    case NUM2INT_BENCH_INT8_CALL:
+      flinfo->fn_addr = int8lt;
+      break;
+    case NUM2INT_BENCH_NUMERIC_CALL: {
+      Num2IntCmpCache *cache;
+
+      flinfo->fn_addr = numeric_lt_int8;
+      cache = createCmpCache(flinfo, 0);
+      if (strcmp(bc->distribution, "numeric18_0") == 0) {
+        cache->mode = NUM2INT_CMP_CACHE_INTEGRAL;
+      } else if (strcmp(bc->distribution, "constant") == 0) {
+        cache->mode = NUM2INT_CMP_CACHE_INEXACT;
+      }
+      break;
+    }
+    case NUM2INT_BENCH_FLOAT8_CALL:
+      flinfo->fn_addr = float8_lt_int8;
+      break;
+    default:
+      break;
+  }
 }
 
-PG_FUNCTION_INFO_V1(hash_int8_as_float4);
-Datum
-hash_int8_as_float4(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float4 fval = (float4) ival;
-  return DirectFunctionCall1(hashfloat4, Float4GetDatum(fval));
+/**
+ * @brief Run one kernel over the prepared operands
+ * @return Sum of the results, so the calls cannot be optimized away
+ */
+static uint64
+benchRunKernel(Num2IntBenchKernel kind, FmgrInfo *flinfo, Numeric *nums,
+               float8 *floats, int64 *keys, int64 *ints, int64 iterations) {
+  uint64 acc = 0;
+
+  for (int64 i = 0; i < iterations; i++) {
+    int j = (int) (i & (NUM2INT_BENCH_VALUES - 1));
+
+    if (j == 0)
+      CHECK_FOR_INTERRUPTS();
+
+    switch (kind) {
+      case NUM2INT_BENCH_NUMERIC_CMP:
+        acc += (uint64) numericCmpInt64Direct(nums[j], ints[j]);
+        break;
+      case NUM2INT_BENCH_NUMERIC_EQ:
+        acc += (uint64) numericEqInt64Direct(nums[j], ints[j]);
+        break;
+      case NUM2INT_BENCH_INTEGRAL_CMP:
+        acc += (uint64) integralNumericCmpInt64(nums[j], ints[j]);
+        break;
+      case NUM2INT_BENCH_FLOAT4_CMP:
+        acc += (uint64) float4_cmp_int8_internal((float4) floats[j], ints[j]);
+        break;
+      case NUM2INT_BENCH_FLOAT8_CMP:
+        acc += (uint64) float8_cmp_int8_internal(floats[j], ints[j]);
+        break;
+      case NUM2INT_BENCH_HASH_NUMERIC:
+        acc += DatumGetUInt32(hash_int64_as_numeric_internal(ints[j]));
+        break;
+      case NUM2INT_BENCH_INT8_CALL:
+        acc += (uint64) DatumGetBool(FunctionCall2(flinfo,
+                                                   Int64GetDatum(keys[j]),
+                                                   Int64GetDatum(ints[j])));
+        break;
+      case NUM2INT_BENCH_NUMERIC_CALL:
+        acc += (uint64) DatumGetBool(FunctionCall2(flinfo,
+                                                   NumericGetDatum(nums[j]),
+                                                   Int64GetDatum(ints[j])));
+        break;
+      case NUM2INT_BENCH_FLOAT8_CALL:
+        acc += (uint64) DatumGetBool(FunctionCall2(flinfo,
+                                                   Float8GetDatum(floats[j]),
+                                                   Int64GetDatum(ints[j])));
+        break;
+    }
+  }
+  return acc;
 }
 
-PG_FUNCTION_INFO_V1(hash_int8_as_float4_extended);
-Datum
-hash_int8_as_float4_extended(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  int64 seed = PG_GETARG_INT64(1);
-  float4 fval = (float4) ival;
-  return DirectFunctionCall2(hashfloat4extended, Float4GetDatum(fval), Int64GetDatum(seed));
-}
+/**
+ * @brief Time the internal comparison and hash kernels
+ * @param kernel Kernel name, or 'all'
+ * @param iterations Calls per distribution
+ * @return Set of (kernel_name, distribution, calls, ns_per_op, cycles_per_op)
+ *
+ * Each case is run once untimed over all prepared values to warm caches and
+ * branch predictors. cycles_per_op reads the time-stamp counter, which ticks
+ * at a constant reference rate rather than the core clock, and is NULL where
+ * no such counter is available.
+ */
+PG_FUNCTION_INFO_V1(num2int_bench);
+Datum
+num2int_bench(PG_FUNCTION_ARGS) {
+  char *kernel = text_to_cstring(PG_GETARG_TEXT_PP(0));
+  int64 iterations = PG_GETARG_INT64(1);
+  bool all = (strcmp(kernel, "all") == 0);
+  bool matched = false;
+  TupleDesc tupdesc;
+  Tuplestorestate *tupstore;
+  Numeric *nums;
+  float8 *floats;
+  int64 *keys;
+  int64 *ints;
+  volatile uint64 sink = 0;
+
+  if (iterations <= 0)
+    ereport(ERROR,
+            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+             errmsg("iterations must be positive")));
+
+  tupstore = beginMaterializedResult(fcinfo, &tupdesc);
+
+  nums = palloc(sizeof(Numeric) * NUM2INT_BENCH_VALUES);
+  floats = palloc(sizeof(float8) * NUM2INT_BENCH_VALUES);
+  keys = palloc(sizeof(int64) * NUM2INT_BENCH_VALUES);
+  ints = palloc(sizeof(int64) * NUM2INT_BENCH_VALUES);
+
+  for (int c = 0; c < (int) lengthof(benchCases); c++) {
+    const Num2IntBenchCase *bc = &benchCases[c];
+    FmgrInfo flinfo;
+    Datum values[5];
+    bool nulls[5] = {false, false, false, false, false};
+    instr_time start;
+    instr_time elapsed;
+#ifdef NUM2INT_HAVE_RDTSC
+    uint64 tscStart;
+    uint64 tscEnd;
+#endif
+
+    if (!all && strcmp(kernel, bc->kernel) != 0)
+      continue;
+    matched = true;
+
+    benchFillValues(bc, nums, floats, keys, ints);
+    benchInitCall(bc, &flinfo);
+    sink += benchRunKernel(bc->kind, &flinfo, nums, floats, keys, ints,
+                           NUM2INT_BENCH_VALUES);
+
+    INSTR_TIME_SET_CURRENT(start);
+#ifdef NUM2INT_HAVE_RDTSC
+    tscStart = __rdtsc();
+#endif
+    sink += benchRunKernel(bc->kind, &flinfo, nums, floats, keys, ints,
+                           iterations);
+#ifdef NUM2INT_HAVE_RDTSC
+    tscEnd = __rdtsc();
+#endif
+    INSTR_TIME_SET_CURRENT(elapsed);
+    INSTR_TIME_SUBTRACT(elapsed, start);
+
+    values[0] = CStringGetTextDatum(bc->kernel);
+    values[1] = CStringGetTextDatum(bc->distribution);
+    values[2] = Int64GetDatum(iterations);
+    values[3] = Float8GetDatum(INSTR_TIME_GET_DOUBLE(elapsed) * 1e9 /
+                               (double) iterations);
+#ifdef NUM2INT_HAVE_RDTSC
+    values[4] = Float8GetDatum((double) (tscEnd - tscStart) /
+                               (double) iterations);
+#else
+    values[4] = (Datum) 0;
+    nulls[4] = true;
+#endif
+    tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+
+    if (bc->kind == NUM2INT_BENCH_NUMERIC_CMP ||
+        bc->kind == NUM2INT_BENCH_NUMERIC_EQ ||
+        bc->kind == NUM2INT_BENCH_INTEGRAL_CMP ||
+        bc->kind == NUM2INT_BENCH_NUMERIC_CALL) {
+      for (int i = 0; i < NUM2INT_BENCH_VALUES; i++)
+        pfree(nums[i]);
+    }
+  }
 
-PG_FUNCTION_INFO_V1(hash_int2_as_float8);
-Datum
-hash_int2_as_float8(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  float8 fval = (float8) ival;
-  return DirectFunctionCall1(hashfloat8, Float8GetDatum(fval));
-}
+  if (!matched)
+    ereport(ERROR,
+            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+             errmsg("unknown kernel \"%s\"", kernel),
+             errhint("Valid kernels are numeric_cmp_int8, numeric_eq_int8, "
+                     "numeric18_0_cmp_int8, float4_cmp_int8, float8_cmp_int8, "
+                     "hash_int8_as_numeric, int8lt_call, "
+                     "numeric_lt_int8_call, float8_lt_int8_call and all.")));
 
-PG_FUNCTION_INFO_V1(hash_int2_as_float8_extended);
-Datum
-hash_int2_as_float8_extended(PG_FUNCTION_ARGS) {
-  int16 ival = PG_GETARG_INT16(0);
-  int64 seed = PG_GETARG_INT64(1);
-  float8 fval = (float8) ival;
-  return DirectFunctionCall2(hashfloat8extended, Float8GetDatum(fval), Int64GetDatum(seed));
-}
+  (void) sink;
+  pfree(nums);
+  pfree(floats);
+  pfree(keys);
+  pfree(ints);
 
-PG_FUNCTION_INFO_V1(hash_int4_as_float8);
-Datum
-hash_int4_as_float8(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  float8 fval = (float8) ival;
-  return DirectFunctionCall1(hashfloat8, Float8GetDatum(fval));
+  return (Datum) 0;
 }
 
-PG_FUNCTION_INFO_V1(hash_int4_as_float8_extended);
+/**
+ * @brief Report the instrumentation counters
+ * @return Set of (counter, backend_count, shared_count)
+ *
+ * shared_count is NULL unless the library was loaded through
+ * shared_preload_libraries. It includes this backend's counts of the current
+ * transaction, which are not flushed yet.
+ */
+PG_FUNCTION_INFO_V1(num2int_stats);
 Datum
-hash_int4_as_float8_extended(PG_FUNCTION_ARGS) {
-  int32 ival = PG_GETARG_INT32(0);
-  int64 seed = PG_GETARG_INT64(1);
-  float8 fval = (float8) ival;
-  return DirectFunctionCall2(hashfloat8extended, Float8GetDatum(fval), Int64GetDatum(seed));
-}
+num2int_stats(PG_FUNCTION_ARGS) {
+  TupleDesc tupdesc;
+  Tuplestorestate *tupstore = beginMaterializedResult(fcinfo, &tupdesc);
 
-PG_FUNCTION_INFO_V1(hash_int8_as_float8);
-Datum
-hash_int8_as_float8(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  float8 fval = (float8) ival;
-  return DirectFunctionCall1(hashfloat8, Float8GetDatum(fval));
-}
+  for (int i = 0; i < NUM2INT_STAT_COUNT; i++) {
+    Datum values[3];
+    bool nulls[3] = {false, false, false};
 
-PG_FUNCTION_INFO_V1(hash_int8_as_float8_extended);
-Datum
-hash_int8_as_float8_extended(PG_FUNCTION_ARGS) {
-  int64 ival = PG_GETARG_INT64(0);
-  int64 seed = PG_GETARG_INT64(1);
-  float8 fval = (float8) ival;
-  return DirectFunctionCall2(hashfloat8extended, Float8GetDatum(fval), Int64GetDatum(seed));
+    values[0] = CStringGetTextDatum(statNames[i]);
+    values[1] = Int64GetDatum((int64) localStats[i]);
+    if (sharedStats != NULL) {
+      values[2] = Int64GetDatum((int64) (pg_atomic_read_u64(&sharedStats->counters[i]) +
+                                         localStats[i] - flushedStats[i]));
+    } else {
+      values[2] = (Datum) 0;
+      nulls[2] = true;
+    }
+    tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+  }
+
+  return (Datum) 0;
 }
 
+/**
+ * @brief Reset this backend's counters and the shared totals
+ */
+PG_FUNCTION_INFO_V1(num2int_stats_reset);
+Datum
+num2int_stats_reset(PG_FUNCTION_ARGS) {
+  memset(localStats, 0, sizeof(localStats));
+  memset(flushedStats, 0, sizeof(flushedStats));
+  if (sharedStats != NULL) {
+    for (int i = 0; i < NUM2INT_STAT_COUNT; i++) {
+      pg_atomic_write_u64(&sharedStats->counters[i], 0);
+    }
+  }
+  PG_RETURN_VOID();
+}
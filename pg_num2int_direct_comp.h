@@ -115,6 +115,30 @@
 #define NUM2INT_INT8GE_OID  415   /* int8 >= int8 */
 #define NUM2INT_INT8NE_OID  411   /* int8 <> int8 */
 
+/* numeric comparison operators */
+#define NUM2INT_NUMERICEQ_OID  1752   /* numeric = numeric */
+#define NUM2INT_NUMERICLT_OID  1754   /* numeric < numeric */
+#define NUM2INT_NUMERICGT_OID  1756   /* numeric > numeric */
+#define NUM2INT_NUMERICLE_OID  1755   /* numeric <= numeric */
+#define NUM2INT_NUMERICGE_OID  1757   /* numeric >= numeric */
+#define NUM2INT_NUMERICNE_OID  1753   /* numeric <> numeric */
+
+/* float4 (real) comparison operators */
+#define NUM2INT_FLOAT4EQ_OID    620   /* float4 = float4 */
+#define NUM2INT_FLOAT4LT_OID    622   /* float4 < float4 */
+#define NUM2INT_FLOAT4GT_OID    623   /* float4 > float4 */
+#define NUM2INT_FLOAT4LE_OID    624   /* float4 <= float4 */
+#define NUM2INT_FLOAT4GE_OID    625   /* float4 >= float4 */
+#define NUM2INT_FLOAT4NE_OID    621   /* float4 <> float4 */
+
+/* float8 (double precision) comparison operators */
+#define NUM2INT_FLOAT8EQ_OID    670   /* float8 = float8 */
+#define NUM2INT_FLOAT8LT_OID    672   /* float8 < float8 */
+#define NUM2INT_FLOAT8GT_OID    674   /* float8 > float8 */
+#define NUM2INT_FLOAT8LE_OID    673   /* float8 <= float8 */
+#define NUM2INT_FLOAT8GE_OID    675   /* float8 >= float8 */
+#define NUM2INT_FLOAT8NE_OID    671   /* float8 <> float8 */
+
 /*
  * ============================================================================
  * Internal Numeric Format Definitions
@@ -273,6 +297,27 @@ typedef struct Num2IntNumericData {
 
 /* End of PostgreSQL built-in redefinitions */
 
+/**
+ * @brief A Numeric classified by a single read of its header and digits
+ *
+ * Filled in two steps: decodeNumericHeader() reads the header word once
+ * (special, sign, weight, digit array, integral), decodeNumericValue() then
+ * accumulates the integral digits into floorVal. Kernels that can decide on
+ * the sign or the integral flag alone skip the second step. Only special and
+ * isNaN are meaningful for NaN and infinities.
+ */
+typedef struct Num2IntNumericInfo {
+  int         special;      /**< 0 finite, 1 NaN or +Infinity, -1 -Infinity */
+  bool        isNaN;        /**< NaN (special is 1) */
+  int         sign;         /**< -1, 0 or 1 */
+  int         weight;       /**< Weight of the first base-10000 digit */
+  int         ndigits;      /**< Number of base-10000 digits */
+  const Num2IntNumericDigit *digits;  /**< Digit array, most significant first */
+  bool        isIntegral;   /**< No fractional digits */
+  bool        fitsInt64;    /**< floor(value) fits in int64 (value step) */
+  int64       floorVal;     /**< floor(value), exact when isIntegral */
+} Num2IntNumericInfo;
+
 /*
  * Operator type classification
  */
@@ -286,16 +331,76 @@ typedef enum {
   OP_TYPE_GE
 } OpType;
 
+/**
+ * @brief Runtime index key classification
+ *
+ * A comparison against a value only known at execution time is rewritten to
+ * "intExpr = key", "intExpr >= key" or "intExpr <= key" (see the
+ * <inexact>_<kind>_key_<int> SQL functions).
+ */
+typedef enum {
+  NUM2INT_KEY_EQ = 0,   /**< intExpr = key */
+  NUM2INT_KEY_LOWER,    /**< intExpr >= key */
+  NUM2INT_KEY_UPPER     /**< intExpr <= key */
+} Num2IntKeyKind;
+
+/** Number of runtime index key kinds */
+#define NUM2INT_KEY_KIND_COUNT 3
+
 /** Number of cross-type comparison operators (6 ops × 18 type combinations) */
 #define NUM2INT_OP_COUNT 108
 
+/** Extension name, as in pg_extension.extname */
+#define NUM2INT_EXTENSION_NAME "pg_num2int_direct_comp"
+
+/**
+ * Extension-owned table recording the OIDs of the extension's operators and
+ * runtime key functions, filled by the install script. Columns: name (text),
+ * lefttype, righttype, objid, funcid (oid).
+ */
+#define NUM2INT_OID_MAP_NAME "num2int_oid_map"
+#define NUM2INT_OID_MAP_NATTS 5
+
+/*
+ * Per-call comparison costs reported via SupportRequestCost, in multiples of
+ * cpu_operator_cost (the cost the planner assumes for int8lt and friends).
+ *
+ * These multiples are estimates, not server measurements. Each is meant to be
+ * the time of an operator wrapper called through fmgr divided by the time of
+ * int8lt called the same way, as the *_call cases of `make bench`
+ * (num2int_bench) report them. The values below come from a standalone build
+ * of the kernels with simplified stand-ins for fmgr and the wrappers (see
+ * doc/benchmark.md); replace them with `make bench` ratios from a real server.
+ * A numeric operand costs the same whether it is integral, wide or fractional,
+ * since decoding the header and the integral digits dominates; what changes
+ * the cost is the call-site cache. A constant is decoded once per call site,
+ * and a numeric(p,0) column (p <= 18) skips the sign and fraction checks.
+ */
+#define NUM2INT_COST_FLOAT_INT            1.6  /* estimate: float8_lt_int8_call */
+#define NUM2INT_COST_NUMERIC_INT_CONST    1.9  /* estimate: constant */
+#define NUM2INT_COST_NUMERIC_INT_INTEGRAL 2.8  /* estimate: numeric18_0 */
+#define NUM2INT_COST_NUMERIC_INT          3.4  /* estimate: others */
+
+/**
+ * Most integral digits of a numeric(p,s) typmod (s <= 0) whose values always
+ * fit int64: every value is below 10^18 < 2^63.
+ */
+#define NUM2INT_INTEGRAL_NUMERIC_MAX_DIGITS 18
+
+/** Slots in each operator hash index (power of two, load factor < 0.5) */
+#define NUM2INT_OP_HASH_SIZE 256
+
 /**
  * @brief Entry for operator lookup array
+ *
+ * The position of an entry in the array identifies the operator it caches
+ * (see operatorEntryIndex()), so entries can be re-resolved individually.
  */
 typedef struct {
-  Oid oid;       /**< Operator OID */
+  Oid oid;       /**< Operator OID, or InvalidOid if not (yet) resolved */
   Oid funcid;    /**< Implementing function OID */
   OpType type;   /**< Operator type classification */
+  uint32 hashValue;  /**< OPEROID syscache hash value of oid */
 } OperatorEntry;
 
 /**
@@ -304,10 +409,22 @@ typedef struct {
  * Stores OIDs for all 108 operators to enable fast lookup in the support
  * function. Cache is populated lazily on first use and persists for the
  * lifetime of the backend process.
+ *
+ * byFuncid and byOid are open-addressing hash indexes into ops (entry index
+ * + 1, 0 for an empty slot), giving O(1) lookups from the implementing
+ * function OID (SupportRequestSimplify) and the operator OID (selectivity
+ * estimation, planner hook). An OPEROID invalidation only unresolves the
+ * entries whose hash value matches; the next lookup re-resolves those
+ * entries and rebuilds the indexes.
  */
 typedef struct OperatorOidCache {
-  int count;        /**< Total number of operators in the cache */
+  bool valid;       /**< All entries resolved since the last invalidation */
+  int count;        /**< Number of operators found in the catalog */
   OperatorEntry ops[NUM2INT_OP_COUNT];  /**< Operator OID and type lookup array */
+  uint8 byFuncid[NUM2INT_OP_HASH_SIZE]; /**< funcid → ops index + 1 */
+  uint8 byOid[NUM2INT_OP_HASH_SIZE];    /**< operator OID → ops index + 1 */
+  /** Runtime key function OIDs [Num2IntKeyKind][inexact type][integer type] */
+  Oid keyFuncs[NUM2INT_KEY_KIND_COUNT][3][3];
 } OperatorOidCache;
 
 /**
@@ -371,6 +488,541 @@ extern bool num2int_numeric_is_integral(Numeric num);
  */
 extern bool numericToint64(Numeric num, int64 *result);
 
+/*
+ * ============================================================================
+ * Inlinable Comparison Kernels
+ * ============================================================================
+ * The numeric/float × integer comparison kernels are static inline so that
+ * they are compiled into every operator wrapper, including the LLVM bitcode
+ * PGXS installs for JIT inlining. PostgreSQL's JIT only inlines a function
+ * whose file-local dependencies are themselves inlinable and reference no
+ * mutable static variables, so everything below uses only constants, the
+ * Num2IntNumericInfo decoder and exported functions; rarely taken paths that
+ * need backend state (slow-path counters, cache setup) are exported functions
+ * in pg_num2int_direct_comp.c. Those are declared PGDLLEXPORT: since
+ * PostgreSQL 16, PGXS builds with -fvisibility=hidden, and inlined code
+ * calling a hidden symbol could not be linked by the JIT.
+ */
+
+/*
+ * Pre-computed float boundaries for integer range checks.
+ * These avoid runtime int-to-float conversions in hot paths.
+ * Note: float4 can exactly represent all int16 values and most int32 values,
+ * but int64 boundaries lose precision (which is fine for our range checks).
+ */
+static const float4 FLOAT4_INT16_MIN = (float4) PG_INT16_MIN;
+static const float4 FLOAT4_INT16_MAX = (float4) PG_INT16_MAX;
+static const float4 FLOAT4_INT32_MIN = (float4) PG_INT32_MIN;
+static const float4 FLOAT4_INT32_MAX = (float4) PG_INT32_MAX;
+
+static const float8 FLOAT8_INT16_MIN = (float8) PG_INT16_MIN;
+static const float8 FLOAT8_INT16_MAX = (float8) PG_INT16_MAX;
+static const float8 FLOAT8_INT32_MIN = (float8) PG_INT32_MIN;
+static const float8 FLOAT8_INT32_MAX = (float8) PG_INT32_MAX;
+static const float8 FLOAT8_INT64_MIN = (float8) PG_INT64_MIN;
+static const float8 FLOAT8_INT64_MAX = (float8) PG_INT64_MAX;
+
+/*
+ * (float) PG_INT64_MAX rounds up to 2^63, which is itself out of int64 range,
+ * so upper int64 checks must use ">=" against these values.
+ */
+static const float4 FLOAT4_INT64_MIN = (float4) PG_INT64_MIN;
+static const float4 FLOAT4_INT64_MAX = (float4) PG_INT64_MAX;
+
+/**
+ * @brief Count a numeric × integer comparison that left the integral fast path
+ * @param info Decoded numeric operand (fraction or beyond int64)
+ */
+extern PGDLLEXPORT void countNumericSlowPath(const Num2IntNumericInfo *info);
+
+/**
+ * @brief Classify a Numeric from a single read of its header word
+ * @param num Numeric value to inspect
+ * @param info Output: special, sign, weight, digits and integral flag
+ *
+ * The short format, used for every value PostgreSQL can pack into it (all
+ * values an integer comparison is likely to see), is tested first.
+ */
+static inline void
+decodeNumericHeader(Numeric num, Num2IntNumericInfo *info)
+{
+  const Num2IntNumericData *data = (const Num2IntNumericData *) num;
+  uint16 header = data->choice.n_header;
+  uint16 flagBits = header & NUM2INT_NUMERIC_SIGN_MASK;
+  bool negative;
+
+  if (flagBits == NUM2INT_NUMERIC_SHORT) {
+    info->digits = data->choice.n_short.n_data;
+    info->ndigits = (VARSIZE(num) - VARHDRSZ - sizeof(uint16)) /
+                    sizeof(Num2IntNumericDigit);
+    info->weight = (header & NUM2INT_NUMERIC_SHORT_WEIGHT_SIGN_MASK) ?
+      (~NUM2INT_NUMERIC_SHORT_WEIGHT_MASK |
+       (header & NUM2INT_NUMERIC_SHORT_WEIGHT_MASK)) :
+      (header & NUM2INT_NUMERIC_SHORT_WEIGHT_MASK);
+    negative = (header & NUM2INT_NUMERIC_SHORT_SIGN_MASK) != 0;
+  } else if (flagBits == NUM2INT_NUMERIC_SPECIAL) {
+    info->special = (header == NUM2INT_NUMERIC_NINF) ? -1 : 1;
+    info->isNaN = (header == NUM2INT_NUMERIC_NAN);
+    info->sign = info->special;
+    info->weight = 0;
+    info->ndigits = 0;
+    info->digits = NULL;
+    info->isIntegral = !info->isNaN;
+    info->fitsInt64 = false;
+    info->floorVal = 0;
+    return;
+  } else {
+    info->digits = data->choice.n_long.n_data;
+    info->ndigits = (VARSIZE(num) - VARHDRSZ - 2 * sizeof(uint16)) /
+                    sizeof(Num2IntNumericDigit);
+    info->weight = data->choice.n_long.n_weight;
+    negative = (flagBits == NUM2INT_NUMERIC_NEG);
+  }
+
+  info->special = 0;
+  info->isNaN = false;
+  info->sign = (info->ndigits == 0) ? 0 : (negative ? -1 : 1);
+  info->isIntegral = (info->ndigits == 0 ||
+                      info->ndigits <= info->weight + 1);
+}
+
+/**
+ * @brief Compute floor(value) of a finite Numeric decoded by decodeNumericHeader()
+ * @param info Decoded header; fitsInt64 and floorVal are filled in
+ *
+ * Only the digits left of the decimal point are read. A value of weight 4 is
+ * below 10^20, so after rejecting leading digits above 922 the magnitude is
+ * below 923 * 10^16 and accumulates in uint64 without overflow checks.
+ */
+static inline void
+decodeNumericValue(Num2IntNumericInfo *info)
+{
+  uint64 mag = 0;
+  int intDigits;
+  int i;
+
+  if (info->sign == 0) {
+    info->fitsInt64 = true;
+    info->floorVal = 0;
+    return;
+  }
+
+  if (info->weight < 0) {
+    /* Pure fraction: floor is 0 for positive, -1 for negative */
+    info->fitsInt64 = true;
+    info->floorVal = (info->sign > 0) ? 0 : -1;
+    return;
+  }
+
+  if (info->weight > 4 || (info->weight == 4 && info->digits[0] > 922)) {
+    info->fitsInt64 = false;
+    info->floorVal = 0;
+    return;
+  }
+
+  intDigits = Min(info->ndigits, info->weight + 1);
+  for (i = 0; i < intDigits; i++)
+    mag = mag * NUM2INT_NBASE + (uint64) info->digits[i];
+  for (; i <= info->weight; i++)
+    mag *= NUM2INT_NBASE;
+
+  if (info->sign > 0) {
+    info->fitsInt64 = (mag <= (uint64) PG_INT64_MAX);
+    info->floorVal = (int64) mag;
+  } else if (info->isIntegral) {
+    /* PG_INT64_MIN has magnitude one greater than PG_INT64_MAX */
+    info->fitsInt64 = (mag <= (uint64) PG_INT64_MAX + 1);
+    info->floorVal = (mag > (uint64) PG_INT64_MAX) ? PG_INT64_MIN : -(int64) mag;
+  } else {
+    /*
+     * floor(-100.5) = -101: one below the negated integral part. No overflow
+     * when mag <= PG_INT64_MAX.
+     */
+    info->fitsInt64 = (mag <= (uint64) PG_INT64_MAX);
+    info->floorVal = -(int64) mag - 1;
+  }
+}
+
+/*
+ * Core comparison functions (9 total)
+ *
+ * These functions implement the actual comparison logic, returning:
+ *   -1 if left < right
+ *    0 if left == right
+ *    1 if left > right
+ *
+ * Implementation converts integer to numeric/float and uses native comparison
+ * to avoid calling internal PostgreSQL functions that may not be exported.
+ */
+
+/**
+ * @brief Compare a decoded numeric with an int64 value
+ * @param info Numeric decoded by decodeNumericHeader() and decodeNumericValue()
+ * @param val int64 value (right operand)
+ * @return -1 if num < val, 0 if num == val, 1 if num > val
+ *
+ * A fractional value lies strictly above its floor, so a floor equal to val
+ * means the numeric is greater.
+ */
+static inline int
+cmpDecodedNumericInt64(const Num2IntNumericInfo *info, int64 val)
+{
+  /* NaN > everything for consistent ordering, +Inf > and -Inf < any integer */
+  if (info->special != 0)
+    return info->special;
+
+  /* Above PG_INT64_MAX or below PG_INT64_MIN: sign determines result */
+  if (!info->fitsInt64)
+    return info->sign;
+
+  if (info->floorVal < val)
+    return -1;
+  if (info->floorVal > val || !info->isIntegral)
+    return 1;
+  return 0;
+}
+
+/**
+ * @brief Compare numeric value with int64 value using direct structure access
+ * @param num Numeric value (left operand)
+ * @param val int64 value (right operand)
+ * @return -1 if num < val, 0 if num == val, 1 if num > val
+ *
+ * This optimized version avoids int64_to_numeric() and OidFunctionCall overhead
+ * by directly inspecting the Numeric structure. The header is decoded once;
+ * operands of different signs are decided before any digit is read. Values
+ * past the integral int64 fast path are counted by countNumericSlowPath().
+ */
+static inline int
+numericCmpInt64Direct(Numeric num, int64 val)
+{
+  Num2IntNumericInfo info;
+  int valSign;
+
+  decodeNumericHeader(num, &info);
+  if (info.special != 0)
+    return info.special;
+
+  /* Different signs - easy comparison */
+  valSign = (val > 0) ? 1 : ((val < 0) ? -1 : 0);
+  if (info.sign != valSign)
+    return (info.sign < valSign) ? -1 : 1;
+
+  /* Both zero */
+  if (info.sign == 0)
+    return 0;
+
+  decodeNumericValue(&info);
+  if (unlikely(!info.fitsInt64 || !info.isIntegral)) {
+    countNumericSlowPath(&info);
+  }
+  return cmpDecodedNumericInt64(&info, val);
+}
+
+/**
+ * @brief Check equality of numeric with int64 - optimized for early-out
+ * @param num Numeric value
+ * @param val int64 value
+ * @return true if num == val exactly, false otherwise
+ *
+ * Optimized equality check that avoids floor extraction for non-equal cases:
+ * - NaN/Inf: immediately false (never equal to integers)
+ * - Different signs: immediately false
+ * - Fractional values: immediately false (can't equal an integer)
+ * - Out-of-range: false (floor does not fit in int64)
+ */
+static inline bool
+numericEqInt64Direct(Numeric num, int64 val) {
+  Num2IntNumericInfo info;
+  int valSign;
+
+  decodeNumericHeader(num, &info);
+
+  // NaN/Inf never equal integers, fractions never equal integers
+  if (info.special != 0 || !info.isIntegral)
+    return false;
+
+  // Sign check - different signs can't be equal
+  valSign = (val > 0) ? 1 : ((val < 0) ? -1 : 0);
+  if (info.sign != valSign)
+    return false;
+
+  // Both zero
+  if (info.sign == 0)
+    return true;
+
+  decodeNumericValue(&info);
+  return info.fitsInt64 && info.floorVal == val;
+}
+
+/**
+ * @brief Compare numeric value with int2 value
+ * @param num Numeric value (left operand)
+ * @param val int2 value (right operand)
+ * @return -1 if num < val, 0 if num == val, 1 if num > val
+ */
+static inline int
+numeric_cmp_int2_internal(Numeric num, int16 val) {
+  return numericCmpInt64Direct(num, (int64)val);
+}
+
+/**
+ * @brief Compare numeric value with int4 value
+ * @param num Numeric value (left operand)
+ * @param val int4 value (right operand)
+ * @return -1 if num < val, 0 if num == val, 1 if num > val
+ */
+static inline int
+numeric_cmp_int4_internal(Numeric num, int32 val) {
+  return numericCmpInt64Direct(num, (int64)val);
+}
+
+/**
+ * @brief Compare numeric value with int8 value
+ */
+static inline int
+numeric_cmp_int8_internal(Numeric num, int64 val) {
+  return numericCmpInt64Direct(num, val);
+}
+
+/**
+ * @brief Compare float4 value with int2 value
+ */
+static inline int
+float4_cmp_int2_internal(float4 fval, int16 ival) {
+  float4 ivalAsFloat4;
+
+  /* Handle NaN - NaN never equals anything */
+  if (isnan(fval)) {
+    return 1;  /* Treat NaN as greater for consistent ordering */
+  }
+
+  /* Handle infinity */
+  if (isinf(fval)) {
+    return (fval > 0) ? 1 : -1;
+  }
+
+  /* Convert integer to float4 and compare */
+  ivalAsFloat4 = (float4)ival;
+
+  /* Check if representation lost precision */
+  if ((int16)ivalAsFloat4 != ival) {
+    /* This shouldn't happen for int2 values, but handle it */
+    return (fval < ival) ? -1 : 1;
+  }
+
+  if (fval < ivalAsFloat4) return -1;
+  if (fval > ivalAsFloat4) return 1;
+  return 0;
+}
+
+/**
+ * @brief Compare float4 value with int4 value
+ */
+static inline int
+float4_cmp_int4_internal(float4 fval, int32 ival) {
+  float4 ivalAsFloat4;
+
+  if (isnan(fval)) return 1;
+  if (isinf(fval)) return (fval > 0) ? 1 : -1;
+
+  ivalAsFloat4 = (float4)ival;
+
+  /* Check if integer exceeds float4 precision (>2^24) */
+  if (ival > 16777216 || ival < -16777216) {
+    /*
+     * Check if round-trip conversion preserves value. (float4) PG_INT32_MAX
+     * rounds up to 2^31, which must not be cast back to int32.
+     */
+    if (ivalAsFloat4 >= FLOAT4_INT32_MAX || (int32)ivalAsFloat4 != ival) {
+      /* Precision lost - can't be equal */
+      /* Compare based on which direction the rounding went */
+      if (fval < ivalAsFloat4) return -1;
+      if (fval > ivalAsFloat4) return 1;
+      /*
+       * fval == ivalAsFloat4 but ivalAsFloat4 != ival. Compare in integer
+       * arithmetic: "ivalAsFloat4 < ival" would round ival to float4 again.
+       */
+      if (ivalAsFloat4 >= FLOAT4_INT32_MAX) return 1;
+      return ((int32)ivalAsFloat4 < ival) ? -1 : 1;
+    }
+  }
+
+  if (fval < ivalAsFloat4) return -1;
+  if (fval > ivalAsFloat4) return 1;
+  return 0;
+}
+
+/**
+ * @brief Compare float4 value with int8 value
+ */
+static inline int
+float4_cmp_int8_internal(float4 fval, int64 ival) {
+  float4 ivalAsFloat4;
+
+  if (isnan(fval)) return 1;
+  if (isinf(fval)) return (fval > 0) ? 1 : -1;
+
+  ivalAsFloat4 = (float4)ival;
+
+  /* Check if integer exceeds float4 precision (see float4_cmp_int4_internal) */
+  if (ival > 16777216LL || ival < -16777216LL) {
+    if (ivalAsFloat4 >= FLOAT4_INT64_MAX || (int64)ivalAsFloat4 != ival) {
+      if (fval < ivalAsFloat4) return -1;
+      if (fval > ivalAsFloat4) return 1;
+      if (ivalAsFloat4 >= FLOAT4_INT64_MAX) return 1;
+      return ((int64)ivalAsFloat4 < ival) ? -1 : 1;
+    }
+  }
+
+  if (fval < ivalAsFloat4) return -1;
+  if (fval > ivalAsFloat4) return 1;
+  return 0;
+}
+
+/**
+ * @brief Compare float8 value with int2 value
+ */
+static inline int
+float8_cmp_int2_internal(float8 fval, int16 ival) {
+  float8 ivalAsFloat8;
+
+  if (isnan(fval)) return 1;
+  if (isinf(fval)) return (fval > 0) ? 1 : -1;
+
+  ivalAsFloat8 = (float8)ival;
+
+  if (fval < ivalAsFloat8) return -1;
+  if (fval > ivalAsFloat8) return 1;
+  return 0;
+}
+
+/**
+ * @brief Compare float8 value with int4 value
+ */
+static inline int
+float8_cmp_int4_internal(float8 fval, int32 ival) {
+  float8 ivalAsFloat8;
+
+  if (isnan(fval)) return 1;
+  if (isinf(fval)) return (fval > 0) ? 1 : -1;
+
+  ivalAsFloat8 = (float8)ival;
+
+  if (fval < ivalAsFloat8) return -1;
+  if (fval > ivalAsFloat8) return 1;
+  return 0;
+}
+
+/**
+ * @brief Compare float8 value with int8 value
+ */
+static inline int
+float8_cmp_int8_internal(float8 fval, int64 ival) {
+  float8 ivalAsFloat8;
+  float8 fvalRounded;
+
+  if (isnan(fval)) return 1;
+  if (isinf(fval)) return (fval > 0) ? 1 : -1;
+
+  /* Check if float has fractional part - never equals integer */
+  fvalRounded = trunc(fval);
+  if (fval != fvalRounded) {
+    return (fval < ival) ? -1 : 1;
+  }
+
+  ivalAsFloat8 = (float8)ival;
+
+  /* float8 has 53-bit mantissa, check precision beyond 2^53 */
+  if (ival > 9007199254740992LL || ival < -9007199254740992LL) {
+    /* Integer is beyond exact float8 representation */
+    if (ivalAsFloat8 >= FLOAT8_INT64_MAX || (int64)ivalAsFloat8 != ival) {
+      /* Integer cannot be exactly represented as float8 */
+      /* For equality, this means they can never be equal */
+      if (fval < ivalAsFloat8) return -1;
+      if (fval > ivalAsFloat8) return 1;
+      /* fval == ivalAsFloat8, but ivalAsFloat8 != ival due to rounding */
+      /* Therefore fval != ival (precision loss detected) */
+      if (ivalAsFloat8 >= FLOAT8_INT64_MAX) return 1;
+      return ((int64)ivalAsFloat8 < ival) ? -1 : 1;
+    }
+  }
+
+  if (fval < ivalAsFloat8) return -1;
+  if (fval > ivalAsFloat8) return 1;
+  return 0;
+}
+
+/*
+ * Per-call-site comparison cache (fn_extra of the operator wrappers). The
+ * lookups are inline in the wrappers; filling the cache is done by exported
+ * (PGDLLEXPORT) functions, which the JIT calls instead of inlining.
+ */
+
+/**
+ * @brief Which operand of a cross-type comparison is cached
+ */
+typedef enum {
+  NUM2INT_CMP_CACHE_NONE = 0,   /**< Neither operand is stable */
+  NUM2INT_CMP_CACHE_INEXACT,    /**< numeric/float operand is stable */
+  NUM2INT_CMP_CACHE_INT,        /**< Integer operand is stable */
+  NUM2INT_CMP_CACHE_INTEGRAL    /**< numeric operand is integral by typmod */
+} Num2IntCmpCacheMode;
+
+/**
+ * @brief Cached decoding of the stable operand, stored in fn_extra
+ */
+typedef struct {
+  Num2IntCmpCacheMode mode;  /**< Which operand is cached */
+  bool valid;                /**< Fields below describe the cached operand */
+
+  /* NUM2INT_CMP_CACHE_INEXACT */
+  Numeric numKey;        /**< Copy of the numeric operand (in fn_mcxt) */
+  float8 floatKey;       /**< float4/float8 operand */
+  int fixedCmp;          /**< Result against every integer (NaN, Inf, out of
+                              int64 range), or 0 if the floor decides */
+  int64 floorVal;        /**< floor(operand) */
+  bool hasFraction;      /**< operand != floorVal */
+
+  /* NUM2INT_CMP_CACHE_INT */
+  int64 intKey;          /**< Integer operand */
+  int intSign;           /**< Sign of intKey: -1, 0, 1 */
+  int intWeight;         /**< Weight of |intKey| in base NBASE */
+  int intNdigits;        /**< Digits of |intKey|, trailing zeros stripped */
+  Num2IntNumericDigit intDigits[5];  /**< |intKey| in base NBASE */
+  float8 intAsFloat;     /**< intKey rounded to the float operand type */
+  bool intFloatExact;    /**< intAsFloat == intKey exactly */
+  bool intFloatBelow;    /**< intAsFloat < intKey (only when not exact) */
+} Num2IntCmpCache;
+
+/**
+ * @brief Create the comparison cache of a call site on its first call
+ * @param flinfo FmgrInfo of an operator wrapper
+ * @param inexactArg Argument number of the numeric/float operand (0 or 1)
+ * @return New cache, stored in fn_extra
+ */
+extern PGDLLEXPORT Num2IntCmpCache *createCmpCache(FmgrInfo *flinfo,
+                                                  int inexactArg);
+
+/**
+ * @brief Decode a stable numeric/float operand into floor and fraction
+ */
+extern PGDLLEXPORT void cacheInexactOperand(Num2IntCmpCache *cache,
+                                            Datum value, Oid valueType);
+
+/**
+ * @brief Copy a stable numeric operand into the cache and decode it
+ */
+extern PGDLLEXPORT void cacheNumericOperand(FmgrInfo *flinfo,
+                                            Num2IntCmpCache *cache,
+                                            Numeric num);
+
+/**
+ * @brief Decode a stable integer operand for float or numeric comparisons
+ */
+extern PGDLLEXPORT void cacheIntOperand(Num2IntCmpCache *cache, int64 ival,
+                                        Oid floatType);
+
 /* Function declarations */
 
 /**
@@ -378,7 +1030,8 @@ extern bool numericToint64(Numeric num, int64 *result);
  *
  * Populates the cache with OIDs for all 108 operators by looking up operator
  * names in the system catalog. Called lazily on first invocation of the
- * support function.
+ * support function, and after an invalidation to re-resolve only the
+ * entries it dropped.
  *
  * @param cache Pointer to the cache structure to initialize
  */
@@ -395,16 +1048,27 @@ extern void initOidCache(OperatorOidCache *cache);
  */
 extern Datum num2int_support(PG_FUNCTION_ARGS);
 
-/* Core comparison functions - return -1, 0, or 1 */
-extern int numeric_cmp_int2_internal(Numeric num, int16 val);
-extern int numeric_cmp_int4_internal(Numeric num, int32 val);
-extern int numeric_cmp_int8_internal(Numeric num, int64 val);
-extern int float4_cmp_int2_internal(float4 fval, int16 ival);
-extern int float4_cmp_int4_internal(float4 fval, int32 ival);
-extern int float4_cmp_int8_internal(float4 fval, int64 ival);
-extern int float8_cmp_int2_internal(float8 fval, int16 ival);
-extern int float8_cmp_int4_internal(float8 fval, int32 ival);
-extern int float8_cmp_int8_internal(float8 fval, int64 ival);
+/**
+ * @brief Restriction selectivity estimator for cross-type comparison operators
+ * @param fcinfo Function call information (root, operator, args, varRelid)
+ * @return float8 selectivity estimate
+ *
+ * Estimates integer-column-versus-constant predicates against the integer
+ * column's own statistics after mapping the constant into the integer domain.
+ * Falls back to the standard eqsel/neqsel/scalar*sel estimators otherwise.
+ */
+extern Datum num2int_restrictsel(PG_FUNCTION_ARGS);
+
+/**
+ * @brief Join selectivity estimator for the cross-type equality operators
+ * @param fcinfo Function call information (root, operator, args, jointype,
+ *        sjinfo)
+ * @return float8 selectivity estimate
+ *
+ * Computes eqjoinsel's estimate, matching the MCV lists by exact int64 value
+ * with a sort and merge instead of calling the operator for every pair.
+ */
+extern Datum num2int_eqjoinsel(PG_FUNCTION_ARGS);
 
 /* Equality operator functions (=) */
 extern Datum numeric_eq_int2(PG_FUNCTION_ARGS);
@@ -500,4 +1164,40 @@ extern Datum float8_ge_int2(PG_FUNCTION_ARGS);
 extern Datum float8_ge_int4(PG_FUNCTION_ARGS);
 extern Datum float8_ge_int8(PG_FUNCTION_ARGS);
 
+/* Runtime index key functions (inexact value → integer key or NULL) */
+extern Datum numeric_eq_key_int2(PG_FUNCTION_ARGS);
+extern Datum numeric_eq_key_int4(PG_FUNCTION_ARGS);
+extern Datum numeric_eq_key_int8(PG_FUNCTION_ARGS);
+extern Datum numeric_lower_key_int2(PG_FUNCTION_ARGS);
+extern Datum numeric_lower_key_int4(PG_FUNCTION_ARGS);
+extern Datum numeric_lower_key_int8(PG_FUNCTION_ARGS);
+extern Datum numeric_upper_key_int2(PG_FUNCTION_ARGS);
+extern Datum numeric_upper_key_int4(PG_FUNCTION_ARGS);
+extern Datum numeric_upper_key_int8(PG_FUNCTION_ARGS);
+extern Datum float4_eq_key_int2(PG_FUNCTION_ARGS);
+extern Datum float4_eq_key_int4(PG_FUNCTION_ARGS);
+extern Datum float4_eq_key_int8(PG_FUNCTION_ARGS);
+extern Datum float4_lower_key_int2(PG_FUNCTION_ARGS);
+extern Datum float4_lower_key_int4(PG_FUNCTION_ARGS);
+extern Datum float4_lower_key_int8(PG_FUNCTION_ARGS);
+extern Datum float4_upper_key_int2(PG_FUNCTION_ARGS);
+extern Datum float4_upper_key_int4(PG_FUNCTION_ARGS);
+extern Datum float4_upper_key_int8(PG_FUNCTION_ARGS);
+extern Datum float8_eq_key_int2(PG_FUNCTION_ARGS);
+extern Datum float8_eq_key_int4(PG_FUNCTION_ARGS);
+extern Datum float8_eq_key_int8(PG_FUNCTION_ARGS);
+extern Datum float8_lower_key_int2(PG_FUNCTION_ARGS);
+extern Datum float8_lower_key_int4(PG_FUNCTION_ARGS);
+extern Datum float8_lower_key_int8(PG_FUNCTION_ARGS);
+extern Datum float8_upper_key_int2(PG_FUNCTION_ARGS);
+extern Datum float8_upper_key_int4(PG_FUNCTION_ARGS);
+extern Datum float8_upper_key_int8(PG_FUNCTION_ARGS);
+
+/* Kernel microbenchmark */
+extern Datum num2int_bench(PG_FUNCTION_ARGS);
+
+/* Instrumentation counters */
+extern Datum num2int_stats(PG_FUNCTION_ARGS);
+extern Datum num2int_stats_reset(PG_FUNCTION_ARGS);
+
 #endif /* PG_NUM2INT_DIRECT_COMP_H */
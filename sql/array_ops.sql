@@ -0,0 +1,115 @@
+-- Test num2int_array_overlap/contains/contained(int[], numeric/float[]):
+-- exact &&, @> and <@ between integer and inexact arrays, and the rewrite of
+-- constant arrays to the built-in operators so GIN array_ops indexes apply
+
+-- Load extension
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+-- ============================================================================
+-- Setup
+-- ============================================================================
+CREATE TABLE ao_pairs (id int, i4 int4[], n numeric[]);
+INSERT INTO ao_pairs VALUES
+  (1, '{1,2,3}', '{1.0,2.0}'),
+  (2, '{1,2,3}', '{1.5,2}'),
+  (3, '{1,2}', '{1,2,3}'),
+  (4, '{}', '{1}'),
+  (5, '{1}', '{}'),
+  (6, '{1,NULL}', '{1}'),
+  (7, '{1}', '{1,NULL}'),
+  (8, '{2147483647}', '{2147483647,2147483648}'),
+  (9, '{1,1,2}', '{2,2.0,1}'),
+  (10, '{5}', '{NaN,5}'),
+  (11, '{-3}', '{-3.0000}'),
+  (12, NULL, '{1}'),
+  (13, '{}', '{}'),
+  (14, '{NULL}', '{NULL}'),
+  (15, '{7,8}', '{8.5,7}');
+
+CREATE TABLE ao_tags (id int, tags int4[]);
+INSERT INTO ao_tags SELECT i, ARRAY[i % 10, 10 + i % 7] FROM generate_series(1, 1000) i;
+CREATE INDEX ao_tags_gin ON ao_tags USING gin (tags);
+ANALYZE ao_tags;
+
+-- ============================================================================
+-- Test 1: Results per pair
+-- Fractions, NaN and values beyond the integer type equal no integer
+-- ============================================================================
+SELECT id, i4, n,
+       num2int_array_overlap(i4, n) AS overlap,
+       num2int_array_contains(i4, n) AS contains,
+       num2int_array_contained(i4, n) AS contained
+FROM ao_pairs
+ORDER BY id;
+
+-- ============================================================================
+-- Test 2: Agreement with the built-in operators on i4::numeric[]
+-- Every integer is exact in numeric, so the casted form is the reference
+-- ============================================================================
+SELECT count(*) FILTER (WHERE num2int_array_overlap(i4, n) IS DISTINCT FROM (i4::numeric[] && n)) AS overlap_diff,
+       count(*) FILTER (WHERE num2int_array_contains(i4, n) IS DISTINCT FROM (i4::numeric[] @> n)) AS contains_diff,
+       count(*) FILTER (WHERE num2int_array_contained(i4, n) IS DISTINCT FROM (i4::numeric[] <@ n)) AS contained_diff,
+       count(*) FILTER (WHERE num2int_array_overlap(n, i4) IS DISTINCT FROM (n && i4::numeric[])) AS rev_overlap_diff,
+       count(*) FILTER (WHERE num2int_array_contains(n, i4) IS DISTINCT FROM (n @> i4::numeric[])) AS rev_contains_diff,
+       count(*) FILTER (WHERE num2int_array_contained(n, i4) IS DISTINCT FROM (n <@ i4::numeric[])) AS rev_contained_diff
+FROM ao_pairs;
+
+-- ============================================================================
+-- Test 3: Float and narrow integer arrays
+-- A cast to float8[] or int2 range would make unequal values equal
+-- ============================================================================
+SELECT num2int_array_overlap('{9007199254740993}'::int8[], '{9007199254740992}'::float8[]) AS exact,
+       '{9007199254740993}'::int8[]::float8[] && '{9007199254740992}'::float8[] AS via_cast;
+SELECT num2int_array_contains('{1,2,16777217}'::int4[], '{1,2.0}'::float4[]) AS contains,
+       num2int_array_contained('{16777217}'::int4[], '{16777216}'::float4[]) AS contained;
+SELECT num2int_array_overlap('{1}'::int2[], '{40000,1}'::numeric[]) AS overlap,
+       num2int_array_contains('{1}'::int2[], '{40000,1}'::numeric[]) AS contains,
+       num2int_array_contained('{1}'::int2[], '{40000,1}'::numeric[]) AS contained;
+
+-- ============================================================================
+-- Test 4: Constant arrays use the GIN index on the integer array column
+-- ============================================================================
+SET enable_seqscan = off;
+EXPLAIN (COSTS OFF)
+SELECT count(*) FROM ao_tags WHERE num2int_array_overlap(tags, '{1.0,2.5,3}'::numeric[]);
+SELECT count(*) FROM ao_tags WHERE num2int_array_overlap(tags, '{1.0,2.5,3}'::numeric[]);
+EXPLAIN (COSTS OFF)
+SELECT count(*) FROM ao_tags WHERE num2int_array_contains(tags, '{1,11.0}'::numeric[]);
+SELECT count(*) FROM ao_tags WHERE num2int_array_contains(tags, '{1,11.0}'::numeric[]);
+EXPLAIN (COSTS OFF)
+SELECT count(*) FROM ao_tags WHERE num2int_array_contained(tags, '{1,2,11,12,13.5}'::float8[]);
+SELECT count(*) FROM ao_tags WHERE num2int_array_contained(tags, '{1,2,11,12,13.5}'::float8[]);
+
+-- Constant on the left
+EXPLAIN (COSTS OFF)
+SELECT count(*) FROM ao_tags WHERE num2int_array_overlap('{1.0,2.5,3}'::numeric[], tags);
+
+-- An element that must be found but equals no integer makes the result FALSE
+EXPLAIN (COSTS OFF)
+SELECT count(*) FROM ao_tags WHERE num2int_array_contains(tags, '{1,2.5}'::numeric[]);
+SELECT count(*) FROM ao_tags WHERE num2int_array_contains(tags, '{1,2.5}'::numeric[]);
+RESET enable_seqscan;
+
+-- ============================================================================
+-- Test 5: Inexact array columns compare against converted integer constants
+-- Integers a float8 cannot hold are dropped from &&
+-- ============================================================================
+CREATE TABLE ao_amounts (n numeric[], f float8[]);
+EXPLAIN (COSTS OFF)
+SELECT * FROM ao_amounts
+WHERE num2int_array_overlap(n, '{1,9007199254740993}'::int8[])
+  AND num2int_array_overlap(f, '{1,9007199254740993}'::int8[]);
+
+-- With support functions disabled the call is kept
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+EXPLAIN (COSTS OFF)
+SELECT count(*) FROM ao_tags WHERE num2int_array_overlap(tags, '{1.0,2.5,3}'::numeric[]);
+SELECT count(*) FROM ao_tags WHERE num2int_array_overlap(tags, '{1.0,2.5,3}'::numeric[]);
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+
+-- ============================================================================
+-- Cleanup
+-- ============================================================================
+DROP TABLE ao_pairs;
+DROP TABLE ao_tags;
+DROP TABLE ao_amounts;
@@ -7,6 +7,7 @@
 -- 3. Cross-type SARG range scans
 -- 4. Join strategies: Hash, Merge, Indexed Nested Loop
 -- 5. Stock PostgreSQL comparison (using explicit casts)
+-- 6. numeric(p,0) typmod fast path vs the general numeric path
 --
 -- Stability techniques used:
 -- - Disable parallel workers to eliminate coordination jitter
@@ -14,13 +15,13 @@
 -- - Warmup queries before timed runs
 -- - Multiple runs per test for stability verification
 --
--- NOTE: This is a long-running benchmark (~70 seconds) and is NOT included
--- in the default regression suite. To run manually:
---   make installcheck REGRESS=benchmark
+-- NOTE: This is a long-running benchmark (~70 seconds) with no expected
+-- output; its timings differ on every run. Run it with psql against a
+-- database where the extension is installed:
+--   psql -d your_database -f sql/benchmark.sql
 --
 -- For quick performance validation, use sql/performance.sql instead.
 
--- pg_regress loads the extension automatically via regression_setup
 \pset pager off
 
 --------------------------------------------------------------------------------
@@ -247,32 +248,22 @@ RESET enable_hashjoin;
 -- Test 5: Merge Joins (Extension vs Stock) - int × numeric only
 -- Run 3 times each for stability (take median)
 --
--- NOTE: We use enable_seqscan = off to force both plans to use the numeric
--- index (idx_numeric_table_int_ref). Without this, PostgreSQL's cost model
--- picks different plan shapes:
---   - Extension: Index Scan int_table_pkey + Sort numeric_table
---   - Stock: Index Scan idx_numeric_table_int_ref + Sort int_table::numeric
---
--- The planner's cost model treats all comparison functions equally
--- (cpu_operator_cost = 0.0025), so it doesn't know that sorting int4 values
--- is ~4x faster than sorting numeric values. This causes it to prefer the
--- slower plan when using the extension.
---
--- By forcing both queries to use the numeric index, we get identical plan
--- shapes and a fair apples-to-apples comparison of the join execution itself.
+-- Scans are not forced: the plans are the ones the planner picks with the
+-- SupportRequestCost multiples of the cross-type operators. Sort costs still
+-- treat all comparison functions equally (cpu_operator_cost per comparison),
+-- so the extension and stock queries may sort different sides; compare the
+-- plan shapes along with the times.
 --------------------------------------------------------------------------------
 
 \echo ''
 \echo '================================================================================'
 \echo '=== TEST 5: Merge Joins (int4 = numeric) - 3 runs each ==='
-\echo '=== (enable_seqscan=off forces optimal plan for fair comparison) ==='
 \echo '================================================================================'
 
--- Force merge join with optimal plan
+-- Force merge join
 SET enable_hashjoin = off;
 SET enable_nestloop = off;
 SET enable_mergejoin = on;
-SET enable_seqscan = off;  -- Force use of idx_numeric_table_int_ref
 
 -- Warmup runs (not timed in output)
 SELECT COUNT(*) FROM int_table i JOIN numeric_table n ON i.id = n.int_ref;
@@ -305,7 +296,6 @@ SELECT COUNT(*) FROM int_table i JOIN numeric_table n ON i.id::numeric = n.int_r
 RESET enable_hashjoin;
 RESET enable_nestloop;
 RESET enable_mergejoin;
-RESET enable_seqscan;
 
 --------------------------------------------------------------------------------
 -- Test 6: Indexed Nested Loop Joins (Extension vs Stock)
@@ -341,12 +331,12 @@ RESET enable_mergejoin;
 RESET enable_nestloop;
 
 --------------------------------------------------------------------------------
--- Test 7: Float joins (Hash only, no Merge)
+-- Test 7: Float joins (Hash and Merge)
 --------------------------------------------------------------------------------
 
 \echo ''
 \echo '================================================================================'
-\echo '=== TEST 7: Float Joins (Hash and Nested Loop only, no Merge) ==='
+\echo '=== TEST 7: Float Joins (Hash and Merge) ==='
 \echo '================================================================================'
 
 SET enable_mergejoin = off;
@@ -363,6 +353,29 @@ SELECT COUNT(*) FROM int_table i JOIN float_table f ON i.id::float8 = f.int_ref;
 
 RESET enable_mergejoin;
 
+-- With a small work_mem the hash table is expected not to fit, so the hash
+-- join runs in several batches (see Batches in 7c); both join inputs are
+-- ordered by their btree indexes, so the merge join should need no Sort (7d)
+SET work_mem = '4MB';
+
+\echo ''
+\echo '--- 7c. WITH EXTENSION, work_mem = 4MB: Hash Join (multi-batch) ---'
+SET enable_mergejoin = off;
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF)
+SELECT COUNT(*) FROM int_table i JOIN float_table f ON i.id = f.int_ref;
+RESET enable_mergejoin;
+
+\echo ''
+\echo '--- 7d. WITH EXTENSION, work_mem = 4MB: Merge Join over both indexes ---'
+SET enable_hashjoin = off;
+SET enable_nestloop = off;
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF)
+SELECT COUNT(*) FROM int_table i JOIN float_table f ON i.id = f.int_ref;
+RESET enable_hashjoin;
+RESET enable_nestloop;
+
+SET work_mem = '256MB';
+
 --------------------------------------------------------------------------------
 -- Test 8: Planner choice (let planner pick best strategy)
 --------------------------------------------------------------------------------
@@ -382,6 +395,59 @@ SELECT COUNT(*) FROM int_table i JOIN numeric_table n ON i.id = n.int_ref;
 EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF) 
 SELECT COUNT(*) FROM int_table i JOIN numeric_table n ON i.id::numeric = n.int_ref;
 
+--------------------------------------------------------------------------------
+-- Test 9: numeric(18,0) typmod fast path vs general numeric path
+--------------------------------------------------------------------------------
+
+\echo ''
+\echo '================================================================================'
+\echo '=== TEST 9: numeric(18,0) vs numeric compared with int8 (column vs column) ==='
+\echo '================================================================================'
+
+CREATE TABLE typmod_table (
+  n18 numeric(18,0),
+  n numeric,
+  i8 int8
+);
+INSERT INTO typmod_table
+SELECT i * 1000003, i * 1000003, CASE WHEN i % 2 = 0 THEN i * 1000003 ELSE i END
+FROM generate_series(1, 1000000) i;
+VACUUM ANALYZE typmod_table;
+SELECT COUNT(*) FROM typmod_table;  -- warmup
+
+\echo ''
+\echo '--- 9a. TYPMOD FAST PATH: n18 = i8 (numeric(18,0) converted straight to int64) ---'
+\echo '--- Run 1 ---'
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF)
+SELECT COUNT(*) FROM typmod_table WHERE n18 = i8;
+\echo '--- Run 2 ---'
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF)
+SELECT COUNT(*) FROM typmod_table WHERE n18 = i8;
+\echo '--- Run 3 ---'
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF)
+SELECT COUNT(*) FROM typmod_table WHERE n18 = i8;
+
+\echo ''
+\echo '--- 9b. GENERAL PATH: n = i8 (unconstrained numeric) ---'
+\echo '--- Run 1 ---'
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF)
+SELECT COUNT(*) FROM typmod_table WHERE n = i8;
+\echo '--- Run 2 ---'
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF)
+SELECT COUNT(*) FROM typmod_table WHERE n = i8;
+\echo '--- Run 3 ---'
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF)
+SELECT COUNT(*) FROM typmod_table WHERE n = i8;
+
+\echo ''
+\echo '--- 9c. Range comparisons: n18 < i8 vs n < i8 ---'
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF)
+SELECT COUNT(*) FROM typmod_table WHERE n18 < i8;
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF)
+SELECT COUNT(*) FROM typmod_table WHERE n < i8;
+
+DROP TABLE typmod_table;
+
 --------------------------------------------------------------------------------
 -- Summary
 --------------------------------------------------------------------------------
@@ -400,9 +466,10 @@ SELECT COUNT(*) FROM int_table i JOIN numeric_table n ON i.id::numeric = n.int_r
 \echo 'Key observations to look for:'
 \echo '1. Extension uses Index Scan; Stock uses Seq Scan (Test 2, 3)'
 \echo '2. Extension enables Hash Join cross-type (Test 4)'
-\echo '3. Extension enables Merge Join for int×numeric (Test 5)'
+\echo '3. Extension enables Merge Join for int×numeric (Test 5) and int×float (Test 7)'
 \echo '4. Extension enables Indexed Nested Loop; Stock does full scan (Test 6)'
 \echo '5. Fractional constants are correctly transformed (Test 1)'
+\echo '6. numeric(18,0) compares faster than unconstrained numeric (Test 9)'
 \echo ''
 
 -- Reset all settings
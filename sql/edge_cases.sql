@@ -176,3 +176,101 @@ SELECT 'SRS: int8 col = numeric below MIN'::text AS test,
 -- Verify EXPLAIN shows the transformation (should be Result or use native int8 ops)
 EXPLAIN (COSTS OFF) SELECT * FROM t_boundary_int8 WHERE val > '-9223372036854775808.1'::numeric;
 EXPLAIN (COSTS OFF) SELECT * FROM t_boundary_int8 WHERE val < '9223372036854775807.1'::numeric;
+
+-- ============================================================================
+-- Cached stable operands
+-- ============================================================================
+-- Comparisons that are not rewritten at plan time cache the decoded constant
+-- operand per call site. Results must match native comparisons.
+
+-- Support functions are disabled so the comparisons reach the executor.
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+-- numeric column vs integer constant (cached integer digit image)
+CREATE TEMPORARY TABLE t_cache_num (n numeric);
+INSERT INTO t_cache_num VALUES
+  (-10001), (-10000.5), (-10000), (-9999.99), (-1), (-0.5), (0), (0.5), (1),
+  (9999), (9999.5), (10000), (10000.0001), (100000000), (1e20), (-1e20),
+  ('NaN'), ('Infinity'), ('-Infinity'),
+  (9223372036854775807), (-9223372036854775808);
+SELECT bool_and((n = 10000::int4) = (n = 10000::numeric)
+            AND (n < 10000::int4) = (n < 10000::numeric)
+            AND (n >= 10000::int4) = (n >= 10000::numeric)) AS int4_10000,
+       bool_and((n = (-10000)::int2) = (n = -10000::numeric)
+            AND (n > (-10000)::int2) = (n > -10000::numeric)
+            AND (n <= (-10000)::int2) = (n <= -10000::numeric)) AS int2_m10000,
+       bool_and((n = 0::int8) = (n = 0::numeric)
+            AND (n < 0::int8) = (n < 0::numeric)
+            AND (n <> 0::int8) = (n <> 0::numeric)) AS int8_zero,
+       bool_and((n = 9223372036854775807::int8) = (n = 9223372036854775807::numeric)
+            AND (n < 9223372036854775807::int8) = (n < 9223372036854775807::numeric)) AS int8_max,
+       bool_and((n = '-9223372036854775808'::int8) = (n = '-9223372036854775808'::numeric)
+            AND (n > '-9223372036854775808'::int8) = (n > '-9223372036854775808'::numeric)) AS int8_min
+FROM t_cache_num;
+
+-- float columns vs integer constants beyond the float mantissa (cached rounding)
+CREATE TEMPORARY TABLE t_cache_float (f4 float4, f8 float8);
+INSERT INTO t_cache_float VALUES
+  (16777216, 9007199254740992), (16777218, 9007199254740994), (-0.5, -0.5),
+  ('NaN', 'NaN'), ('Infinity', 'Infinity'), ('-Infinity', '-Infinity'),
+  (9.223372e18, 9223372036854775807);
+SELECT count(*) FILTER (WHERE f4 = 16777217::int4) AS f4_eq,
+       count(*) FILTER (WHERE f4 < 16777217::int4) AS f4_lt,
+       count(*) FILTER (WHERE f4 > 16777217::int4) AS f4_gt,
+       count(*) FILTER (WHERE f4 > (-1)::int2) AS f4_gt_m1,
+       count(*) FILTER (WHERE f8 = 9007199254740993::int8) AS f8_eq,
+       count(*) FILTER (WHERE f8 < 9007199254740993::int8) AS f8_lt,
+       count(*) FILTER (WHERE f8 = 9223372036854775807::int8) AS f8_eq_max,
+       count(*) FILTER (WHERE f8 >= 9223372036854775807::int8) AS f8_ge_max
+FROM t_cache_float;
+
+-- integer column vs inexact constants (cached floor/fraction)
+CREATE TEMPORARY TABLE t_cache_int (i int8);
+INSERT INTO t_cache_int SELECT generate_series(-3, 3);
+INSERT INTO t_cache_int VALUES (9223372036854775807), (-9223372036854775808);
+SELECT count(*) FILTER (WHERE i < 2.5) AS lt_frac,
+       count(*) FILTER (WHERE i > -2.5::numeric) AS gt_neg_frac,
+       count(*) FILTER (WHERE i = 2.0::float8) AS eq_float8,
+       count(*) FILTER (WHERE i = -0.5::float4) AS eq_float4_frac,
+       count(*) FILTER (WHERE i <= '-Infinity'::float8) AS le_ninf,
+       count(*) FILTER (WHERE i < 'NaN'::numeric) AS lt_nan,
+       count(*) FILTER (WHERE i >= 9223372036854775807::float8) AS ge_2_63,
+       count(*) FILTER (WHERE i < 1e30) AS lt_huge
+FROM t_cache_int;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+
+-- A stable operand whose value changes between calls is re-decoded
+CREATE FUNCTION cache_loop() RETURNS text LANGUAGE plpgsql AS $$
+DECLARE
+  v numeric;
+  r text := '';
+BEGIN
+  FOREACH v IN ARRAY ARRAY[1.5, 2, 2.5, 'NaN', -1]::numeric[] LOOP
+    r := r || CASE WHEN 2::int4 < v THEN 't' ELSE 'f' END
+           || CASE WHEN v > 2::int4 THEN 't' ELSE 'f' END;
+  END LOOP;
+  RETURN r;
+END $$;
+SELECT cache_loop();
+DROP FUNCTION cache_loop();
+
+-- numeric(18,0) operands are converted straight to int64 (typmod fast path)
+CREATE TEMPORARY TABLE t_typmod (n18 numeric(18,0));
+INSERT INTO t_typmod VALUES
+  (-999999999999999999), (-100000000), (-10000), (-9999), (-1), (0), (1),
+  (9999), (10000), (10001), (100000000), (9220000000000000), (999999999999999999),
+  ('NaN'), (NULL);
+SELECT bool_and((n18 = i) IS NOT DISTINCT FROM (n18::numeric = i::numeric)
+            AND (n18 <> i) IS NOT DISTINCT FROM (n18::numeric <> i::numeric)
+            AND (n18 < i) IS NOT DISTINCT FROM (n18::numeric < i::numeric)
+            AND (n18 >= i) IS NOT DISTINCT FROM (n18::numeric >= i::numeric)
+            AND (i < n18) IS NOT DISTINCT FROM (i::numeric < n18::numeric)) AS int8_ok
+FROM t_typmod,
+     (VALUES ('-9223372036854775808'::int8), (-999999999999999999), (-10000),
+             (-1), (0), (1), (9999), (10000), (100000000), (999999999999999999),
+             (9223372036854775807)) v(i);
+SELECT bool_and((n18 = i) IS NOT DISTINCT FROM (n18::numeric = i::numeric)
+            AND (n18 > i) IS NOT DISTINCT FROM (n18::numeric > i::numeric)
+            AND (n18 <= i) IS NOT DISTINCT FROM (n18::numeric <= i::numeric)) AS int4_ok
+FROM t_typmod,
+     (VALUES ('-2147483648'::int4), (-10000), (-1), (0), (9999), (10000),
+             (2147483647)) v(i);
@@ -0,0 +1,137 @@
+-- Test the exact conversion functions num2int_exact_<int>(numeric|float4|float8)
+-- and their _or_null variants: every value must be exactly an integer of the
+-- target type, and the support functions drop the call around exact casts
+
+-- Load extension
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+-- ============================================================================
+-- Setup
+-- ============================================================================
+CREATE TABLE ec_stage (id int, n numeric, f4 float4, f8 float8);
+INSERT INTO ec_stage VALUES
+  (1, 42, 42, 42),
+  (2, -32768, -32768, -32768),
+  (3, 12.000, 12, 12),
+  (4, 2.5, 2.5, 2.5),
+  (5, 40000, 40000, 40000),
+  (6, 3000000000, 3000000000, 3000000000),
+  (7, -9223372036854775808, -9223372036854775808, -9223372036854775808),
+  (8, 9223372036854775807, 9223372036854775807, 9223372036854775807),
+  (9, 1e20, 1e20, 1e20),
+  (10, 'NaN', 'NaN', 'NaN'),
+  (11, 'Infinity', '-Infinity', 'Infinity'),
+  (12, NULL, NULL, NULL);
+CREATE TABLE ec_test (k2 int2, k4 int4, k8 int8);
+INSERT INTO ec_test VALUES (1, 1, 1), (-2, 40000, 3000000000);
+
+-- ============================================================================
+-- Test 1: _or_null from numeric
+-- NULL unless the value is an integer within the target type's range
+-- ============================================================================
+SELECT id,
+       num2int_exact_int2_or_null(n) AS i2,
+       num2int_exact_int4_or_null(n) AS i4,
+       num2int_exact_int8_or_null(n) AS i8
+FROM ec_stage
+ORDER BY id;
+
+-- ============================================================================
+-- Test 2: _or_null from float4
+-- NULL unless the value is an integer within the target type's range
+-- ============================================================================
+SELECT id,
+       num2int_exact_int2_or_null(f4) AS i2,
+       num2int_exact_int4_or_null(f4) AS i4,
+       num2int_exact_int8_or_null(f4) AS i8
+FROM ec_stage
+ORDER BY id;
+
+-- ============================================================================
+-- Test 3: _or_null from float8
+-- NULL unless the value is an integer within the target type's range
+-- ============================================================================
+SELECT id,
+       num2int_exact_int2_or_null(f8) AS i2,
+       num2int_exact_int4_or_null(f8) AS i4,
+       num2int_exact_int8_or_null(f8) AS i8
+FROM ec_stage
+ORDER BY id;
+
+-- ============================================================================
+-- Test 4: Strict variants return the same values where the value is exact
+-- ============================================================================
+SELECT id,
+       num2int_exact_int2(n) AS n_i2,
+       num2int_exact_int4(f4) AS f4_i4,
+       num2int_exact_int8(f8) AS f8_i8
+FROM ec_stage
+WHERE id IN (1, 2, 3, 12)
+ORDER BY id;
+
+-- ============================================================================
+-- Test 5: Strict variants raise where a cast would round or overflow
+-- ============================================================================
+SELECT num2int_exact_int4(n) FROM ec_stage WHERE id = 4;
+SELECT num2int_exact_int8(f8) FROM ec_stage WHERE id = 4;
+SELECT num2int_exact_int2(n) FROM ec_stage WHERE id = 5;
+SELECT num2int_exact_int4(f4) FROM ec_stage WHERE id = 6;
+SELECT num2int_exact_int8(f8) FROM ec_stage WHERE id = 8;
+SELECT num2int_exact_int8(n) FROM ec_stage WHERE id = 9;
+SELECT num2int_exact_int4(n) FROM ec_stage WHERE id = 10;
+SELECT num2int_exact_int8(f4) FROM ec_stage WHERE id = 11;
+-- The range is checked on the truncated value: a fraction just inside the
+-- range is reported as a fraction, one just outside it as out of range
+SELECT num2int_exact_int2(-32768.4);
+SELECT num2int_exact_int2(-32768.5::float8);
+SELECT num2int_exact_int2(32767.5::float4);
+SELECT num2int_exact_int2(-32769.5);
+SELECT num2int_exact_int4(2147483648.5::float8);
+SELECT num2int_exact_int8(-9223372036854775808.5);
+SELECT num2int_exact_int4(-9223372036854775808.5);
+
+-- ============================================================================
+-- Test 6: Constant arguments fold at plan time
+-- ============================================================================
+EXPLAIN (VERBOSE, COSTS OFF)
+SELECT num2int_exact_int4(42.0), num2int_exact_int8(-7::float8),
+       num2int_exact_int4_or_null(2.5), num2int_exact_int2_or_null(1e10::float8);
+SELECT num2int_exact_int4(2.5);
+
+-- ============================================================================
+-- Test 7: Exact casts of integer columns reduce to the column
+-- Every integer is exact in numeric, int2/int4 in float8, int2 in float4
+-- ============================================================================
+EXPLAIN (VERBOSE, COSTS OFF)
+SELECT num2int_exact_int4(k4::numeric), num2int_exact_int8(k4::float8),
+       num2int_exact_int2(k8::numeric), num2int_exact_int4_or_null(k2::float4)
+FROM ec_test;
+SELECT num2int_exact_int4(k4::numeric), num2int_exact_int8(k4::float8)
+FROM ec_test
+ORDER BY k4;
+
+-- A narrowing coercion still raises on overflow
+SELECT num2int_exact_int2(k4::numeric) FROM ec_test;
+
+-- ============================================================================
+-- Test 8: Calls that are kept
+-- int8 is not exact in float8, and _or_null does not take a narrowing cast
+-- ============================================================================
+EXPLAIN (VERBOSE, COSTS OFF)
+SELECT num2int_exact_int8(k8::float8), num2int_exact_int2_or_null(k4::numeric)
+FROM ec_test;
+SELECT k4, num2int_exact_int2_or_null(k4::numeric) AS i2
+FROM ec_test
+ORDER BY k4;
+
+-- With support functions disabled the call is always kept
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+EXPLAIN (VERBOSE, COSTS OFF)
+SELECT num2int_exact_int4(k4::numeric) FROM ec_test;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+
+-- ============================================================================
+-- Cleanup
+-- ============================================================================
+DROP TABLE ec_stage;
+DROP TABLE ec_test;
@@ -6,6 +6,7 @@
 -- 1. OID stability: hardcoded PostgreSQL OIDs match the system catalog
 -- 2. Extension cleanup: event trigger removes operator family entries on DROP
 -- 3. Syscache invalidation: OID cache is refreshed after DROP/CREATE
+-- 4. Upgrade: ALTER EXTENSION UPDATE from 1.0.0 matches a fresh install
 
 -- ============================================================================
 -- OID Stability Tests
@@ -28,6 +29,7 @@ SELECT
 FROM pg_proc WHERE proname = 'int8' AND pronargs = 1 AND proargtypes[0] = 'numeric'::regtype;
 
 -- Integer comparison operator OIDs (NUM2INT_INT*_OID in header)
+-- Numeric and float comparison operator OIDs (NUM2INT_NUMERIC*_OID, NUM2INT_FLOAT*_OID)
 -- Numeric function OIDs (NUM2INT_NUMERIC_* in header)
 WITH oid_checks AS (
     SELECT 1783 AS expected, oid AS actual, 'int2(numeric)' AS name FROM pg_proc WHERE proname = 'int2' AND pronargs = 1 AND proargtypes[0] = 'numeric'::regtype
@@ -54,6 +56,24 @@ WITH oid_checks AS (
     UNION ALL SELECT 414, oid, 'int8 <= int8' FROM pg_operator WHERE oprname = '<=' AND oprleft = 'int8'::regtype AND oprright = 'int8'::regtype
     UNION ALL SELECT 415, oid, 'int8 >= int8' FROM pg_operator WHERE oprname = '>=' AND oprleft = 'int8'::regtype AND oprright = 'int8'::regtype
     UNION ALL SELECT 411, oid, 'int8 <> int8' FROM pg_operator WHERE oprname = '<>' AND oprleft = 'int8'::regtype AND oprright = 'int8'::regtype
+    UNION ALL SELECT 1752, oid, 'numeric = numeric' FROM pg_operator WHERE oprname = '=' AND oprleft = 'numeric'::regtype AND oprright = 'numeric'::regtype
+    UNION ALL SELECT 1754, oid, 'numeric < numeric' FROM pg_operator WHERE oprname = '<' AND oprleft = 'numeric'::regtype AND oprright = 'numeric'::regtype
+    UNION ALL SELECT 1756, oid, 'numeric > numeric' FROM pg_operator WHERE oprname = '>' AND oprleft = 'numeric'::regtype AND oprright = 'numeric'::regtype
+    UNION ALL SELECT 1755, oid, 'numeric <= numeric' FROM pg_operator WHERE oprname = '<=' AND oprleft = 'numeric'::regtype AND oprright = 'numeric'::regtype
+    UNION ALL SELECT 1757, oid, 'numeric >= numeric' FROM pg_operator WHERE oprname = '>=' AND oprleft = 'numeric'::regtype AND oprright = 'numeric'::regtype
+    UNION ALL SELECT 1753, oid, 'numeric <> numeric' FROM pg_operator WHERE oprname = '<>' AND oprleft = 'numeric'::regtype AND oprright = 'numeric'::regtype
+    UNION ALL SELECT 620, oid, 'float4 = float4' FROM pg_operator WHERE oprname = '=' AND oprleft = 'float4'::regtype AND oprright = 'float4'::regtype
+    UNION ALL SELECT 622, oid, 'float4 < float4' FROM pg_operator WHERE oprname = '<' AND oprleft = 'float4'::regtype AND oprright = 'float4'::regtype
+    UNION ALL SELECT 623, oid, 'float4 > float4' FROM pg_operator WHERE oprname = '>' AND oprleft = 'float4'::regtype AND oprright = 'float4'::regtype
+    UNION ALL SELECT 624, oid, 'float4 <= float4' FROM pg_operator WHERE oprname = '<=' AND oprleft = 'float4'::regtype AND oprright = 'float4'::regtype
+    UNION ALL SELECT 625, oid, 'float4 >= float4' FROM pg_operator WHERE oprname = '>=' AND oprleft = 'float4'::regtype AND oprright = 'float4'::regtype
+    UNION ALL SELECT 621, oid, 'float4 <> float4' FROM pg_operator WHERE oprname = '<>' AND oprleft = 'float4'::regtype AND oprright = 'float4'::regtype
+    UNION ALL SELECT 670, oid, 'float8 = float8' FROM pg_operator WHERE oprname = '=' AND oprleft = 'float8'::regtype AND oprright = 'float8'::regtype
+    UNION ALL SELECT 672, oid, 'float8 < float8' FROM pg_operator WHERE oprname = '<' AND oprleft = 'float8'::regtype AND oprright = 'float8'::regtype
+    UNION ALL SELECT 674, oid, 'float8 > float8' FROM pg_operator WHERE oprname = '>' AND oprleft = 'float8'::regtype AND oprright = 'float8'::regtype
+    UNION ALL SELECT 673, oid, 'float8 <= float8' FROM pg_operator WHERE oprname = '<=' AND oprleft = 'float8'::regtype AND oprright = 'float8'::regtype
+    UNION ALL SELECT 675, oid, 'float8 >= float8' FROM pg_operator WHERE oprname = '>=' AND oprleft = 'float8'::regtype AND oprright = 'float8'::regtype
+    UNION ALL SELECT 671, oid, 'float8 <> float8' FROM pg_operator WHERE oprname = '<>' AND oprleft = 'float8'::regtype AND oprright = 'float8'::regtype
 )
 SELECT 
     COUNT(*) FILTER (WHERE expected != actual) AS oid_mismatches,
@@ -168,6 +188,15 @@ AND am.amname = 'btree'
 AND ((ao.amoplefttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype) AND ao.amoprighttype IN ('float4'::regtype, 'float8'::regtype))
      OR (ao.amoplefttype IN ('float4'::regtype, 'float8'::regtype) AND ao.amoprighttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype)));
 
+-- Verify no cross-type operators remain in the BRIN minmax(-multi) families
+SELECT COUNT(*) AS leftover_brin_ops
+FROM pg_amop ao
+JOIN pg_opfamily of ON ao.amopfamily = of.oid
+JOIN pg_am am ON of.opfmethod = am.oid
+WHERE am.amname = 'brin'
+AND ((ao.amoplefttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype) AND ao.amoprighttype IN ('numeric'::regtype, 'float4'::regtype, 'float8'::regtype))
+     OR (ao.amoplefttype IN ('numeric'::regtype, 'float4'::regtype, 'float8'::regtype) AND ao.amoprighttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype)));
+
 -- Recreate extension
 CREATE EXTENSION pg_num2int_direct_comp;
 
@@ -197,6 +226,15 @@ AND am.amname = 'btree'
 AND ((ao.amoplefttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype) AND ao.amoprighttype IN ('float4'::regtype, 'float8'::regtype))
      OR (ao.amoplefttype IN ('float4'::regtype, 'float8'::regtype) AND ao.amoprighttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype)));
 
+SELECT COUNT(*) AS recreated_brin_ops
+FROM pg_amop ao
+JOIN pg_opfamily of ON ao.amopfamily = of.oid
+JOIN pg_am am ON of.opfmethod = am.oid
+WHERE of.opfname IN ('integer_minmax_ops', 'numeric_minmax_ops', 'float_minmax_ops')
+AND am.amname = 'brin'
+AND ((ao.amoplefttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype) AND ao.amoprighttype IN ('numeric'::regtype, 'float4'::regtype, 'float8'::regtype))
+     OR (ao.amoplefttype IN ('numeric'::regtype, 'float4'::regtype, 'float8'::regtype) AND ao.amoprighttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype)));
+
 -- Verify event trigger was recreated
 SELECT evtname FROM pg_event_trigger 
 WHERE evtname = 'pg_num2int_direct_comp_drop_trigger';
@@ -235,8 +273,148 @@ EXPLAIN (COSTS OFF) EXECUTE lifecycle_find2(42);
 -- Should show: Filter: (id = 42)  -- NOT '42'::numeric
 
 DEALLOCATE lifecycle_find2;
+-- Unrelated operator changes only invalidate matching cache entries; the
+-- cached operators must keep working across them
+CREATE FUNCTION lifecycle_text_eq(text, text) RETURNS bool
+  LANGUAGE sql IMMUTABLE AS 'SELECT $1 = $2';
+CREATE OPERATOR === (LEFTARG = text, RIGHTARG = text, FUNCTION = lifecycle_text_eq);
+EXPLAIN (COSTS OFF) SELECT * FROM lifecycle_test WHERE id = 42.0::numeric;
+DROP OPERATOR === (text, text);
+DROP FUNCTION lifecycle_text_eq(text, text);
+EXPLAIN (COSTS OFF) SELECT * FROM lifecycle_test WHERE id = 42.5::numeric;
+
+-- The OID map filled at install time covers every operator and runtime key
+-- function, and matches the catalog after DROP/CREATE
+SELECT count(*) FILTER (WHERE righttype <> 0) AS operators,
+       count(*) FILTER (WHERE righttype = 0) AS key_functions,
+       count(*) FILTER (WHERE righttype <> 0 AND NOT EXISTS (
+         SELECT 1 FROM pg_operator o
+         WHERE o.oid = m.objid AND o.oprcode::oid = m.funcid)) AS stale
+FROM num2int_oid_map m;
+
+-- A map left stale, as pg_upgrade leaves it, is rebuilt by the refresh
+-- function
+UPDATE num2int_oid_map SET objid = 0;
+SELECT count(*) FILTER (WHERE righttype <> 0) AS operators,
+       count(*) FILTER (WHERE righttype = 0) AS key_functions,
+       count(*) FILTER (WHERE righttype <> 0 AND NOT EXISTS (
+         SELECT 1 FROM pg_operator o
+         WHERE o.oid = m.objid AND o.oprcode::oid = m.funcid)) AS stale
+FROM num2int_oid_map m;
+SELECT pg_num2int_direct_comp_refresh_oid_map() AS map_rows;
+SELECT count(*) FILTER (WHERE righttype <> 0) AS operators,
+       count(*) FILTER (WHERE righttype = 0) AS key_functions,
+       count(*) FILTER (WHERE righttype <> 0 AND NOT EXISTS (
+         SELECT 1 FROM pg_operator o
+         WHERE o.oid = m.objid AND o.oprcode::oid = m.funcid)) AS stale
+FROM num2int_oid_map m;
+
 DROP TABLE lifecycle_test;
 
+-- ============================================================================
+-- Extension Upgrade Tests
+-- ============================================================================
+-- ALTER EXTENSION ... UPDATE from 1.0.0 must leave the same catalog state as
+-- a fresh install of the current version: the same member objects, the same
+-- operator estimators and MERGES flags, the same function definitions and
+-- the same operator family entries.
+
+CREATE TEMPORARY VIEW lifecycle_catalog AS
+WITH members AS (
+  SELECT d.classid, d.objid, d.objsubid
+  FROM pg_depend d
+  JOIN pg_extension e ON e.oid = d.refobjid
+  WHERE d.refclassid = 'pg_extension'::regclass
+    AND e.extname = 'pg_num2int_direct_comp'
+    AND d.deptype = 'e'
+)
+SELECT 'member ' || pg_describe_object(classid, objid, objsubid) AS entry
+FROM members
+UNION ALL
+SELECT format('operator %s: %s rest=%s join=%s merges=%s hashes=%s com=%s neg=%s',
+              o.oid::regoperator, o.oprcode, o.oprrest, o.oprjoin,
+              o.oprcanmerge, o.oprcanhash, o.oprcom::regoperator,
+              o.oprnegate::regoperator)
+FROM pg_operator o JOIN members m
+  ON m.classid = 'pg_operator'::regclass AND m.objid = o.oid
+UNION ALL
+SELECT format('function %s: %s %s %s %s %s', p.oid::regprocedure,
+              p.provolatile, p.proparallel, p.proisstrict, p.prosupport,
+              md5(p.prosrc))
+FROM pg_proc p JOIN members m
+  ON m.classid = 'pg_proc'::regclass AND m.objid = p.oid
+UNION ALL
+SELECT pg_describe_object('pg_amop'::regclass, a.oid, 0)
+FROM pg_amop a JOIN members m
+  ON m.classid = 'pg_operator'::regclass AND m.objid = a.amopopr
+UNION ALL
+SELECT pg_describe_object('pg_amproc'::regclass, a.oid, 0)
+FROM pg_amproc a JOIN members m
+  ON m.classid = 'pg_proc'::regclass AND m.objid = a.amproc
+UNION ALL
+SELECT 'comment ' || pg_describe_object(m.classid, m.objid, m.objsubid) ||
+       ': ' || md5(ds.description)
+FROM pg_description ds JOIN members m
+  ON m.classid = ds.classoid AND m.objid = ds.objoid
+ AND m.objsubid = ds.objsubid;
+
+CREATE TEMPORARY TABLE lifecycle_fresh AS SELECT * FROM lifecycle_catalog;
+
+DROP EXTENSION pg_num2int_direct_comp;
+CREATE EXTENSION pg_num2int_direct_comp VERSION '1.0.0';
+SELECT extversion FROM pg_extension WHERE extname = 'pg_num2int_direct_comp';
+SELECT to_regclass('num2int_oid_map') IS NULL AS no_oid_map_in_1_0_0;
+
+ALTER EXTENSION pg_num2int_direct_comp UPDATE TO '1.1.0';
+SELECT extversion FROM pg_extension WHERE extname = 'pg_num2int_direct_comp';
+
+-- Both differences must be empty, and the OID map is filled as on install
+SELECT count(*) AS missing_after_upgrade
+FROM (SELECT * FROM lifecycle_fresh EXCEPT SELECT * FROM lifecycle_catalog) s;
+SELECT count(*) AS extra_after_upgrade
+FROM (SELECT * FROM lifecycle_catalog EXCEPT SELECT * FROM lifecycle_fresh) s;
+SELECT count(*) FILTER (WHERE righttype <> 0) AS operators,
+       count(*) FILTER (WHERE righttype = 0) AS key_functions,
+       count(*) FILTER (WHERE righttype <> 0 AND NOT EXISTS (
+         SELECT 1 FROM pg_operator o
+         WHERE o.oid = m.objid AND o.oprcode::oid = m.funcid)) AS stale
+FROM num2int_oid_map m;
+
+-- The upgraded extension works without reconnecting: the estimator and
+-- the runtime key rewrite are picked up by this backend
+CREATE TEMPORARY TABLE lifecycle_upgrade (id INT4 PRIMARY KEY, payload text);
+INSERT INTO lifecycle_upgrade SELECT g, 'row ' || g FROM generate_series(1, 1000) g;
+ANALYZE lifecycle_upgrade;
+SET plan_cache_mode = force_generic_plan;
+PREPARE lifecycle_upgrade_find(numeric) AS
+  SELECT * FROM lifecycle_upgrade WHERE id = $1;
+EXPLAIN (COSTS OFF) EXECUTE lifecycle_upgrade_find(42);
+EXECUTE lifecycle_upgrade_find(42);
+EXECUTE lifecycle_upgrade_find(42.5);
+DEALLOCATE lifecycle_upgrade_find;
+RESET plan_cache_mode;
+
+-- Dropping the upgraded extension must clean up everything the upgrade added
+DROP TABLE lifecycle_upgrade;
+DROP EXTENSION pg_num2int_direct_comp;
+SELECT count(*) AS leftover_entries
+FROM pg_amop a JOIN pg_opfamily f ON f.oid = a.amopfamily
+WHERE (f.opfname IN ('numeric_ops', 'integer_ops', 'float_ops')
+       OR f.opfname LIKE '%minmax%')
+  AND a.amoplefttype <> a.amoprighttype
+  AND (a.amoplefttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype))
+      <> (a.amoprighttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype));
+SELECT count(*) AS leftover_procs
+FROM pg_amproc a JOIN pg_opfamily f ON f.oid = a.amprocfamily
+WHERE (f.opfname IN ('numeric_ops', 'integer_ops', 'float_ops')
+       OR f.opfname LIKE '%minmax%')
+  AND a.amproclefttype <> a.amprocrighttype
+  AND (a.amproclefttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype))
+      <> (a.amprocrighttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype));
+CREATE EXTENSION pg_num2int_direct_comp;
+DROP VIEW lifecycle_catalog;
+DROP TABLE lifecycle_fresh;
+
 -- ============================================================================
 -- Hash Function Compatibility Tests
 -- ============================================================================
@@ -0,0 +1,83 @@
+-- Test: Bit-exactness of the cross-type hash functions
+-- Purpose: hash_int*_as_numeric / hash_int*_as_float* must return exactly what
+-- the core hash function of the other type returns for the equal value, or
+-- hash joins and hash partitioning silently lose matches.
+
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+CREATE TEMP TABLE hash_vals (v int8);
+
+-- Every int2 value
+INSERT INTO hash_vals SELECT generate_series(-32768, 32767);
+
+-- int4 range in steps of 2^16, plus the maximum
+INSERT INTO hash_vals SELECT generate_series(-2147483648, 2147483647, 65536);
+INSERT INTO hash_vals VALUES (2147483647);
+
+-- Powers of 10 and their neighbours (digit-group boundaries, inner zero digits)
+INSERT INTO hash_vals
+SELECT s * (10::numeric ^ k + d)::int8
+FROM generate_series(0, 18) k, (VALUES (-1), (0), (1)) dv(d), (VALUES (1), (-1)) sv(s);
+
+-- Multiples of powers of 10000 (trailing zero digits)
+INSERT INTO hash_vals
+SELECT s * (10000::numeric ^ k * m)::int8
+FROM generate_series(0, 3) k, (VALUES (1), (5000), (9999)) mv(m), (VALUES (1), (-1)) sv(s);
+INSERT INTO hash_vals VALUES (10000000000000000), (-10000000000000000);
+
+-- int8 boundaries and zero
+INSERT INTO hash_vals VALUES
+  (-9223372036854775808), (-9223372036854775807), (0),
+  (9223372036854775806), (9223372036854775807);
+
+-- Random values over the whole int8 range and within int4
+SELECT setseed(0.42);
+INSERT INTO hash_vals
+SELECT ((random() - 0.5) * 1.8e19)::int8 FROM generate_series(1, 50000);
+INSERT INTO hash_vals
+SELECT ((random() - 0.5) * 4.2e9)::int8 FROM generate_series(1, 50000);
+
+SELECT COUNT(*) AS checked FROM hash_vals;
+
+CREATE TEMP TABLE hash_seeds (s int8);
+INSERT INTO hash_seeds VALUES (0), (1), (42), (-1), (-9223372036854775808);
+
+-- numeric: 32-bit hash
+SELECT 'int8 vs hash_numeric'::text AS test,
+       COUNT(*) FILTER (WHERE hash_int8_as_numeric(v) <> hash_numeric(v::numeric)) AS mismatches
+FROM hash_vals;
+SELECT 'int4 vs hash_numeric'::text AS test,
+       COUNT(*) FILTER (WHERE hash_int4_as_numeric(v::int4) <> hash_numeric(v::numeric)) AS mismatches
+FROM hash_vals WHERE v BETWEEN -2147483648 AND 2147483647;
+SELECT 'int2 vs hash_numeric'::text AS test,
+       COUNT(*) FILTER (WHERE hash_int2_as_numeric(v::int2) <> hash_numeric(v::numeric)) AS mismatches
+FROM hash_vals WHERE v BETWEEN -32768 AND 32767;
+
+-- numeric: 64-bit seeded hash
+SELECT 'int8 vs hash_numeric_extended'::text AS test,
+       COUNT(*) FILTER (WHERE hash_int8_as_numeric_extended(v, s) <> hash_numeric_extended(v::numeric, s)) AS mismatches
+FROM hash_vals, hash_seeds;
+SELECT 'int4 vs hash_numeric_extended'::text AS test,
+       COUNT(*) FILTER (WHERE hash_int4_as_numeric_extended(v::int4, s) <> hash_numeric_extended(v::numeric, s)) AS mismatches
+FROM hash_vals, hash_seeds WHERE v BETWEEN -2147483648 AND 2147483647;
+SELECT 'int2 vs hash_numeric_extended'::text AS test,
+       COUNT(*) FILTER (WHERE hash_int2_as_numeric_extended(v::int2, s) <> hash_numeric_extended(v::numeric, s)) AS mismatches
+FROM hash_vals, hash_seeds WHERE v BETWEEN -32768 AND 32767;
+
+-- Numerics with a display scale hash like the integer
+SELECT 'int8 vs scaled numeric'::text AS test,
+       COUNT(*) FILTER (WHERE hash_int8_as_numeric(v) <> hash_numeric(round(v::numeric, 4))) AS mismatches
+FROM hash_vals;
+
+-- float4 / float8
+SELECT 'int8 vs hashfloat8'::text AS test,
+       COUNT(*) FILTER (WHERE hash_int8_as_float8(v) <> hashfloat8(v::float8)
+                           OR hash_int8_as_float8_extended(v, 42) <> hashfloat8extended(v::float8, 42)) AS mismatches
+FROM hash_vals;
+SELECT 'int8 vs hashfloat4'::text AS test,
+       COUNT(*) FILTER (WHERE hash_int8_as_float4(v) <> hashfloat4(v::float4)
+                           OR hash_int8_as_float4_extended(v, 42) <> hashfloat4extended(v::float4, 42)) AS mismatches
+FROM hash_vals;
+
+DROP TABLE hash_seeds;
+DROP TABLE hash_vals;
@@ -0,0 +1,162 @@
+-- Test hash partition pruning of numeric and float partition keys by integer
+-- comparands. The extension adds hash_int*_as_numeric_extended and
+-- hash_int*_as_float8_extended to the numeric_ops and float_ops hash
+-- families; partition pruning hashes the integer lookup value with them
+-- instead of building a numeric or float8 first, so they must reproduce the
+-- partition key's own hash for HASH_PARTITION_SEED. Casting the key instead
+-- (id::int8 = x) disables pruning entirely.
+
+-- Load extension
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+-- ============================================================================
+-- Setup: numeric and float8 hash-partitioned tables, 4 partitions each
+-- ============================================================================
+CREATE TABLE hp_accounts (id numeric, payload text) PARTITION BY HASH (id);
+CREATE TABLE hp_accounts_p0 PARTITION OF hp_accounts FOR VALUES WITH (MODULUS 4, REMAINDER 0);
+CREATE TABLE hp_accounts_p1 PARTITION OF hp_accounts FOR VALUES WITH (MODULUS 4, REMAINDER 1);
+CREATE TABLE hp_accounts_p2 PARTITION OF hp_accounts FOR VALUES WITH (MODULUS 4, REMAINDER 2);
+CREATE TABLE hp_accounts_p3 PARTITION OF hp_accounts FOR VALUES WITH (MODULUS 4, REMAINDER 3);
+CREATE INDEX hp_accounts_id_idx ON hp_accounts (id);
+-- Integers, a second scale of 1500 and fractions no integer equals
+INSERT INTO hp_accounts SELECT i, 'account ' || i FROM generate_series(1, 4000) i;
+INSERT INTO hp_accounts VALUES (1500.00, 'account 1500.00');
+INSERT INTO hp_accounts SELECT i + 0.5, 'fraction ' || i FROM generate_series(1, 100) i;
+ANALYZE hp_accounts;
+
+CREATE TABLE hp_readings (val float8) PARTITION BY HASH (val);
+CREATE TABLE hp_readings_p0 PARTITION OF hp_readings FOR VALUES WITH (MODULUS 4, REMAINDER 0);
+CREATE TABLE hp_readings_p1 PARTITION OF hp_readings FOR VALUES WITH (MODULUS 4, REMAINDER 1);
+CREATE TABLE hp_readings_p2 PARTITION OF hp_readings FOR VALUES WITH (MODULUS 4, REMAINDER 2);
+CREATE TABLE hp_readings_p3 PARTITION OF hp_readings FOR VALUES WITH (MODULUS 4, REMAINDER 3);
+INSERT INTO hp_readings SELECT i FROM generate_series(1, 4000) i;
+INSERT INTO hp_readings VALUES (9007199254740992);
+ANALYZE hp_readings;
+
+-- Count partition scans in a plan, partitions removed by executor startup
+-- pruning, and partition scans skipped by run-time pruning
+CREATE FUNCTION hp_pruning(query text, do_analyze bool DEFAULT false)
+RETURNS text LANGUAGE plpgsql AS $$
+DECLARE
+  line text;
+  scanned int := 0;
+  removed int := 0;
+  never int := 0;
+BEGIN
+  FOR line IN EXECUTE 'EXPLAIN (COSTS OFF'
+      || CASE WHEN do_analyze THEN ', ANALYZE, TIMING OFF, SUMMARY OFF' ELSE '' END
+      || ') ' || query LOOP
+    IF line ~ '(Seq Scan|Bitmap Heap Scan|Index Scan using \S+|Index Only Scan using \S+) on hp_(accounts|readings)_p\d' THEN
+      scanned := scanned + 1;
+      IF line ~ 'never executed' THEN
+        never := never + 1;
+      END IF;
+    END IF;
+    IF line ~ 'Subplans Removed' THEN
+      removed := removed + substring(line from '\d+')::int;
+    END IF;
+  END LOOP;
+  RETURN format('scanned=%s removed=%s never=%s', scanned, removed, never);
+END $$;
+
+-- ============================================================================
+-- Test 1: Plan-time pruning of a numeric key
+-- ============================================================================
+-- Without the extension: the partition key is cast, nothing is pruned
+SELECT hp_pruning('SELECT count(*) FROM hp_accounts WHERE id::int8 = 1500');
+-- Integer constants are simplified to numeric constants first
+SELECT hp_pruning('SELECT count(*) FROM hp_accounts WHERE id = 1500::int8');
+SELECT hp_pruning('SELECT count(*) FROM hp_accounts WHERE id = 1500');
+SELECT hp_pruning('SELECT count(*) FROM hp_accounts WHERE id = 1500::int2');
+-- Both scales of 1500 hash alike and were routed to the same partition
+SELECT count(*) FROM hp_accounts WHERE id = 1500::int8;
+-- With support functions off the cross-type operator reaches the pruning
+-- code, which hashes the integer with the family's cross-type hash function
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+SELECT hp_pruning('SELECT count(*) FROM hp_accounts WHERE id = 1500::int8');
+SELECT hp_pruning('SELECT count(*) FROM hp_accounts WHERE id = 1500::int4');
+SELECT hp_pruning('SELECT count(*) FROM hp_accounts WHERE id = 1500::int2');
+SELECT hp_pruning('SELECT count(*) FROM hp_accounts WHERE 1500::int8 = id');
+SELECT count(*) FROM hp_accounts WHERE id = 1500::int8;
+SELECT count(*) FROM hp_accounts WHERE 1500::int2 = id;
+-- A value with no row still scans exactly one partition
+SELECT hp_pruning('SELECT count(*) FROM hp_accounts WHERE id = 99999::int8');
+SELECT count(*) FROM hp_accounts WHERE id = 99999::int8;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+
+-- ============================================================================
+-- Test 2: Executor startup pruning for generic-plan parameters
+-- ============================================================================
+-- Parameter comparands are not simplified: the cross-type operator is pruned
+-- once the parameter is known
+SET plan_cache_mode = force_generic_plan;
+PREPARE hp_eq8(int8) AS SELECT count(*) FROM hp_accounts WHERE id = $1;
+SELECT hp_pruning('EXECUTE hp_eq8(1500)');
+EXECUTE hp_eq8(1500);
+EXECUTE hp_eq8(2);
+DEALLOCATE hp_eq8;
+PREPARE hp_eq4(int4) AS SELECT count(*) FROM hp_accounts WHERE id = $1;
+SELECT hp_pruning('EXECUTE hp_eq4(1500)');
+EXECUTE hp_eq4(1500);
+DEALLOCATE hp_eq4;
+PREPARE hp_eq2(int2) AS SELECT count(*) FROM hp_accounts WHERE $1 = id;
+SELECT hp_pruning('EXECUTE hp_eq2(1500)');
+EXECUTE hp_eq2(1500);
+DEALLOCATE hp_eq2;
+-- Same with support functions off
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+PREPARE hp_eq_off(int8) AS SELECT count(*) FROM hp_accounts WHERE id = $1;
+SELECT hp_pruning('EXECUTE hp_eq_off(1500)');
+EXECUTE hp_eq_off(1500);
+DEALLOCATE hp_eq_off;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+RESET plan_cache_mode;
+
+-- ============================================================================
+-- Test 3: Run-time pruning for nested-loop parameters
+-- ============================================================================
+CREATE TABLE hp_lookup (i int8);
+INSERT INTO hp_lookup VALUES (1500);
+ANALYZE hp_lookup;
+SET enable_hashjoin = off;
+SET enable_mergejoin = off;
+SET enable_seqscan = off;
+-- Without the extension: every partition is scanned for the outer row
+SELECT hp_pruning('SELECT count(*) FROM hp_lookup l JOIN hp_accounts a ON a.id::int8 = l.i', true);
+-- Only the partition of the outer value is scanned
+SELECT hp_pruning('SELECT count(*) FROM hp_lookup l JOIN hp_accounts a ON a.id = l.i', true);
+SELECT count(*) FROM hp_lookup l JOIN hp_accounts a ON a.id = l.i;
+-- Every integer row is found in the partition the integer hash selects
+SELECT count(*) FROM generate_series(1, 4000) g(i) JOIN hp_accounts a ON a.id = g.i::int8;
+SELECT count(*) FROM generate_series(1, 4000) g(i) JOIN hp_accounts a ON a.id = g.i::int4;
+SELECT count(*) FROM generate_series(1, 4000) g(i) JOIN hp_accounts a ON a.id = g.i::int2;
+RESET enable_hashjoin;
+RESET enable_mergejoin;
+RESET enable_seqscan;
+
+-- ============================================================================
+-- Test 4: float8 key
+-- ============================================================================
+SELECT hp_pruning('SELECT count(*) FROM hp_readings WHERE val = 1500::int8');
+-- 2^53 + 1 equals no float8: folded to an empty qualification, no partition
+-- is scanned
+SELECT hp_pruning('SELECT count(*) FROM hp_readings WHERE val = 9007199254740993::int8');
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+SELECT hp_pruning('SELECT count(*) FROM hp_readings WHERE val = 1500::int4');
+-- Unsimplified, it hashes like 2^53: one partition, no match
+SELECT hp_pruning('SELECT count(*) FROM hp_readings WHERE val = 9007199254740993::int8');
+SELECT count(*) FROM hp_readings WHERE val = 9007199254740993::int8;
+SELECT count(*) FROM hp_readings WHERE val = 9007199254740992::int8;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+SET plan_cache_mode = force_generic_plan;
+PREPARE hp_val(int4) AS SELECT count(*) FROM hp_readings WHERE val = $1;
+SELECT hp_pruning('EXECUTE hp_val(1500)');
+EXECUTE hp_val(1500);
+DEALLOCATE hp_val;
+RESET plan_cache_mode;
+
+-- Cleanup
+DROP FUNCTION hp_pruning(text, bool);
+DROP TABLE hp_lookup;
+DROP TABLE hp_accounts;
+DROP TABLE hp_readings;
@@ -108,6 +108,72 @@ ORDER BY op.oprleft, op.oprright;
 
 -- Expected: Both directions in numeric_ops btree family
 
+-- Test 7: Memoize in front of the inner index probe (PostgreSQL 14+)
+-- The cache key is the outer join column, hashed and compared with its own
+-- type's default hash opclass; because the cross-type = operators are
+-- hashjoinable the cache runs in logical mode, so 1 and 1.00 share an entry.
+-- Repeated outer keys are cache hits and skip the inner index probe.
+CREATE TEMPORARY TABLE nl_outer (k4 INT4, k8 INT8, kn NUMERIC);
+INSERT INTO nl_outer
+SELECT i % 10 + 1, i % 10 + 1,
+       CASE WHEN i % 2 = 0 THEN (i % 10 + 1)::numeric
+            ELSE (i % 10 + 1)::numeric(10,2) END
+FROM generate_series(1, 1000) i;
+ANALYZE nl_outer;
+
+-- Memoize cache key, hits/misses/evictions, and the number of inner probes
+CREATE FUNCTION nl_memoize(query text) RETURNS text LANGUAGE plpgsql AS $$
+DECLARE
+  line text;
+  cache_key text := '-';
+  hits text := '-';
+  misses text := '-';
+  evictions text := '-';
+  probes text := '-';
+BEGIN
+  FOR line IN EXECUTE 'EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF, SUMMARY OFF) '
+      || query LOOP
+    IF line ~ 'Cache Key:' THEN
+      cache_key := substring(line from 'Cache Key: (.*)$');
+    END IF;
+    IF line ~ 'Hits: \d+' THEN
+      hits := substring(line from 'Hits: (\d+)');
+      misses := substring(line from 'Misses: (\d+)');
+      evictions := substring(line from 'Evictions: (\d+)');
+    END IF;
+    IF line ~ 'Index (Only )?Scan using idx_nl_' THEN
+      probes := substring(line from 'loops=(\d+)');
+    END IF;
+  END LOOP;
+  RETURN format('key=%s hits=%s misses=%s evictions=%s probes=%s',
+                cache_key, hits, misses, evictions, probes);
+END $$;
+
+SET enable_hashjoin = off;
+SET enable_mergejoin = off;
+
+-- int8 outer keys probing a numeric index
+SELECT nl_memoize('SELECT COUNT(*) FROM nl_outer o JOIN nl_numeric n ON o.k8 = n.val');
+SELECT COUNT(*) FROM nl_outer o JOIN nl_numeric n ON o.k8 = n.val;
+
+-- int4 outer keys probing a float8 index
+SELECT nl_memoize('SELECT COUNT(*) FROM nl_outer o JOIN nl_float8 f ON o.k4 = f.val');
+SELECT COUNT(*) FROM nl_outer o JOIN nl_float8 f ON o.k4 = f.val;
+
+-- numeric outer keys probing an int4 index: 1 and 1.00 hit the same entry
+SELECT nl_memoize('SELECT COUNT(*) FROM nl_outer o JOIN nl_int4 i ON o.kn = i.val');
+SELECT COUNT(*) FROM nl_outer o JOIN nl_int4 i ON o.kn = i.val;
+
+-- Without Memoize every outer row probes the index
+SET enable_memoize = off;
+SELECT nl_memoize('SELECT COUNT(*) FROM nl_outer o JOIN nl_numeric n ON o.k8 = n.val');
+RESET enable_memoize;
+
+RESET enable_hashjoin;
+RESET enable_mergejoin;
+DROP FUNCTION nl_memoize(text);
+DROP TABLE nl_outer;
+
 -- Clean up
 DROP TABLE nl_int4;
 DROP TABLE nl_numeric;
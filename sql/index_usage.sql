@@ -104,6 +104,299 @@ EXPLAIN (COSTS OFF) SELECT * FROM test_int8 WHERE val = 100::float8;
 -- Test 9b: int8 = float8 (commutator)
 EXPLAIN (COSTS OFF) SELECT * FROM test_int8 WHERE 100::float8 = val;
 
+-- ============================================================================
+-- Test Group 10: Constant arrays (IN lists and = ANY)
+-- Rewritten to native integer arrays usable as btree array keys
+-- ============================================================================
+-- Test 10a: IN list drops fractional and out-of-range elements and duplicates
+EXPLAIN (COSTS OFF) SELECT * FROM test_int4 WHERE val IN (1.0, 2.5, 3.0, 3.0, 99999999999);
+SELECT val FROM test_int4 WHERE val IN (1.0, 2.5, 3.0, 3.0, 99999999999) ORDER BY val;
+-- Test 10b: = ANY over a float8 array constant
+EXPLAIN (COSTS OFF) SELECT * FROM test_int8 WHERE val = ANY ('{5,6,7.5}'::float8[]);
+-- Test 10c: single remaining element becomes a plain comparison
+EXPLAIN (COSTS OFF) SELECT * FROM test_int2 WHERE val IN (10.0, 10.5);
+-- Test 10d: no remaining elements → FALSE
+EXPLAIN (COSTS OFF) SELECT * FROM test_int4 WHERE val = ANY (ARRAY[1.5, 2.5]::numeric[]);
+-- Test 10e: NULL elements are kept
+EXPLAIN (COSTS OFF) SELECT * FROM test_int4 WHERE val = ANY (ARRAY[1.0, NULL, 2.5]::numeric[]);
+-- Test 10f: NOT IN drops elements that can never be equal
+EXPLAIN (COSTS OFF) SELECT * FROM test_int4 WHERE val NOT IN (1.5, 2.0, 3.0);
+SELECT count(*) FROM test_int4 WHERE val NOT IN (1.5, 2.0, 3.0);
+-- Test 10g: array parameter in a custom plan
+SET plan_cache_mode = force_custom_plan;
+PREPARE int4_any(numeric[]) AS SELECT * FROM test_int4 WHERE val = ANY ($1);
+EXPLAIN (COSTS OFF) EXECUTE int4_any('{5.0, 6.5, 7}');
+EXECUTE int4_any('{5.0, 6.5, 7}');
+DEALLOCATE int4_any;
+RESET plan_cache_mode;
+-- Test 10h: OR of equalities becomes one = ANY, dropping impossible values
+EXPLAIN (COSTS OFF) SELECT * FROM test_int4 WHERE val = 1.0 OR val = 2.5 OR 3.0 = val OR val = 3::float8;
+SELECT val FROM test_int4 WHERE val = 1.0 OR val = 2.5 OR 3.0 = val OR val = 3::float8 ORDER BY val;
+-- Test 10i: other OR arguments are kept
+SELECT val FROM test_int4 WHERE val = 1.0 OR id = 5 OR val = 2.0 ORDER BY val;
+-- Test 10j: no possible value left → FALSE
+EXPLAIN (COSTS OFF) SELECT * FROM test_int4 WHERE val = 1.5 OR val = 2.5;
+-- Test 10k: parameters in a custom plan
+SET plan_cache_mode = force_custom_plan;
+PREPARE int4_or(numeric, numeric, numeric) AS
+  SELECT * FROM test_int4 WHERE val = $1 OR val = $2 OR val = $3;
+EXPLAIN (COSTS OFF) EXECUTE int4_or(5.0, 6.5, 7);
+EXECUTE int4_or(5.0, 6.5, 7);
+DEALLOCATE int4_or;
+RESET plan_cache_mode;
+-- Test 10l: with every element dropped a NULL operand still gives NULL, also
+-- in the target list and under NOT; an empty array gives FALSE/TRUE
+SELECT x, x = ANY ('{1.5}'::numeric[]) AS eq_any,
+       x <> ALL ('{1.5}'::numeric[]) AS ne_all,
+       NOT (x = ANY ('{1.5, 2.5}'::numeric[])) AS not_eq_any,
+       x = ANY ('{}'::numeric[]) AS eq_empty,
+       x <> ALL ('{}'::numeric[]) AS ne_empty
+FROM (VALUES (1), (NULL::int4)) v(x) ORDER BY x;
+SELECT count(*) FILTER (WHERE NOT (x = ANY ('{1.5}'::numeric[]))) AS not_eq_any,
+       count(*) FILTER (WHERE x <> ALL ('{1.5}'::numeric[])) AS ne_all
+FROM (VALUES (1), (NULL::int4)) v(x);
+-- Test 10m: an OR chain left without values keeps NULL in the same way
+SELECT x, (x = 1.5 OR x = 2.5) AS eq_or, NOT (x = 1.5 OR x = 2.5) AS not_eq_or
+FROM (VALUES (1), (NULL::int4)) v(x) ORDER BY x;
+SELECT count(*) FROM (VALUES (1), (NULL::int4)) v(x) WHERE NOT (x = 1.5 OR x = 2.5);
+
+-- ============================================================================
+-- Test Group 11: Generic plans (Param comparands)
+-- Rewritten to native integer comparisons against runtime index keys
+-- ============================================================================
+SET plan_cache_mode = force_generic_plan;
+-- Test 11a: equality uses the integer index with a runtime key
+PREPARE int4_eq(numeric) AS SELECT * FROM test_int4 WHERE val = $1;
+EXPLAIN (COSTS OFF) EXECUTE int4_eq(100);
+EXECUTE int4_eq(100);
+EXECUTE int4_eq(100.5);
+DEALLOCATE int4_eq;
+-- Test 11b: range keys round fractional bounds inward
+PREPARE int4_range(numeric, numeric) AS
+  SELECT count(*) FROM test_int4 WHERE val > $1 AND val <= $2;
+EXECUTE int4_range(10.5, 15);
+EXECUTE int4_range(10, 15.5);
+-- Test 11c: out-of-range and special bounds
+EXECUTE int4_range(-1e30, 3);
+EXECUTE int4_range(5, 99999999999);
+EXECUTE int4_range(9998, 'NaN');
+EXECUTE int4_range('-Infinity', 2);
+EXECUTE int4_range('Infinity', 'Infinity');
+DEALLOCATE int4_range;
+-- Test 11d: float8 parameter, exclusive upper bound
+PREPARE int2_lt(float8) AS SELECT count(*) FROM test_int2 WHERE val < $1;
+EXECUTE int2_lt(10.0);
+EXECUTE int2_lt(10.5);
+EXECUTE int2_lt(-32768);
+DEALLOCATE int2_lt;
+-- Test 11f: OR of runtime keys is still an index condition
+PREPARE int4_or_key(numeric, numeric) AS
+  SELECT count(*) FROM test_int4 WHERE val = $1 OR val > $2;
+EXPLAIN (COSTS OFF) EXECUTE int4_or_key(100.5, 9998.5);
+EXECUTE int4_or_key(100.5, 9998.5);
+EXECUTE int4_or_key('NaN', 1e30);
+EXECUTE int4_or_key(100, -1e30);
+DEALLOCATE int4_or_key;
+-- Test 11g: under NOT and IS FALSE a comparison no integer satisfies stays
+-- FALSE, so negating it matches every row
+PREPARE int4_not_eq(numeric) AS
+  SELECT count(*) FROM test_int4 WHERE NOT (val = $1);
+EXECUTE int4_not_eq(100.5);
+EXECUTE int4_not_eq('NaN');
+EXECUTE int4_not_eq(100);
+DEALLOCATE int4_not_eq;
+PREPARE int4_not_gt(numeric) AS
+  SELECT count(*) FROM test_int4 WHERE NOT (val > $1);
+EXECUTE int4_not_gt(1e30);
+EXECUTE int4_not_gt('NaN');
+EXECUTE int4_not_gt(9998.5);
+DEALLOCATE int4_not_gt;
+PREPARE int4_is_false(numeric) AS
+  SELECT count(*) FROM test_int4 WHERE (val = $1) IS FALSE;
+EXECUTE int4_is_false(100.5);
+DEALLOCATE int4_is_false;
+-- Test 11h: target list and CASE return FALSE, not NULL
+PREPARE int4_tlist(numeric) AS
+  SELECT val = $1 AS eq, val > $1 AS gt, val < $1 AS lt,
+         CASE WHEN val = $1 THEN 'eq' ELSE 'ne' END AS eq_case
+  FROM test_int4 WHERE id = 100;
+EXECUTE int4_tlist(100.5);
+EXECUTE int4_tlist('NaN');
+EXECUTE int4_tlist(-1e30);
+EXECUTE int4_tlist(1e30);
+DEALLOCATE int4_tlist;
+RESET plan_cache_mode;
+-- Test 11e: stable expression comparand
+EXPLAIN (COSTS OFF) SELECT * FROM test_int4 WHERE val = to_number('100', '999');
+
+-- ============================================================================
+-- Test Group 12: Inexact column vs integer constant
+-- Rewritten to the column's native operator with an exactly converted constant
+-- ============================================================================
+CREATE TABLE inexact_numeric (id serial PRIMARY KEY, val numeric);
+CREATE INDEX idx_inexact_numeric_val ON inexact_numeric(val);
+INSERT INTO inexact_numeric (val) SELECT i FROM generate_series(1, 1000) i;
+ANALYZE inexact_numeric;
+CREATE TABLE inexact_float4 (id serial PRIMARY KEY, val float4);
+CREATE INDEX idx_inexact_float4_val ON inexact_float4(val);
+INSERT INTO inexact_float4 (val) SELECT i FROM generate_series(1, 1000) i;
+INSERT INTO inexact_float4 (val) VALUES (16777216), (16777218), (NULL);
+ANALYZE inexact_float4;
+CREATE TABLE inexact_float8 (id serial PRIMARY KEY, val float8);
+CREATE INDEX idx_inexact_float8_val ON inexact_float8(val);
+INSERT INTO inexact_float8 (val) SELECT i FROM generate_series(1, 1000) i;
+INSERT INTO inexact_float8 (val) VALUES (9007199254740992), (9007199254740994);
+ANALYZE inexact_float8;
+
+-- Test 12a: numeric column = int4 constant
+EXPLAIN (COSTS OFF) SELECT * FROM inexact_numeric WHERE val = 100::int4;
+-- Test 12b: commuted int8 constant
+EXPLAIN (COSTS OFF) SELECT * FROM inexact_numeric WHERE 100::int8 < val;
+-- Test 12c: float4 column = int2 constant
+EXPLAIN (COSTS OFF) SELECT * FROM inexact_float4 WHERE val = 100::int2;
+-- Test 12d: float8 column <= int8 constant
+EXPLAIN (COSTS OFF) SELECT * FROM inexact_float8 WHERE val <= 100::int8;
+-- Test 12e: integer not representable as float4 can never be equal
+EXPLAIN (COSTS OFF) SELECT * FROM inexact_float4 WHERE val = 16777217::int4;
+-- Test 12f: bounds between two floats resolve to the neighbouring float;
+-- the always-true inequality still excludes NULL
+SELECT count(*) FILTER (WHERE val = 16777217::int4) AS eq,
+       count(*) FILTER (WHERE val <> 16777217::int4) AS ne,
+       count(*) FILTER (WHERE val < 16777217::int4) AS lt,
+       count(*) FILTER (WHERE val >= 16777217::int4) AS ge
+FROM inexact_float4;
+SELECT count(*) FILTER (WHERE val = 9007199254740993::int8) AS eq,
+       count(*) FILTER (WHERE val <= 9007199254740993::int8) AS le,
+       count(*) FILTER (WHERE val > 9007199254740993::int8) AS gt
+FROM inexact_float8;
+SELECT count(*) FROM inexact_numeric WHERE val > 999::int2;
+-- The constant results stay NULL for a NULL column, also under NOT
+SELECT count(*) FILTER (WHERE NOT (val = 16777217::int4)) AS not_eq,
+       count(*) FILTER (WHERE (val = 16777217::int4) IS NULL) AS eq_null,
+       count(*) FILTER (WHERE (val <> 16777217::int4) IS NULL) AS ne_null
+FROM inexact_float4;
+-- The same for an integer array none of whose elements the column can hold
+SELECT count(*) FILTER (WHERE NOT (val = ANY ('{16777217}'::int4[]))) AS not_eq_any,
+       count(*) FILTER (WHERE (val = ANY ('{16777217}'::int4[])) IS NULL) AS eq_any_null,
+       count(*) FILTER (WHERE (val <> ALL ('{16777217}'::int4[])) IS NULL) AS ne_all_null
+FROM inexact_float4;
+-- Test 12g: results agree with support functions disabled
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+SELECT count(*) FROM inexact_float4 WHERE val >= 16777217::int4;
+SELECT count(*) FROM inexact_numeric WHERE val > 999::int2;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+DROP TABLE inexact_numeric;
+DROP TABLE inexact_float4;
+DROP TABLE inexact_float8;
+
+-- ============================================================================
+-- Test Group 13: Integer expressions in place of a column
+-- Coercions, arithmetic and expression index keys get the native operator
+-- ============================================================================
+CREATE INDEX idx_int4_val_plus ON test_int4 ((val + 1));
+CREATE DOMAIN int4_dom AS int4;
+CREATE TABLE test_expr (
+  id serial PRIMARY KEY,
+  dom_val int4_dom,
+  payload jsonb
+);
+CREATE INDEX idx_expr_dom ON test_expr(dom_val);
+CREATE INDEX idx_expr_payload_id ON test_expr (((payload->>'id')::int8));
+INSERT INTO test_expr (dom_val, payload)
+  SELECT i, jsonb_build_object('id', i) FROM generate_series(1, 1000) i;
+ANALYZE test_int4;
+ANALYZE test_expr;
+
+-- Test 13a: arithmetic matches the expression index
+EXPLAIN (COSTS OFF) SELECT * FROM test_int4 WHERE val + 1 = 101::numeric;
+-- Test 13b: fractional comparand on an expression is still impossible
+EXPLAIN (COSTS OFF) SELECT * FROM test_int4 WHERE val + 1 = 10.5::numeric;
+-- Test 13c: range bound adjusted on an expression
+SELECT count(*) FROM test_int4 WHERE val + 1 > 9990.5::numeric;
+-- Test 13d: domain column (RelabelType) uses the column index
+EXPLAIN (COSTS OFF) SELECT * FROM test_expr WHERE dom_val = 100::float8;
+-- Test 13e: JSON-derived key matches the expression index
+EXPLAIN (COSTS OFF) SELECT * FROM test_expr WHERE (payload->>'id')::int8 = 42::numeric;
+SELECT id FROM test_expr WHERE (payload->>'id')::int8 = 42::numeric;
+-- Test 13f: constant array against an expression
+EXPLAIN (COSTS OFF) SELECT * FROM test_int4 WHERE val + 1 IN (101.0, 102.5);
+-- Test 13g: generic plan runtime key on an expression
+SET plan_cache_mode = force_generic_plan;
+PREPARE expr_eq(numeric) AS SELECT * FROM test_int4 WHERE val + 1 = $1;
+EXPLAIN (COSTS OFF) EXECUTE expr_eq(101);
+EXECUTE expr_eq(101);
+DEALLOCATE expr_eq;
+RESET plan_cache_mode;
+-- Test 13h: partial index predicate implied by the rewritten bound
+CREATE TABLE test_partial (id int4, val int4);
+INSERT INTO test_partial
+  SELECT i, CASE WHEN i <= 9990 THEN i % 10 ELSE i END FROM generate_series(1, 10000) i;
+CREATE INDEX idx_partial_val ON test_partial(val) WHERE val > 10;
+ANALYZE test_partial;
+EXPLAIN (COSTS OFF) SELECT * FROM test_partial WHERE val > 10.5;
+SELECT count(*) FROM test_partial WHERE val > 10.5;
+-- Test 13i: a bound outside the index predicate cannot use it
+EXPLAIN (COSTS OFF) SELECT * FROM test_partial WHERE val > 9.5;
+DROP TABLE test_partial;
+DROP INDEX idx_int4_val_plus;
+DROP TABLE test_expr;
+DROP DOMAIN int4_dom;
+
+-- ============================================================================
+-- Test Group 14: BRIN minmax indexes
+-- The cross-type operators are members of the BRIN minmax families, so clauses
+-- that are not simplified to native comparisons still prune block ranges
+-- ============================================================================
+CREATE TABLE brin_events (id int8, reading numeric, level float8);
+INSERT INTO brin_events SELECT i, i, i FROM generate_series(1, 10000) i;
+CREATE INDEX brin_events_id ON brin_events USING brin (id) WITH (pages_per_range = 4);
+CREATE INDEX brin_events_reading ON brin_events USING brin (reading) WITH (pages_per_range = 4);
+CREATE INDEX brin_events_level ON brin_events USING brin (level) WITH (pages_per_range = 4);
+ANALYZE brin_events;
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+-- Test 14a: int8 column, numeric comparand
+EXPLAIN (COSTS OFF) SELECT count(*) FROM brin_events WHERE id = 5000::numeric;
+SELECT count(*) FROM brin_events WHERE id = 5000::numeric;
+-- Test 14b: int8 column, fractional float8 bound
+EXPLAIN (COSTS OFF) SELECT count(*) FROM brin_events WHERE id >= 9990.5::float8;
+SELECT count(*) FROM brin_events WHERE id >= 9990.5::float8;
+-- Test 14c: numeric column, int4 comparand
+EXPLAIN (COSTS OFF) SELECT count(*) FROM brin_events WHERE reading < 10::int4;
+SELECT count(*) FROM brin_events WHERE reading < 10::int4;
+-- Test 14d: float8 column, int8 comparand
+EXPLAIN (COSTS OFF) SELECT count(*) FROM brin_events WHERE level > 9995::int8;
+SELECT count(*) FROM brin_events WHERE level > 9995::int8;
+-- Test 14e: numeric parameter of a generic plan
+SET plan_cache_mode = force_generic_plan;
+PREPARE brin_lt(numeric) AS SELECT count(*) FROM brin_events WHERE id < $1;
+EXPLAIN (COSTS OFF) EXECUTE brin_lt(100.5);
+EXECUTE brin_lt(100.5);
+DEALLOCATE brin_lt;
+RESET plan_cache_mode;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+-- Test 14f: cross-type operators per BRIN family
+SELECT of.opfname, COUNT(*) AS cross_type_operators
+FROM pg_amop ao
+JOIN pg_opfamily of ON ao.amopfamily = of.oid
+JOIN pg_am am ON of.opfmethod = am.oid
+WHERE am.amname = 'brin'
+AND of.opfname IN ('integer_minmax_ops', 'numeric_minmax_ops', 'float_minmax_ops')
+AND ((ao.amoplefttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype) AND ao.amoprighttype IN ('numeric'::regtype, 'float4'::regtype, 'float8'::regtype))
+     OR (ao.amoplefttype IN ('numeric'::regtype, 'float4'::regtype, 'float8'::regtype) AND ao.amoprighttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype)))
+GROUP BY of.opfname
+ORDER BY of.opfname;
+-- The minmax-multi families (PostgreSQL 14+) get the same operators
+SELECT current_setting('server_version_num')::int < 140000 OR COUNT(*) = 90
+       AS minmax_multi_registered
+FROM pg_amop ao
+JOIN pg_opfamily of ON ao.amopfamily = of.oid
+JOIN pg_am am ON of.opfmethod = am.oid
+WHERE am.amname = 'brin'
+AND of.opfname LIKE '%minmax_multi_ops'
+AND ((ao.amoplefttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype) AND ao.amoprighttype IN ('numeric'::regtype, 'float4'::regtype, 'float8'::regtype))
+     OR (ao.amoplefttype IN ('numeric'::regtype, 'float4'::regtype, 'float8'::regtype) AND ao.amoprighttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype)));
+DROP TABLE brin_events;
+
 -- ============================================================================
 -- Verify actual query results for sample combinations
 -- ============================================================================
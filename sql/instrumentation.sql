@@ -0,0 +1,70 @@
+-- Test the instrumentation counters (pg_num2int_direct_comp_stats)
+-- Counters are kept per backend; shared_count needs shared_preload_libraries
+-- and is NULL here
+
+-- Load extension
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+-- ============================================================================
+-- Setup
+-- ============================================================================
+-- A temporary table is never analyzed behind the test's back
+CREATE TEMP TABLE inst_test (id int4, val numeric);
+INSERT INTO inst_test VALUES
+  (1, 1), (2, 2), (3, 3), (4, 4.5), (5, 5.5), (6, 6.25), (7, -7.5),
+  (8, 1e30), (9, -1e30), (10, NULL);
+
+SELECT pg_num2int_direct_comp_stats_reset();
+SELECT counter, backend_count FROM pg_num2int_direct_comp_stats;
+SELECT bool_and(shared_count IS NULL) AS no_shared_totals FROM pg_num2int_direct_comp_stats;
+
+-- ============================================================================
+-- Simplifier outcomes
+-- ============================================================================
+-- Exact integer constant: native comparison
+SELECT count(*) FROM inst_test WHERE id = 10::numeric;
+-- Fractional constant: folded to FALSE
+SELECT count(*) FROM inst_test WHERE id = 10.5::numeric;
+-- NaN constant: left alone
+SELECT count(*) FROM inst_test WHERE id < 'NaN'::numeric;
+-- Inexact column vs integer constant: native numeric comparison
+SELECT count(*) FROM inst_test WHERE val = 3::int4;
+SELECT counter, backend_count FROM pg_num2int_direct_comp_stats WHERE backend_count > 0;
+
+-- ============================================================================
+-- Bail-out reasons
+-- ============================================================================
+SELECT pg_num2int_direct_comp_stats_reset();
+SET plan_cache_mode = force_generic_plan;
+-- Parameter in a generic plan: runtime index key
+PREPARE inst_eq(numeric) AS SELECT count(*) FROM inst_test WHERE id = $1;
+EXECUTE inst_eq(3);
+-- <> is never an index key
+PREPARE inst_ne(numeric) AS SELECT count(*) FROM inst_test WHERE id <> $1;
+EXECUTE inst_ne(3);
+DEALLOCATE inst_eq;
+DEALLOCATE inst_ne;
+RESET plan_cache_mode;
+-- Column against column: nothing to simplify
+SELECT count(*) FROM inst_test WHERE id = val;
+-- Support functions disabled
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+SELECT count(*) FROM inst_test WHERE id = 10::numeric;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+SELECT counter, backend_count FROM pg_num2int_direct_comp_stats WHERE backend_count > 0;
+
+-- ============================================================================
+-- Slow-path numeric comparisons
+-- ============================================================================
+-- Per row: 4.5, 5.5 and 6.25 are fractions, 1e30 is beyond int64; values of
+-- the other sign and values equal to an integer are decided on the fast path
+SELECT pg_num2int_direct_comp_stats_reset();
+SELECT count(*) FROM inst_test WHERE val > id;
+SELECT counter, backend_count FROM pg_num2int_direct_comp_stats WHERE backend_count > 0;
+
+-- Reset clears everything
+SELECT pg_num2int_direct_comp_stats_reset();
+SELECT count(*) AS nonzero FROM pg_num2int_direct_comp_stats WHERE backend_count > 0;
+
+-- Cleanup
+DROP TABLE inst_test;
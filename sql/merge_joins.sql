@@ -257,6 +257,52 @@ SELECT COUNT(*) AS "int8_float8_matches"
 FROM merge_int8_float i
 JOIN merge_float8_ext f ON i.val = f.val;
 
+-- Merge join over special values: NaN sorts last, -0 equals 0, and integers
+-- a float cannot hold never match the float they round to
+\echo '=== Test: Merge Join with special float values ==='
+CREATE TEMPORARY TABLE merge_special_float8 (val FLOAT8);
+CREATE TEMPORARY TABLE merge_special_float4 (val FLOAT4);
+CREATE TEMPORARY TABLE merge_special_int8 (val INT8);
+
+INSERT INTO merge_special_float8 VALUES
+    ('NaN'::float8), ('-Infinity'), ('Infinity'), ('-0'), (0.5), (1),
+    (16777216), (16777217), (9007199254740992), (9007199254740993),
+    (-9223372036854775808), (9223372036854775807);
+INSERT INTO merge_special_float4 SELECT val::float4 FROM merge_special_float8;
+INSERT INTO merge_special_int8 VALUES
+    (-9223372036854775808), (-1), (0), (1), (16777216), (16777217),
+    (9007199254740992), (9007199254740993), (9223372036854775807);
+ANALYZE merge_special_float8;
+ANALYZE merge_special_float4;
+ANALYZE merge_special_int8;
+
+EXPLAIN (COSTS OFF)
+SELECT COUNT(*)
+FROM merge_special_int8 i
+JOIN merge_special_float8 f ON i.val = f.val;
+
+SELECT i.val AS int_val, COUNT(*) AS float8_matches
+FROM merge_special_int8 i
+JOIN merge_special_float8 f ON i.val = f.val
+GROUP BY i.val
+ORDER BY i.val;
+
+SELECT i.val AS int_val, COUNT(*) AS float4_matches
+FROM merge_special_int8 i
+JOIN merge_special_float4 f ON i.val = f.val
+GROUP BY i.val
+ORDER BY i.val;
+
+-- The ordering operators must agree with the sort order used by the join
+SELECT '16777216'::float4 < 16777217::int4 AS f4_lt_i4,
+       '16777216'::float4 < 16777217::int8 AS f4_lt_i8,
+       '9007199254740992'::float8 < 9007199254740993::int8 AS f8_lt_i8,
+       '9223372036854775807'::float8 > 9223372036854775807::int8 AS f8_gt_i8max;
+
+DROP TABLE merge_special_float8;
+DROP TABLE merge_special_float4;
+DROP TABLE merge_special_int8;
+
 -- Reset join settings
 RESET enable_hashjoin;
 RESET enable_nestloop;
@@ -267,6 +313,79 @@ DROP TABLE merge_float4;
 DROP TABLE merge_float8_ext;
 DROP TABLE merge_int8_float;
 
+\echo '=== Test: Merge Join through sortsupport comparators ==='
+-- Merge joins compare the two inputs through the btree support proc 2
+-- (sortsupport) comparators registered for each cross-type pair
+CREATE TEMPORARY TABLE ss_numeric (val NUMERIC);
+CREATE TEMPORARY TABLE ss_int8 (val INT8);
+CREATE TEMPORARY TABLE ss_float8 (val FLOAT8);
+
+INSERT INTO ss_numeric VALUES
+    (-5), (-0.5), (0), (1.5), (2), (2.000), (3), (1e20), ('NaN');
+INSERT INTO ss_int8 VALUES
+    (-9223372036854775808), (-5), (0), (1), (2), (3), (9223372036854775807);
+INSERT INTO ss_float8 VALUES
+    ('NaN'), ('-Infinity'), (-5), ('-0'), (0.5), (1), (3), (9223372036854775807);
+ANALYZE ss_numeric;
+ANALYZE ss_int8;
+ANALYZE ss_float8;
+
+SET enable_hashjoin = off;
+SET enable_nestloop = off;
+
+CREATE FUNCTION pg_temp.uses_merge_join(query text) RETURNS bool
+LANGUAGE plpgsql AS $$
+DECLARE
+  ln text;
+BEGIN
+  FOR ln IN EXECUTE 'EXPLAIN (COSTS OFF) ' || query LOOP
+    IF ln LIKE '%Merge Join%' THEN
+      RETURN true;
+    END IF;
+  END LOOP;
+  RETURN false;
+END $$;
+
+SELECT pg_temp.uses_merge_join('SELECT * FROM ss_numeric n JOIN ss_int8 i ON n.val = i.val') AS numeric_int8,
+       pg_temp.uses_merge_join('SELECT * FROM ss_int8 i JOIN ss_numeric n ON i.val = n.val') AS int8_numeric,
+       pg_temp.uses_merge_join('SELECT * FROM ss_int8 i JOIN ss_float8 f ON i.val = f.val') AS int8_float8,
+       pg_temp.uses_merge_join('SELECT * FROM ss_float8 f JOIN ss_int8 i ON f.val = i.val') AS float8_int8;
+
+SELECT i.val AS int_val, COUNT(*) AS numeric_matches
+FROM ss_numeric n
+JOIN ss_int8 i ON n.val = i.val
+GROUP BY i.val
+ORDER BY i.val;
+
+SELECT i.val AS int_val, COUNT(*) AS numeric_matches
+FROM ss_int8 i
+JOIN ss_numeric n ON i.val = n.val
+GROUP BY i.val
+ORDER BY i.val;
+
+SELECT i.val AS int_val, COUNT(*) AS float8_matches
+FROM ss_int8 i
+JOIN ss_float8 f ON i.val = f.val
+GROUP BY i.val
+ORDER BY i.val;
+
+SELECT opf.opfname AS opfamily, COUNT(*) AS sortsupport_procs
+FROM pg_amproc ap
+JOIN pg_opfamily opf ON opf.oid = ap.amprocfamily
+JOIN pg_am am ON am.oid = opf.opfmethod
+WHERE am.amname = 'btree'
+  AND ap.amprocnum = 2
+  AND ap.amproc::regproc::text LIKE '%\_cmp\_%\_sortsupport'
+GROUP BY opf.opfname
+ORDER BY opf.opfname;
+
+RESET enable_hashjoin;
+RESET enable_nestloop;
+
+DROP TABLE ss_numeric;
+DROP TABLE ss_int8;
+DROP TABLE ss_float8;
+
 -- Test 6: Explain why merge joins are now safe
 \echo '=== Test 6: Why Merge Joins Are Safe ==='
 \echo 'Operators are mathematically transitive for exact comparison semantics:'
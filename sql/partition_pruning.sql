@@ -0,0 +1,125 @@
+-- Test partition pruning with cross-type predicates on integer partition keys
+-- Plan-time pruning sees the simplified native predicates; executor pruning
+-- (generic-plan parameters, nested-loop parameters) and unsimplified clauses
+-- use the cross-type btree operators and comparison functions that the
+-- extension adds to integer_ops. The cast form "id::numeric = x" shows what
+-- PostgreSQL does without the extension: no pruning at all.
+
+-- Load extension
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+-- ============================================================================
+-- Setup: int8 range-partitioned table, 1000 ids per partition
+-- ============================================================================
+CREATE TABLE pp_orders (id int8, payload text) PARTITION BY RANGE (id);
+CREATE TABLE pp_orders_p0 PARTITION OF pp_orders FOR VALUES FROM (0) TO (1000);
+CREATE TABLE pp_orders_p1 PARTITION OF pp_orders FOR VALUES FROM (1000) TO (2000);
+CREATE TABLE pp_orders_p2 PARTITION OF pp_orders FOR VALUES FROM (2000) TO (3000);
+CREATE TABLE pp_orders_p3 PARTITION OF pp_orders FOR VALUES FROM (3000) TO (4000);
+CREATE INDEX pp_orders_id_idx ON pp_orders (id);
+INSERT INTO pp_orders SELECT i, 'order ' || i FROM generate_series(0, 3999) i;
+ANALYZE pp_orders;
+
+-- Count partition scans in a plan, partitions removed by executor startup
+-- pruning, and partition scans skipped by run-time pruning
+CREATE FUNCTION pp_pruning(query text, do_analyze bool DEFAULT false)
+RETURNS text LANGUAGE plpgsql AS $$
+DECLARE
+  line text;
+  scanned int := 0;
+  removed int := 0;
+  never int := 0;
+BEGIN
+  FOR line IN EXECUTE 'EXPLAIN (COSTS OFF'
+      || CASE WHEN do_analyze THEN ', ANALYZE, TIMING OFF, SUMMARY OFF' ELSE '' END
+      || ') ' || query LOOP
+    IF line ~ '(Seq Scan|Bitmap Heap Scan|Index Scan using \S+|Index Only Scan using \S+) on pp_orders_p\d' THEN
+      scanned := scanned + 1;
+      IF line ~ 'never executed' THEN
+        never := never + 1;
+      END IF;
+    END IF;
+    IF line ~ 'Subplans Removed' THEN
+      removed := removed + substring(line from '\d+')::int;
+    END IF;
+  END LOOP;
+  RETURN format('scanned=%s removed=%s never=%s', scanned, removed, never);
+END $$;
+
+-- ============================================================================
+-- Test 1: Plan-time pruning
+-- ============================================================================
+-- Without the extension: the partition key is cast, nothing is pruned
+SELECT pp_pruning('SELECT count(*) FROM pp_orders WHERE id::numeric = 1500::numeric');
+-- Exact numeric constant: one partition
+SELECT pp_pruning('SELECT count(*) FROM pp_orders WHERE id = 1500::numeric');
+SELECT count(*) FROM pp_orders WHERE id = 1500::numeric;
+-- Fractional constant: no integer can match, no partition is scanned
+SELECT pp_pruning('SELECT count(*) FROM pp_orders WHERE id = 1500.5::numeric');
+-- Fractional range bounds are tightened before pruning
+SELECT pp_pruning('SELECT count(*) FROM pp_orders WHERE id > 2999.5 AND id < 3000.5::float8');
+SELECT pp_pruning('SELECT count(*) FROM pp_orders WHERE id >= 999.5::numeric AND id < 2000::numeric');
+SELECT pp_pruning('SELECT count(*) FROM pp_orders WHERE id >= 2999.5');
+SELECT count(*) FROM pp_orders WHERE id >= 2999.5;
+
+-- ============================================================================
+-- Test 2: Unsimplified cross-type clauses still prune
+-- ============================================================================
+-- With support functions off the cross-type operator reaches the pruning code,
+-- which compares partition bounds with the cross-type comparison function
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+SELECT pp_pruning('SELECT count(*) FROM pp_orders WHERE id = 1500::numeric');
+SELECT pp_pruning('SELECT count(*) FROM pp_orders WHERE id = 1500.5::numeric');
+SELECT pp_pruning('SELECT count(*) FROM pp_orders WHERE id >= 2999.5');
+SELECT count(*) FROM pp_orders WHERE id >= 2999.5;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+
+-- ============================================================================
+-- Test 3: Executor startup pruning for generic-plan parameters
+-- ============================================================================
+SET plan_cache_mode = force_generic_plan;
+PREPARE pp_eq(numeric) AS SELECT count(*) FROM pp_orders WHERE id = $1;
+SELECT pp_pruning('EXECUTE pp_eq(1500)');
+EXECUTE pp_eq(1500);
+EXECUTE pp_eq(1500.5);
+DEALLOCATE pp_eq;
+PREPARE pp_range(numeric, numeric) AS
+  SELECT count(*) FROM pp_orders WHERE id > $1 AND id <= $2;
+SELECT pp_pruning('EXECUTE pp_range(999.5, 1999.5)');
+EXECUTE pp_range(999.5, 1999.5);
+DEALLOCATE pp_range;
+PREPARE pp_lt(float8) AS SELECT count(*) FROM pp_orders WHERE id < $1;
+SELECT pp_pruning('EXECUTE pp_lt(1000.0)');
+EXECUTE pp_lt(1000.0);
+DEALLOCATE pp_lt;
+-- Unsimplified parameter comparison
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+PREPARE pp_eq_off(numeric) AS SELECT count(*) FROM pp_orders WHERE id = $1;
+SELECT pp_pruning('EXECUTE pp_eq_off(1500)');
+EXECUTE pp_eq_off(1500);
+DEALLOCATE pp_eq_off;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+RESET plan_cache_mode;
+
+-- ============================================================================
+-- Test 4: Run-time pruning for nested-loop parameters
+-- ============================================================================
+CREATE TABLE pp_lookup (num numeric);
+INSERT INTO pp_lookup VALUES (1500), (3500.0), (2500.5);
+ANALYZE pp_lookup;
+SET enable_hashjoin = off;
+SET enable_mergejoin = off;
+SET enable_seqscan = off;
+-- Without the extension: every partition is scanned for every outer row
+SELECT pp_pruning('SELECT count(*) FROM pp_lookup l JOIN pp_orders o ON o.id::numeric = l.num', true);
+-- Partitions no outer value falls into are never scanned
+SELECT pp_pruning('SELECT count(*) FROM pp_lookup l JOIN pp_orders o ON o.id = l.num', true);
+SELECT count(*) FROM pp_lookup l JOIN pp_orders o ON o.id = l.num;
+RESET enable_hashjoin;
+RESET enable_mergejoin;
+RESET enable_seqscan;
+
+-- Cleanup
+DROP FUNCTION pp_pruning(text, bool);
+DROP TABLE pp_lookup;
+DROP TABLE pp_orders;
@@ -1,6 +1,7 @@
--- Test: Performance Benchmarks for Direct Numeric-Integer Comparison
--- Purpose: Verify overhead is within acceptable bounds (<10% vs native operators)
--- Note: Actual timing may vary by hardware; focus on relative performance
+-- Test: Plans and results of the performance-relevant paths
+-- Purpose: Verify index usage, IN-list rewrites and per-element comparison
+-- Note: Nothing here is timed; planning latency is measured by
+-- bench/planning/run.sh (make bench-planning), kernels by make bench
 
 -- Create test tables with 100,000 rows (reduced from 1M for faster CI/testing)
 CREATE TEMPORARY TABLE perf_int4 (id SERIAL PRIMARY KEY, val INT4);
@@ -69,6 +70,73 @@ SELECT * FROM perf_int4 WHERE val = 12345::numeric;
 EXPLAIN (COSTS OFF, ANALYZE OFF)
 SELECT * FROM perf_int4 WHERE val >= 80000::float8 AND val <= 80100::float8;
 
+-- Test 10: Large IN-lists against the inexact column
+-- PostgreSQL 14+ hashes "= ANY" over a constant of 9+ elements only when both
+-- sides share one hash function, so cross-type lists are rewritten to the
+-- column's native operator. Force the filter path, where hashing applies.
+SET enable_indexscan = off;
+SET enable_bitmapscan = off;
+SET max_parallel_workers_per_gather = 0;
+
+EXPLAIN (COSTS OFF)
+SELECT COUNT(*) FROM perf_numeric WHERE val = ANY ('{10,20,30,40,50,60,70,80,90,100}'::int8[]);
+EXPLAIN (COSTS OFF)
+SELECT COUNT(*) FROM perf_float8 WHERE val = ANY ('{10,20,30,40,50,60,70,80,90,100}'::int4[]);
+EXPLAIN (COSTS OFF)
+SELECT COUNT(*) FROM perf_numeric WHERE val <> ALL ('{10,20,30,40,50,60,70,80,90,100}'::int8[]);
+
+-- Lists of 20,000 elements passed as bound parameters, probed by 2,000 rows
+CREATE FUNCTION perf_any_count(query text, arr anyarray) RETURNS bigint
+LANGUAGE plpgsql AS $$
+DECLARE
+  n bigint;
+BEGIN
+  EXECUTE query INTO n USING arr;
+  RETURN n;
+END
+$$;
+
+SELECT 'numeric = ANY(int8[]) 20k'::text AS test,
+       perf_any_count('SELECT COUNT(*) FROM perf_numeric WHERE id <= 2000 AND val = ANY ($1)',
+                      (SELECT array_agg(g * 10)::int8[] FROM generate_series(1, 20000) g)) AS count;
+SELECT 'float8 = ANY(int8[]) 20k'::text AS test,
+       perf_any_count('SELECT COUNT(*) FROM perf_float8 WHERE id <= 2000 AND val = ANY ($1)',
+                      (SELECT array_agg(g * 10)::int8[] FROM generate_series(1, 20000) g)) AS count;
+SELECT 'int4 = ANY(float8[]) 20k'::text AS test,
+       perf_any_count('SELECT COUNT(*) FROM perf_int4 WHERE id <= 2000 AND val = ANY ($1)',
+                      (SELECT array_agg(g * 0.5)::float8[] FROM generate_series(1, 20000) g)) AS count;
+
+-- Same lists through the original per-element cross-type comparison
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+SELECT 'numeric = ANY(int8[]) 20k linear'::text AS test,
+       perf_any_count('SELECT COUNT(*) FROM perf_numeric WHERE id <= 2000 AND val = ANY ($1)',
+                      (SELECT array_agg(g * 10)::int8[] FROM generate_series(1, 20000) g)) AS count;
+SELECT 'int4 = ANY(float8[]) 20k linear'::text AS test,
+       perf_any_count('SELECT COUNT(*) FROM perf_int4 WHERE id <= 2000 AND val = ANY ($1)',
+                      (SELECT array_agg(g * 0.5)::float8[] FROM generate_series(1, 20000) g)) AS count;
+
+-- Constant lists probed per element: the array of "= ANY" is stable, but each
+-- call sees a different element, so the per-call-site cache is not used for it
+SELECT 'int4 = ANY(numeric[]) const'::text AS test, COUNT(*) AS count
+FROM perf_int4 WHERE val = ANY ('{10.5,20,30.0,40.25,NaN,50}'::numeric[]);
+SELECT 'int4 <> ALL(numeric[]) const'::text AS test, COUNT(*) AS count
+FROM perf_int4 WHERE val <> ALL ('{1.5,2,3.0}'::numeric[]);
+SELECT 'float8 = ANY(int8[]) const'::text AS test, COUNT(*) AS count
+FROM perf_float8 WHERE val = ANY ('{10,20,30,40,50}'::int8[]);
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+
+DROP FUNCTION perf_any_count(text, anyarray);
+RESET enable_indexscan;
+RESET enable_bitmapscan;
+RESET max_parallel_workers_per_gather;
+
+-- Kernel microbenchmark: every kernel and distribution runs, timings are not checked
+SELECT kernel_name, distribution, calls, ns_per_op >= 0 AS timed
+FROM num2int_bench('all', 2048);
+SELECT count(*) AS distributions FROM num2int_bench('numeric_cmp_int8', 1);
+SELECT * FROM num2int_bench('numeric_cmp', 10);
+SELECT * FROM num2int_bench('all', 0);
+
 -- Clean up
 DROP TABLE perf_int4;
 DROP TABLE perf_numeric;
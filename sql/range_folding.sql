@@ -0,0 +1,90 @@
+-- Test planner-level folding of range predicates on the same operand
+-- pg_num2int_direct_comp.enableRangeFolding intersects the integer bounds of
+-- all range and equality predicates on one operand in a WHERE/ON clause
+
+-- Load extension
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+-- ============================================================================
+-- Setup
+-- ============================================================================
+CREATE TABLE rf_test (
+  id serial PRIMARY KEY,
+  val int4,
+  val8 int8
+);
+CREATE INDEX rf_val_idx ON rf_test(val);
+CREATE INDEX rf_val8_idx ON rf_test(val8);
+INSERT INTO rf_test (val, val8) SELECT i, i FROM generate_series(1, 1000) i;
+INSERT INTO rf_test (val, val8) VALUES (NULL, NULL);
+ANALYZE rf_test;
+SET enable_seqscan = off;
+SET enable_bitmapscan = off;
+
+-- ============================================================================
+-- Test 1: Folding is off by default
+-- ============================================================================
+SELECT current_setting('pg_num2int_direct_comp.enableRangeFolding') AS range_folding;
+EXPLAIN (COSTS OFF) SELECT * FROM rf_test WHERE val > 10.2 AND val < 10.8;
+
+-- ============================================================================
+-- Test 2: Empty ranges become constant FALSE
+-- ============================================================================
+SET pg_num2int_direct_comp.enableRangeFolding = on;
+EXPLAIN (COSTS OFF) SELECT * FROM rf_test WHERE val > 10.2 AND val < 10.8;
+EXPLAIN (COSTS OFF) SELECT * FROM rf_test WHERE val = 5 AND val > 5.5::float8;
+SELECT count(*) FROM rf_test WHERE val > 10.2 AND val < 10.8;
+
+-- ============================================================================
+-- Test 3: Equal bounds collapse into equality
+-- ============================================================================
+EXPLAIN (COSTS OFF) SELECT * FROM rf_test WHERE val >= 10.5 AND val < 11.5;
+EXPLAIN (COSTS OFF) SELECT * FROM rf_test WHERE 10.5 < val8 AND val8 <= 11::numeric;
+SELECT id FROM rf_test WHERE val >= 10.5 AND val < 11.5;
+
+-- ============================================================================
+-- Test 4: Overlapping bounds merge into one range
+-- ============================================================================
+EXPLAIN (COSTS OFF) SELECT * FROM rf_test WHERE val > 5 AND val > 7.5 AND val <= 100::numeric;
+SELECT count(*) FROM rf_test WHERE val > 5 AND val > 7.5 AND val <= 100::numeric;
+-- Other conjuncts are kept
+SELECT count(*) FROM rf_test WHERE val >= 10 AND id < 15 AND val <= 20.5::float8;
+
+-- ============================================================================
+-- Test 5: Bounds spanning the whole type still reject NULL
+-- ============================================================================
+SELECT count(*) FROM rf_test
+WHERE val >= '-2147483648'::int4 AND val <= '2147483647'::int4;
+
+-- ============================================================================
+-- Test 6: Join quals, subqueries and nested conjunctions
+-- ============================================================================
+SELECT count(*) FROM rf_test a JOIN rf_test b
+  ON a.id = b.id AND b.val > 10.2 AND b.val < 10.8;
+SELECT count(*) FROM rf_test a LEFT JOIN rf_test b
+  ON a.id = b.id AND b.val > 10.2 AND b.val < 10.8;
+SELECT count(*) FROM (SELECT * FROM rf_test WHERE val > 10.2 AND val < 10.8 OFFSET 0) s;
+SELECT count(*) FROM rf_test WHERE (val > 10.2 AND val < 10.8) OR val = 5;
+
+-- ============================================================================
+-- Test 7: No folding while support functions are disabled
+-- ============================================================================
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+SELECT count(*) FROM rf_test WHERE val >= 10.5 AND val < 11.5;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+
+-- ============================================================================
+-- Test 8: Each comparison is simplified once
+-- ============================================================================
+-- A lone comparison on an operand is left to the planner; two on one operand
+-- are simplified by the folding and replaced by the folded native clauses
+SELECT pg_num2int_direct_comp_stats_reset();
+SELECT count(*) FROM rf_test WHERE val > 10.5 AND val8 < 20.5;
+SELECT count(*) FROM rf_test WHERE val > 10.5 AND val < 20.5;
+SELECT counter, backend_count FROM pg_num2int_direct_comp_stats WHERE backend_count > 0;
+
+-- Cleanup
+RESET pg_num2int_direct_comp.enableRangeFolding;
+RESET enable_seqscan;
+RESET enable_bitmapscan;
+DROP TABLE rf_test;
@@ -177,6 +177,187 @@ SELECT count(*) FROM selectivity_test WHERE int2_col < (-99999)::numeric;
 EXPLAIN (COSTS OFF) SELECT * FROM selectivity_test WHERE int2_col > (-99999)::numeric;
 SELECT count(*) FROM selectivity_test WHERE int2_col > (-99999)::numeric;
 
+-- ============================================================================
+-- Test Group 8: Constant on the left-hand side
+-- "10.5 < col" must be read as "col > 10.5", not "col < 10.5"
+-- ============================================================================
+
+-- Test 8a: 10.5 < int4 → int4 >= 11
+EXPLAIN (COSTS OFF) SELECT * FROM selectivity_test WHERE 10.5::numeric < int4_col;
+SELECT count(*) FROM selectivity_test WHERE 10.5::numeric < int4_col;
+
+-- Test 8b: 10.5 > int4 → int4 <= 10
+EXPLAIN (COSTS OFF) SELECT * FROM selectivity_test WHERE 10.5::numeric > int4_col;
+SELECT count(*) FROM selectivity_test WHERE 10.5::numeric > int4_col;
+
+-- ============================================================================
+-- Test Group 9: Selectivity estimation in the integer domain
+-- Comparands that are only constant at plan time (stable expressions) are
+-- rewritten to runtime index keys or estimated by num2int_restrictsel; either
+-- way they are estimated as the equivalent native integer predicate.
+-- ============================================================================
+CREATE TABLE selectivity_est (v int4);
+INSERT INTO selectivity_est SELECT i % 1000 FROM generate_series(1, 10000) i;
+ANALYZE selectivity_est;
+
+CREATE FUNCTION est_rows(query text) RETURNS bigint
+LANGUAGE plpgsql AS $$
+DECLARE
+  plan json;
+BEGIN
+  EXECUTE 'EXPLAIN (FORMAT JSON) ' || query INTO plan;
+  RETURN (plan->0->'Plan'->>'Plan Rows')::bigint;
+END;
+$$;
+
+-- Test 9a: Equality with a fractional value matches no row
+SELECT est_rows('SELECT * FROM selectivity_est WHERE v = to_number(''15.5'', ''99.9'')') AS fractional_eq;
+
+-- Test 9b: Range with a fractional boundary is estimated as the adjusted boundary
+SELECT est_rows('SELECT * FROM selectivity_est WHERE v < to_number(''15.5'', ''99.9'')')
+     = est_rows('SELECT * FROM selectivity_est WHERE v <= 15') AS lt_as_le;
+SELECT est_rows('SELECT * FROM selectivity_est WHERE v > to_number(''15.5'', ''99.9'')')
+     = est_rows('SELECT * FROM selectivity_est WHERE v >= 16') AS gt_as_ge;
+
+-- Test 9c: Constant on the left-hand side is commuted
+SELECT est_rows('SELECT * FROM selectivity_est WHERE to_number(''15.5'', ''99.9'') < v')
+     = est_rows('SELECT * FROM selectivity_est WHERE v >= 16') AS commuted;
+
+-- Test 9d: Inequality with a fractional value matches every non-NULL row
+SELECT est_rows('SELECT * FROM selectivity_est WHERE v <> to_number(''15.5'', ''99.9'')')
+     = est_rows('SELECT * FROM selectivity_est WHERE v IS NOT NULL') AS ne_all;
+
+-- Test 9e: Exact comparand is estimated like the native operator
+SELECT est_rows('SELECT * FROM selectivity_est WHERE v = to_number(''15.0'', ''99.9'')')
+     = est_rows('SELECT * FROM selectivity_est WHERE v = 15') AS exact_eq;
+
+-- Test 9f: Out-of-range comparand matches no row
+SELECT est_rows('SELECT * FROM selectivity_est WHERE v = to_number(''99999999999'', ''99999999999'')') AS out_of_range;
+
+-- Test 9g: Direct function call is estimated like its operator
+SELECT est_rows('SELECT * FROM selectivity_est WHERE int4_eq_numeric(v, to_number(''15.5'', ''99.9''))') AS direct_call;
+
+-- Test 9h: Generic estimator is used when support functions are disabled
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+SELECT est_rows('SELECT * FROM selectivity_est WHERE v = to_number(''15.5'', ''99.9'')') > 1 AS generic_estimate;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+
+DROP FUNCTION est_rows(text);
+DROP TABLE selectivity_est;
+
+-- ============================================================================
+-- Test Group 10: Comparison cost estimation (SupportRequestCost)
+-- Costs are the measured multiples of a native integer comparison: float ×
+-- integer is cheapest, numeric(p,0) × integer takes the typmod fast path, and
+-- numeric of unknown scale costs the most.
+-- ============================================================================
+CREATE TABLE cost_test (i int4, j int4, f float8, n numeric, n0 numeric(10,0));
+INSERT INTO cost_test SELECT i, i, i, i, i FROM generate_series(1, 1000) i;
+ANALYZE cost_test;
+
+CREATE FUNCTION est_cost(query text) RETURNS float8
+LANGUAGE plpgsql AS $$
+DECLARE
+  plan json;
+BEGIN
+  EXECUTE 'EXPLAIN (FORMAT JSON) ' || query INTO plan;
+  RETURN (plan->0->'Plan'->>'Total Cost')::float8;
+END;
+$$;
+
+-- Test 10a: float8 × int4 costs more than int4 × int4
+SELECT est_cost('SELECT * FROM cost_test WHERE f = i')
+     > est_cost('SELECT * FROM cost_test WHERE j = i') AS float_costs_more;
+
+-- Test 10b: numeric(10,0) × int4 costs more than float8 × int4
+SELECT est_cost('SELECT * FROM cost_test WHERE n0 = i')
+     > est_cost('SELECT * FROM cost_test WHERE f = i') AS integral_numeric_costs_more;
+
+-- Test 10c: unconstrained numeric × int4 costs more
+SELECT est_cost('SELECT * FROM cost_test WHERE n = i')
+     > est_cost('SELECT * FROM cost_test WHERE n0 = i') AS numeric_costs_more;
+
+-- Test 10d: flat procost is used when support functions are disabled
+SET pg_num2int_direct_comp.enableSupportFunctions = off;
+SELECT est_cost('SELECT * FROM cost_test WHERE n = i')
+     = est_cost('SELECT * FROM cost_test WHERE n0 = i') AS flat_cost;
+RESET pg_num2int_direct_comp.enableSupportFunctions;
+
+DROP FUNCTION est_cost(text);
+DROP TABLE cost_test;
+
+-- ============================================================================
+-- Test Group 11: Join selectivity (num2int_eqjoinsel)
+-- Cross-type equality joins match the MCV lists in the integer domain
+-- instead of calling the operator for every pair. The estimate must be the
+-- one eqjoinsel makes, which the operators fall back to when support
+-- functions are disabled.
+-- ============================================================================
+CREATE TABLE join_num (n numeric, f4 float4, f8 float8);
+INSERT INTO join_num
+SELECT v, v, v
+FROM (SELECT CASE WHEN i % 50 = 0 THEN NULL
+                  WHEN i % 10 = 0 THEN i % 37 + 0.5
+                  ELSE i % 37 END AS v
+      FROM generate_series(1, 5000) i) s;
+CREATE TABLE join_int (k2 int2, k4 int4, k8 int8);
+INSERT INTO join_int
+SELECT (i * i) % 61, (i * i) % 61, i % 100 FROM generate_series(1, 3000) i;
+CREATE TABLE join_nostats (k4 int4);
+INSERT INTO join_nostats SELECT i FROM generate_series(1, 100) i;
+ANALYZE join_num;
+ANALYZE join_int;
+
+CREATE FUNCTION join_rows(query text) RETURNS float8
+LANGUAGE plpgsql AS $$
+DECLARE
+  plan json;
+BEGIN
+  EXECUTE 'EXPLAIN (FORMAT JSON) ' || query INTO plan;
+  RETURN (plan->0->'Plan'->>'Plan Rows')::float8;
+END;
+$$;
+
+CREATE FUNCTION join_rows_match(query text) RETURNS bool
+LANGUAGE plpgsql AS $$
+DECLARE
+  extension_rows float8;
+  eqjoinsel_rows float8;
+BEGIN
+  extension_rows := join_rows(query);
+  PERFORM set_config('pg_num2int_direct_comp.enableSupportFunctions', 'off', true);
+  eqjoinsel_rows := join_rows(query);
+  PERFORM set_config('pg_num2int_direct_comp.enableSupportFunctions', 'on', true);
+  RETURN extension_rows = eqjoinsel_rows;
+END;
+$$;
+
+-- Test 11a: All cross-type = operators use the join estimator
+SELECT count(*) AS eq_operators
+FROM pg_operator WHERE oprjoin = 'num2int_eqjoinsel'::regproc;
+
+-- Test 11b: Inner joins in both operand orders
+SELECT join_rows_match('SELECT * FROM join_num JOIN join_int ON n = k4') AS numeric_int4,
+       join_rows_match('SELECT * FROM join_num JOIN join_int ON k4 = n') AS int4_numeric,
+       join_rows_match('SELECT * FROM join_num JOIN join_int ON f8 = k8') AS float8_int8,
+       join_rows_match('SELECT * FROM join_num JOIN join_int ON k2 = f4') AS int2_float4;
+
+-- Test 11c: Outer, semi and anti joins, with the integer side inner and outer
+SELECT join_rows_match('SELECT * FROM join_num LEFT JOIN join_int ON n = k8') AS left_join,
+       join_rows_match('SELECT * FROM join_num WHERE EXISTS (SELECT 1 FROM join_int WHERE k4 = n)') AS semi,
+       join_rows_match('SELECT * FROM join_int WHERE EXISTS (SELECT 1 FROM join_num WHERE f8 = k2)') AS semi_int_outer,
+       join_rows_match('SELECT * FROM join_num WHERE NOT EXISTS (SELECT 1 FROM join_int WHERE n = k4)') AS anti;
+
+-- Test 11d: Restricted inner side and a side without statistics
+SELECT join_rows_match('SELECT * FROM join_num WHERE n IN (SELECT k8 FROM join_int WHERE k8 < 5)') AS clamped_semi,
+       join_rows_match('SELECT * FROM join_num JOIN join_nostats ON n = k4') AS no_stats;
+
+DROP FUNCTION join_rows_match(text);
+DROP FUNCTION join_rows(text);
+DROP TABLE join_num;
+DROP TABLE join_int;
+DROP TABLE join_nostats;
+
 -- ============================================================================
 -- Cleanup
 -- ============================================================================
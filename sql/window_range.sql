@@ -0,0 +1,103 @@
+-- Test RANGE window frames with numeric and float offsets on integer columns
+-- The btree in_range support procs (support proc 3) move base +/- offset onto
+-- the integer grid, so the frame is the one the exact comparison gives
+
+-- Load extension
+CREATE EXTENSION IF NOT EXISTS pg_num2int_direct_comp;
+
+-- ============================================================================
+-- Setup
+-- ============================================================================
+CREATE TABLE wr_test (
+  k2 int2,
+  k4 int4,
+  k8 int8
+);
+INSERT INTO wr_test SELECT k, k, k FROM unnest(ARRAY[1, 2, 3, 5, 8, 13]) k;
+ANALYZE wr_test;
+
+-- ============================================================================
+-- Test 1: PRECEDING with a numeric offset
+-- val >= base - 2.5 is val >= base - 2, so both columns agree
+-- ============================================================================
+SELECT k4,
+       SUM(k4) OVER (ORDER BY k4 RANGE BETWEEN 2.5 PRECEDING AND CURRENT ROW) AS sum_numeric,
+       SUM(k4) OVER (ORDER BY k4 RANGE BETWEEN 2 PRECEDING AND CURRENT ROW) AS sum_int
+FROM wr_test
+ORDER BY k4;
+
+-- ============================================================================
+-- Test 2: FOLLOWING with float offsets
+-- val <= base + 2.5 is val <= base + 2
+-- ============================================================================
+SELECT k4,
+       SUM(k4) OVER (ORDER BY k4 RANGE BETWEEN CURRENT ROW AND 2.5::float8 FOLLOWING) AS sum_float8,
+       SUM(k4) OVER (ORDER BY k4 RANGE BETWEEN CURRENT ROW AND 2.5::float4 FOLLOWING) AS sum_float4
+FROM wr_test
+ORDER BY k4;
+
+-- ============================================================================
+-- Test 3: Descending order, int2 and int8 columns
+-- ============================================================================
+SELECT k8,
+       SUM(k8) OVER (ORDER BY k8 DESC RANGE BETWEEN 3.5 PRECEDING AND CURRENT ROW) AS sum_desc
+FROM wr_test
+ORDER BY k8 DESC;
+
+SELECT k2,
+       COUNT(*) OVER (ORDER BY k2 RANGE BETWEEN 1.5 PRECEDING AND 1.5::float8 FOLLOWING) AS neighbours
+FROM wr_test
+ORDER BY k2;
+
+-- ============================================================================
+-- Test 4: Offsets beyond the integer range
+-- ============================================================================
+CREATE TABLE wr_limits (k8 int8);
+INSERT INTO wr_limits VALUES (-9223372036854775808), (0), (9223372036854775807);
+
+SELECT k8,
+       COUNT(*) OVER (ORDER BY k8 RANGE BETWEEN 1e30 PRECEDING AND 'Infinity'::float8 FOLLOWING) AS all_rows,
+       COUNT(*) OVER (ORDER BY k8 RANGE BETWEEN CURRENT ROW AND 0.5 FOLLOWING) AS self_only
+FROM wr_limits
+ORDER BY k8;
+
+-- ============================================================================
+-- Test 5: Invalid offsets
+-- ============================================================================
+SELECT SUM(k4) OVER (ORDER BY k4 RANGE BETWEEN -1.5 PRECEDING AND CURRENT ROW)
+FROM wr_test;
+SELECT SUM(k4) OVER (ORDER BY k4 RANGE BETWEEN 'NaN'::float8 PRECEDING AND CURRENT ROW)
+FROM wr_test;
+
+-- ============================================================================
+-- Test 6: Built-in in_range procs keep working for the other sort types
+-- ============================================================================
+CREATE TABLE wr_inexact (n numeric, f8 float8);
+INSERT INTO wr_inexact VALUES (1, 1), (2.5, 2.5), (3, 3), (4.75, 4.75);
+
+SELECT n,
+       SUM(n) OVER (ORDER BY n RANGE BETWEEN 1.5 PRECEDING AND CURRENT ROW) AS sum_numeric,
+       SUM(f8) OVER (ORDER BY f8 RANGE BETWEEN 1.5 PRECEDING AND CURRENT ROW) AS sum_float8
+FROM wr_inexact
+ORDER BY n;
+
+-- ============================================================================
+-- Test 7: Registration in every family that orders the integer types
+-- ============================================================================
+SELECT opf.opfname AS opfamily, COUNT(*) AS in_range_procs
+FROM pg_amproc ap
+JOIN pg_opfamily opf ON opf.oid = ap.amprocfamily
+JOIN pg_am am ON am.oid = opf.opfmethod
+WHERE am.amname = 'btree'
+  AND ap.amprocnum = 3
+  AND opf.opfname IN ('integer_ops', 'numeric_ops', 'float_ops')
+  AND ap.amproclefttype IN ('int2'::regtype, 'int4'::regtype, 'int8'::regtype)
+GROUP BY opf.opfname
+ORDER BY opf.opfname;
+
+-- ============================================================================
+-- Cleanup
+-- ============================================================================
+DROP TABLE wr_test;
+DROP TABLE wr_limits;
+DROP TABLE wr_inexact;